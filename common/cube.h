@@ -1,5 +1,7 @@
 #pragma once
 
+#include "vertexformat.h"
+
 static const int TEX_COORDS_OFFSET = 3;
 static const int VERTEX_OFFSET = 5;
 
@@ -42,3 +44,19 @@ static const float CUBE_DATA[] = {
     1.0f,    -1.0f,   -1.0f,    1.0f, 1.0f,
     1.0f,    -1.0f,   1.0f,     1.0f, 0.0f 
 };
+
+// Layout of CUBE_DATA itself, used for vertices generated from it at runtime
+inline static void initCubeSourceVertexFormat(VertexFormat* format) {
+    initVertexFormat(format);
+    addVertexAttribute(format, 0, VERTEX_SEMANTIC_POSITION, VERTEX_ENCODING_FLOAT32, 3, 0);
+    addVertexAttribute(format, 1, VERTEX_SEMANTIC_TEX_COORDS, VERTEX_ENCODING_FLOAT32, 2, TEX_COORDS_OFFSET);
+}
+
+// Cube mesh in vertex buffers of both backends: snorm16 positions and unorm16 texture coords, 12 bytes
+// per vertex instead of 20. Cube fills [-1, 1] exactly, so its position scale and bias stay identity.
+inline static void initCubeVertexFormat(VertexFormat* format) {
+    initVertexFormat(format);
+    addVertexAttribute(format, 0, VERTEX_SEMANTIC_POSITION, VERTEX_ENCODING_SNORM16, 3, 0);
+    addVertexAttribute(format, 1, VERTEX_SEMANTIC_TEX_COORDS, VERTEX_ENCODING_UNORM16, 2, TEX_COORDS_OFFSET);
+    fitVertexPositions(format, CUBE_DATA, sizeof(CUBE_DATA) / sizeof(float) / VERTEX_OFFSET, VERTEX_OFFSET);
+}
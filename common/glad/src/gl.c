@@ -36,9 +36,3308 @@ int GLAD_GL_VERSION_4_0 = 0;
 int GLAD_GL_VERSION_4_1 = 0;
 int GLAD_GL_VERSION_4_2 = 0;
 int GLAD_GL_VERSION_4_3 = 0;
+int GLAD_GL_ARB_buffer_storage = 0;
+int GLAD_GL_ARB_direct_state_access = 0;
+int GLAD_GL_KHR_parallel_shader_compile = 0;
 
 
 
+#ifdef GLAD_OPTION_GL_ON_DEMAND
+static GLADuserptrloadfunc glad_gl_on_demand_load = NULL;
+static void* glad_gl_on_demand_userptr = NULL;
+
+static GLADapiproc glad_gl_on_demand_loader(const char *name) {
+    GLADapiproc result = NULL;
+    if (glad_gl_on_demand_load != NULL) {
+        result = glad_gl_on_demand_load(glad_gl_on_demand_userptr, name);
+    }
+    if (result == NULL) {
+        fprintf(stderr, "GLAD: failed to load %s on demand\n", name);
+        abort();
+    }
+    return result;
+}
+
+/* Stubs may run on several threads with current contexts at once (e.g. render and asset loader thread), */
+/* resolved pointer is published with an atomic store so no thread ever sees a torn value. */
+#ifdef _MSC_VER
+#include <windows.h>
+#define GLAD_GL_ON_DEMAND_STORE(pointer, value) InterlockedExchangePointer((PVOID volatile*) &(pointer), (PVOID) (value))
+#else
+#define GLAD_GL_ON_DEMAND_STORE(pointer, value) __atomic_store_n(&(pointer), (value), __ATOMIC_RELEASE)
+#endif
+
+static void GLAD_API_PTR glad_on_demand_impl_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+    PFNGLACTIVESHADERPROGRAMPROC proc = (PFNGLACTIVESHADERPROGRAMPROC) glad_gl_on_demand_loader("glActiveShaderProgram");
+    GLAD_GL_ON_DEMAND_STORE(glad_glActiveShaderProgram, proc);
+    proc(pipeline, program);
+}
+PFNGLACTIVESHADERPROGRAMPROC glad_glActiveShaderProgram = glad_on_demand_impl_glActiveShaderProgram;
+static void GLAD_API_PTR glad_on_demand_impl_glActiveTexture(GLenum texture) {
+    PFNGLACTIVETEXTUREPROC proc = (PFNGLACTIVETEXTUREPROC) glad_gl_on_demand_loader("glActiveTexture");
+    GLAD_GL_ON_DEMAND_STORE(glad_glActiveTexture, proc);
+    proc(texture);
+}
+PFNGLACTIVETEXTUREPROC glad_glActiveTexture = glad_on_demand_impl_glActiveTexture;
+static void GLAD_API_PTR glad_on_demand_impl_glAttachShader(GLuint program, GLuint shader) {
+    PFNGLATTACHSHADERPROC proc = (PFNGLATTACHSHADERPROC) glad_gl_on_demand_loader("glAttachShader");
+    GLAD_GL_ON_DEMAND_STORE(glad_glAttachShader, proc);
+    proc(program, shader);
+}
+PFNGLATTACHSHADERPROC glad_glAttachShader = glad_on_demand_impl_glAttachShader;
+static void GLAD_API_PTR glad_on_demand_impl_glBeginConditionalRender(GLuint id, GLenum mode) {
+    PFNGLBEGINCONDITIONALRENDERPROC proc = (PFNGLBEGINCONDITIONALRENDERPROC) glad_gl_on_demand_loader("glBeginConditionalRender");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBeginConditionalRender, proc);
+    proc(id, mode);
+}
+PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender = glad_on_demand_impl_glBeginConditionalRender;
+static void GLAD_API_PTR glad_on_demand_impl_glBeginQuery(GLenum target, GLuint id) {
+    PFNGLBEGINQUERYPROC proc = (PFNGLBEGINQUERYPROC) glad_gl_on_demand_loader("glBeginQuery");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBeginQuery, proc);
+    proc(target, id);
+}
+PFNGLBEGINQUERYPROC glad_glBeginQuery = glad_on_demand_impl_glBeginQuery;
+static void GLAD_API_PTR glad_on_demand_impl_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+    PFNGLBEGINQUERYINDEXEDPROC proc = (PFNGLBEGINQUERYINDEXEDPROC) glad_gl_on_demand_loader("glBeginQueryIndexed");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBeginQueryIndexed, proc);
+    proc(target, index, id);
+}
+PFNGLBEGINQUERYINDEXEDPROC glad_glBeginQueryIndexed = glad_on_demand_impl_glBeginQueryIndexed;
+static void GLAD_API_PTR glad_on_demand_impl_glBeginTransformFeedback(GLenum primitiveMode) {
+    PFNGLBEGINTRANSFORMFEEDBACKPROC proc = (PFNGLBEGINTRANSFORMFEEDBACKPROC) glad_gl_on_demand_loader("glBeginTransformFeedback");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBeginTransformFeedback, proc);
+    proc(primitiveMode);
+}
+PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback = glad_on_demand_impl_glBeginTransformFeedback;
+static void GLAD_API_PTR glad_on_demand_impl_glBindAttribLocation(GLuint program, GLuint index, const GLchar * name) {
+    PFNGLBINDATTRIBLOCATIONPROC proc = (PFNGLBINDATTRIBLOCATIONPROC) glad_gl_on_demand_loader("glBindAttribLocation");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBindAttribLocation, proc);
+    proc(program, index, name);
+}
+PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation = glad_on_demand_impl_glBindAttribLocation;
+static void GLAD_API_PTR glad_on_demand_impl_glBindBuffer(GLenum target, GLuint buffer) {
+    PFNGLBINDBUFFERPROC proc = (PFNGLBINDBUFFERPROC) glad_gl_on_demand_loader("glBindBuffer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBindBuffer, proc);
+    proc(target, buffer);
+}
+PFNGLBINDBUFFERPROC glad_glBindBuffer = glad_on_demand_impl_glBindBuffer;
+static void GLAD_API_PTR glad_on_demand_impl_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    PFNGLBINDBUFFERBASEPROC proc = (PFNGLBINDBUFFERBASEPROC) glad_gl_on_demand_loader("glBindBufferBase");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBindBufferBase, proc);
+    proc(target, index, buffer);
+}
+PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase = glad_on_demand_impl_glBindBufferBase;
+static void GLAD_API_PTR glad_on_demand_impl_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    PFNGLBINDBUFFERRANGEPROC proc = (PFNGLBINDBUFFERRANGEPROC) glad_gl_on_demand_loader("glBindBufferRange");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBindBufferRange, proc);
+    proc(target, index, buffer, offset, size);
+}
+PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange = glad_on_demand_impl_glBindBufferRange;
+static void GLAD_API_PTR glad_on_demand_impl_glBindFragDataLocation(GLuint program, GLuint color, const GLchar * name) {
+    PFNGLBINDFRAGDATALOCATIONPROC proc = (PFNGLBINDFRAGDATALOCATIONPROC) glad_gl_on_demand_loader("glBindFragDataLocation");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBindFragDataLocation, proc);
+    proc(program, color, name);
+}
+PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation = glad_on_demand_impl_glBindFragDataLocation;
+static void GLAD_API_PTR glad_on_demand_impl_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar * name) {
+    PFNGLBINDFRAGDATALOCATIONINDEXEDPROC proc = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC) glad_gl_on_demand_loader("glBindFragDataLocationIndexed");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBindFragDataLocationIndexed, proc);
+    proc(program, colorNumber, index, name);
+}
+PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed = glad_on_demand_impl_glBindFragDataLocationIndexed;
+static void GLAD_API_PTR glad_on_demand_impl_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    PFNGLBINDFRAMEBUFFERPROC proc = (PFNGLBINDFRAMEBUFFERPROC) glad_gl_on_demand_loader("glBindFramebuffer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBindFramebuffer, proc);
+    proc(target, framebuffer);
+}
+PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer = glad_on_demand_impl_glBindFramebuffer;
+static void GLAD_API_PTR glad_on_demand_impl_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+    PFNGLBINDIMAGETEXTUREPROC proc = (PFNGLBINDIMAGETEXTUREPROC) glad_gl_on_demand_loader("glBindImageTexture");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBindImageTexture, proc);
+    proc(unit, texture, level, layered, layer, access, format);
+}
+PFNGLBINDIMAGETEXTUREPROC glad_glBindImageTexture = glad_on_demand_impl_glBindImageTexture;
+static void GLAD_API_PTR glad_on_demand_impl_glBindProgramPipeline(GLuint pipeline) {
+    PFNGLBINDPROGRAMPIPELINEPROC proc = (PFNGLBINDPROGRAMPIPELINEPROC) glad_gl_on_demand_loader("glBindProgramPipeline");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBindProgramPipeline, proc);
+    proc(pipeline);
+}
+PFNGLBINDPROGRAMPIPELINEPROC glad_glBindProgramPipeline = glad_on_demand_impl_glBindProgramPipeline;
+static void GLAD_API_PTR glad_on_demand_impl_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    PFNGLBINDRENDERBUFFERPROC proc = (PFNGLBINDRENDERBUFFERPROC) glad_gl_on_demand_loader("glBindRenderbuffer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBindRenderbuffer, proc);
+    proc(target, renderbuffer);
+}
+PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer = glad_on_demand_impl_glBindRenderbuffer;
+static void GLAD_API_PTR glad_on_demand_impl_glBindSampler(GLuint unit, GLuint sampler) {
+    PFNGLBINDSAMPLERPROC proc = (PFNGLBINDSAMPLERPROC) glad_gl_on_demand_loader("glBindSampler");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBindSampler, proc);
+    proc(unit, sampler);
+}
+PFNGLBINDSAMPLERPROC glad_glBindSampler = glad_on_demand_impl_glBindSampler;
+static void GLAD_API_PTR glad_on_demand_impl_glBindTexture(GLenum target, GLuint texture) {
+    PFNGLBINDTEXTUREPROC proc = (PFNGLBINDTEXTUREPROC) glad_gl_on_demand_loader("glBindTexture");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBindTexture, proc);
+    proc(target, texture);
+}
+PFNGLBINDTEXTUREPROC glad_glBindTexture = glad_on_demand_impl_glBindTexture;
+static void GLAD_API_PTR glad_on_demand_impl_glBindTextureUnit(GLuint unit, GLuint texture) {
+    PFNGLBINDTEXTUREUNITPROC proc = (PFNGLBINDTEXTUREUNITPROC) glad_gl_on_demand_loader("glBindTextureUnit");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBindTextureUnit, proc);
+    proc(unit, texture);
+}
+PFNGLBINDTEXTUREUNITPROC glad_glBindTextureUnit = glad_on_demand_impl_glBindTextureUnit;
+static void GLAD_API_PTR glad_on_demand_impl_glBindTransformFeedback(GLenum target, GLuint id) {
+    PFNGLBINDTRANSFORMFEEDBACKPROC proc = (PFNGLBINDTRANSFORMFEEDBACKPROC) glad_gl_on_demand_loader("glBindTransformFeedback");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBindTransformFeedback, proc);
+    proc(target, id);
+}
+PFNGLBINDTRANSFORMFEEDBACKPROC glad_glBindTransformFeedback = glad_on_demand_impl_glBindTransformFeedback;
+static void GLAD_API_PTR glad_on_demand_impl_glBindVertexArray(GLuint array) {
+    PFNGLBINDVERTEXARRAYPROC proc = (PFNGLBINDVERTEXARRAYPROC) glad_gl_on_demand_loader("glBindVertexArray");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBindVertexArray, proc);
+    proc(array);
+}
+PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray = glad_on_demand_impl_glBindVertexArray;
+static void GLAD_API_PTR glad_on_demand_impl_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    PFNGLBINDVERTEXBUFFERPROC proc = (PFNGLBINDVERTEXBUFFERPROC) glad_gl_on_demand_loader("glBindVertexBuffer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBindVertexBuffer, proc);
+    proc(bindingindex, buffer, offset, stride);
+}
+PFNGLBINDVERTEXBUFFERPROC glad_glBindVertexBuffer = glad_on_demand_impl_glBindVertexBuffer;
+static void GLAD_API_PTR glad_on_demand_impl_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    PFNGLBLENDCOLORPROC proc = (PFNGLBLENDCOLORPROC) glad_gl_on_demand_loader("glBlendColor");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBlendColor, proc);
+    proc(red, green, blue, alpha);
+}
+PFNGLBLENDCOLORPROC glad_glBlendColor = glad_on_demand_impl_glBlendColor;
+static void GLAD_API_PTR glad_on_demand_impl_glBlendEquation(GLenum mode) {
+    PFNGLBLENDEQUATIONPROC proc = (PFNGLBLENDEQUATIONPROC) glad_gl_on_demand_loader("glBlendEquation");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBlendEquation, proc);
+    proc(mode);
+}
+PFNGLBLENDEQUATIONPROC glad_glBlendEquation = glad_on_demand_impl_glBlendEquation;
+static void GLAD_API_PTR glad_on_demand_impl_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    PFNGLBLENDEQUATIONSEPARATEPROC proc = (PFNGLBLENDEQUATIONSEPARATEPROC) glad_gl_on_demand_loader("glBlendEquationSeparate");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBlendEquationSeparate, proc);
+    proc(modeRGB, modeAlpha);
+}
+PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate = glad_on_demand_impl_glBlendEquationSeparate;
+static void GLAD_API_PTR glad_on_demand_impl_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+    PFNGLBLENDEQUATIONSEPARATEIPROC proc = (PFNGLBLENDEQUATIONSEPARATEIPROC) glad_gl_on_demand_loader("glBlendEquationSeparatei");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBlendEquationSeparatei, proc);
+    proc(buf, modeRGB, modeAlpha);
+}
+PFNGLBLENDEQUATIONSEPARATEIPROC glad_glBlendEquationSeparatei = glad_on_demand_impl_glBlendEquationSeparatei;
+static void GLAD_API_PTR glad_on_demand_impl_glBlendEquationi(GLuint buf, GLenum mode) {
+    PFNGLBLENDEQUATIONIPROC proc = (PFNGLBLENDEQUATIONIPROC) glad_gl_on_demand_loader("glBlendEquationi");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBlendEquationi, proc);
+    proc(buf, mode);
+}
+PFNGLBLENDEQUATIONIPROC glad_glBlendEquationi = glad_on_demand_impl_glBlendEquationi;
+static void GLAD_API_PTR glad_on_demand_impl_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    PFNGLBLENDFUNCPROC proc = (PFNGLBLENDFUNCPROC) glad_gl_on_demand_loader("glBlendFunc");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBlendFunc, proc);
+    proc(sfactor, dfactor);
+}
+PFNGLBLENDFUNCPROC glad_glBlendFunc = glad_on_demand_impl_glBlendFunc;
+static void GLAD_API_PTR glad_on_demand_impl_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    PFNGLBLENDFUNCSEPARATEPROC proc = (PFNGLBLENDFUNCSEPARATEPROC) glad_gl_on_demand_loader("glBlendFuncSeparate");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBlendFuncSeparate, proc);
+    proc(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate = glad_on_demand_impl_glBlendFuncSeparate;
+static void GLAD_API_PTR glad_on_demand_impl_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    PFNGLBLENDFUNCSEPARATEIPROC proc = (PFNGLBLENDFUNCSEPARATEIPROC) glad_gl_on_demand_loader("glBlendFuncSeparatei");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBlendFuncSeparatei, proc);
+    proc(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+PFNGLBLENDFUNCSEPARATEIPROC glad_glBlendFuncSeparatei = glad_on_demand_impl_glBlendFuncSeparatei;
+static void GLAD_API_PTR glad_on_demand_impl_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+    PFNGLBLENDFUNCIPROC proc = (PFNGLBLENDFUNCIPROC) glad_gl_on_demand_loader("glBlendFunci");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBlendFunci, proc);
+    proc(buf, src, dst);
+}
+PFNGLBLENDFUNCIPROC glad_glBlendFunci = glad_on_demand_impl_glBlendFunci;
+static void GLAD_API_PTR glad_on_demand_impl_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    PFNGLBLITFRAMEBUFFERPROC proc = (PFNGLBLITFRAMEBUFFERPROC) glad_gl_on_demand_loader("glBlitFramebuffer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBlitFramebuffer, proc);
+    proc(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = glad_on_demand_impl_glBlitFramebuffer;
+static void GLAD_API_PTR glad_on_demand_impl_glBufferData(GLenum target, GLsizeiptr size, const void * data, GLenum usage) {
+    PFNGLBUFFERDATAPROC proc = (PFNGLBUFFERDATAPROC) glad_gl_on_demand_loader("glBufferData");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBufferData, proc);
+    proc(target, size, data, usage);
+}
+PFNGLBUFFERDATAPROC glad_glBufferData = glad_on_demand_impl_glBufferData;
+static void GLAD_API_PTR glad_on_demand_impl_glBufferStorage(GLenum target, GLsizeiptr size, const void * data, GLbitfield flags) {
+    PFNGLBUFFERSTORAGEPROC proc = (PFNGLBUFFERSTORAGEPROC) glad_gl_on_demand_loader("glBufferStorage");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBufferStorage, proc);
+    proc(target, size, data, flags);
+}
+PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = glad_on_demand_impl_glBufferStorage;
+static void GLAD_API_PTR glad_on_demand_impl_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void * data) {
+    PFNGLBUFFERSUBDATAPROC proc = (PFNGLBUFFERSUBDATAPROC) glad_gl_on_demand_loader("glBufferSubData");
+    GLAD_GL_ON_DEMAND_STORE(glad_glBufferSubData, proc);
+    proc(target, offset, size, data);
+}
+PFNGLBUFFERSUBDATAPROC glad_glBufferSubData = glad_on_demand_impl_glBufferSubData;
+static GLenum GLAD_API_PTR glad_on_demand_impl_glCheckFramebufferStatus(GLenum target) {
+    PFNGLCHECKFRAMEBUFFERSTATUSPROC proc = (PFNGLCHECKFRAMEBUFFERSTATUSPROC) glad_gl_on_demand_loader("glCheckFramebufferStatus");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCheckFramebufferStatus, proc);
+    return proc(target);
+}
+PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = glad_on_demand_impl_glCheckFramebufferStatus;
+static void GLAD_API_PTR glad_on_demand_impl_glClampColor(GLenum target, GLenum clamp) {
+    PFNGLCLAMPCOLORPROC proc = (PFNGLCLAMPCOLORPROC) glad_gl_on_demand_loader("glClampColor");
+    GLAD_GL_ON_DEMAND_STORE(glad_glClampColor, proc);
+    proc(target, clamp);
+}
+PFNGLCLAMPCOLORPROC glad_glClampColor = glad_on_demand_impl_glClampColor;
+static void GLAD_API_PTR glad_on_demand_impl_glClear(GLbitfield mask) {
+    PFNGLCLEARPROC proc = (PFNGLCLEARPROC) glad_gl_on_demand_loader("glClear");
+    GLAD_GL_ON_DEMAND_STORE(glad_glClear, proc);
+    proc(mask);
+}
+PFNGLCLEARPROC glad_glClear = glad_on_demand_impl_glClear;
+static void GLAD_API_PTR glad_on_demand_impl_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void * data) {
+    PFNGLCLEARBUFFERDATAPROC proc = (PFNGLCLEARBUFFERDATAPROC) glad_gl_on_demand_loader("glClearBufferData");
+    GLAD_GL_ON_DEMAND_STORE(glad_glClearBufferData, proc);
+    proc(target, internalformat, format, type, data);
+}
+PFNGLCLEARBUFFERDATAPROC glad_glClearBufferData = glad_on_demand_impl_glClearBufferData;
+static void GLAD_API_PTR glad_on_demand_impl_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void * data) {
+    PFNGLCLEARBUFFERSUBDATAPROC proc = (PFNGLCLEARBUFFERSUBDATAPROC) glad_gl_on_demand_loader("glClearBufferSubData");
+    GLAD_GL_ON_DEMAND_STORE(glad_glClearBufferSubData, proc);
+    proc(target, internalformat, offset, size, format, type, data);
+}
+PFNGLCLEARBUFFERSUBDATAPROC glad_glClearBufferSubData = glad_on_demand_impl_glClearBufferSubData;
+static void GLAD_API_PTR glad_on_demand_impl_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    PFNGLCLEARBUFFERFIPROC proc = (PFNGLCLEARBUFFERFIPROC) glad_gl_on_demand_loader("glClearBufferfi");
+    GLAD_GL_ON_DEMAND_STORE(glad_glClearBufferfi, proc);
+    proc(buffer, drawbuffer, depth, stencil);
+}
+PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi = glad_on_demand_impl_glClearBufferfi;
+static void GLAD_API_PTR glad_on_demand_impl_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat * value) {
+    PFNGLCLEARBUFFERFVPROC proc = (PFNGLCLEARBUFFERFVPROC) glad_gl_on_demand_loader("glClearBufferfv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glClearBufferfv, proc);
+    proc(buffer, drawbuffer, value);
+}
+PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv = glad_on_demand_impl_glClearBufferfv;
+static void GLAD_API_PTR glad_on_demand_impl_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint * value) {
+    PFNGLCLEARBUFFERIVPROC proc = (PFNGLCLEARBUFFERIVPROC) glad_gl_on_demand_loader("glClearBufferiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glClearBufferiv, proc);
+    proc(buffer, drawbuffer, value);
+}
+PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv = glad_on_demand_impl_glClearBufferiv;
+static void GLAD_API_PTR glad_on_demand_impl_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint * value) {
+    PFNGLCLEARBUFFERUIVPROC proc = (PFNGLCLEARBUFFERUIVPROC) glad_gl_on_demand_loader("glClearBufferuiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glClearBufferuiv, proc);
+    proc(buffer, drawbuffer, value);
+}
+PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv = glad_on_demand_impl_glClearBufferuiv;
+static void GLAD_API_PTR glad_on_demand_impl_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    PFNGLCLEARCOLORPROC proc = (PFNGLCLEARCOLORPROC) glad_gl_on_demand_loader("glClearColor");
+    GLAD_GL_ON_DEMAND_STORE(glad_glClearColor, proc);
+    proc(red, green, blue, alpha);
+}
+PFNGLCLEARCOLORPROC glad_glClearColor = glad_on_demand_impl_glClearColor;
+static void GLAD_API_PTR glad_on_demand_impl_glClearDepth(GLdouble depth) {
+    PFNGLCLEARDEPTHPROC proc = (PFNGLCLEARDEPTHPROC) glad_gl_on_demand_loader("glClearDepth");
+    GLAD_GL_ON_DEMAND_STORE(glad_glClearDepth, proc);
+    proc(depth);
+}
+PFNGLCLEARDEPTHPROC glad_glClearDepth = glad_on_demand_impl_glClearDepth;
+static void GLAD_API_PTR glad_on_demand_impl_glClearDepthf(GLfloat d) {
+    PFNGLCLEARDEPTHFPROC proc = (PFNGLCLEARDEPTHFPROC) glad_gl_on_demand_loader("glClearDepthf");
+    GLAD_GL_ON_DEMAND_STORE(glad_glClearDepthf, proc);
+    proc(d);
+}
+PFNGLCLEARDEPTHFPROC glad_glClearDepthf = glad_on_demand_impl_glClearDepthf;
+static void GLAD_API_PTR glad_on_demand_impl_glClearStencil(GLint s) {
+    PFNGLCLEARSTENCILPROC proc = (PFNGLCLEARSTENCILPROC) glad_gl_on_demand_loader("glClearStencil");
+    GLAD_GL_ON_DEMAND_STORE(glad_glClearStencil, proc);
+    proc(s);
+}
+PFNGLCLEARSTENCILPROC glad_glClearStencil = glad_on_demand_impl_glClearStencil;
+static GLenum GLAD_API_PTR glad_on_demand_impl_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    PFNGLCLIENTWAITSYNCPROC proc = (PFNGLCLIENTWAITSYNCPROC) glad_gl_on_demand_loader("glClientWaitSync");
+    GLAD_GL_ON_DEMAND_STORE(glad_glClientWaitSync, proc);
+    return proc(sync, flags, timeout);
+}
+PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync = glad_on_demand_impl_glClientWaitSync;
+static void GLAD_API_PTR glad_on_demand_impl_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    PFNGLCOLORMASKPROC proc = (PFNGLCOLORMASKPROC) glad_gl_on_demand_loader("glColorMask");
+    GLAD_GL_ON_DEMAND_STORE(glad_glColorMask, proc);
+    proc(red, green, blue, alpha);
+}
+PFNGLCOLORMASKPROC glad_glColorMask = glad_on_demand_impl_glColorMask;
+static void GLAD_API_PTR glad_on_demand_impl_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    PFNGLCOLORMASKIPROC proc = (PFNGLCOLORMASKIPROC) glad_gl_on_demand_loader("glColorMaski");
+    GLAD_GL_ON_DEMAND_STORE(glad_glColorMaski, proc);
+    proc(index, r, g, b, a);
+}
+PFNGLCOLORMASKIPROC glad_glColorMaski = glad_on_demand_impl_glColorMaski;
+static void GLAD_API_PTR glad_on_demand_impl_glCompileShader(GLuint shader) {
+    PFNGLCOMPILESHADERPROC proc = (PFNGLCOMPILESHADERPROC) glad_gl_on_demand_loader("glCompileShader");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCompileShader, proc);
+    proc(shader);
+}
+PFNGLCOMPILESHADERPROC glad_glCompileShader = glad_on_demand_impl_glCompileShader;
+static void GLAD_API_PTR glad_on_demand_impl_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void * data) {
+    PFNGLCOMPRESSEDTEXIMAGE1DPROC proc = (PFNGLCOMPRESSEDTEXIMAGE1DPROC) glad_gl_on_demand_loader("glCompressedTexImage1D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCompressedTexImage1D, proc);
+    proc(target, level, internalformat, width, border, imageSize, data);
+}
+PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D = glad_on_demand_impl_glCompressedTexImage1D;
+static void GLAD_API_PTR glad_on_demand_impl_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void * data) {
+    PFNGLCOMPRESSEDTEXIMAGE2DPROC proc = (PFNGLCOMPRESSEDTEXIMAGE2DPROC) glad_gl_on_demand_loader("glCompressedTexImage2D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCompressedTexImage2D, proc);
+    proc(target, level, internalformat, width, height, border, imageSize, data);
+}
+PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D = glad_on_demand_impl_glCompressedTexImage2D;
+static void GLAD_API_PTR glad_on_demand_impl_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void * data) {
+    PFNGLCOMPRESSEDTEXIMAGE3DPROC proc = (PFNGLCOMPRESSEDTEXIMAGE3DPROC) glad_gl_on_demand_loader("glCompressedTexImage3D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCompressedTexImage3D, proc);
+    proc(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D = glad_on_demand_impl_glCompressedTexImage3D;
+static void GLAD_API_PTR glad_on_demand_impl_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * data) {
+    PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC proc = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC) glad_gl_on_demand_loader("glCompressedTexSubImage1D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCompressedTexSubImage1D, proc);
+    proc(target, level, xoffset, width, format, imageSize, data);
+}
+PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D = glad_on_demand_impl_glCompressedTexSubImage1D;
+static void GLAD_API_PTR glad_on_demand_impl_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * data) {
+    PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC proc = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC) glad_gl_on_demand_loader("glCompressedTexSubImage2D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCompressedTexSubImage2D, proc);
+    proc(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D = glad_on_demand_impl_glCompressedTexSubImage2D;
+static void GLAD_API_PTR glad_on_demand_impl_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * data) {
+    PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC proc = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC) glad_gl_on_demand_loader("glCompressedTexSubImage3D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCompressedTexSubImage3D, proc);
+    proc(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D = glad_on_demand_impl_glCompressedTexSubImage3D;
+static void GLAD_API_PTR glad_on_demand_impl_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    PFNGLCOPYBUFFERSUBDATAPROC proc = (PFNGLCOPYBUFFERSUBDATAPROC) glad_gl_on_demand_loader("glCopyBufferSubData");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCopyBufferSubData, proc);
+    proc(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData = glad_on_demand_impl_glCopyBufferSubData;
+static void GLAD_API_PTR glad_on_demand_impl_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+    PFNGLCOPYIMAGESUBDATAPROC proc = (PFNGLCOPYIMAGESUBDATAPROC) glad_gl_on_demand_loader("glCopyImageSubData");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCopyImageSubData, proc);
+    proc(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+PFNGLCOPYIMAGESUBDATAPROC glad_glCopyImageSubData = glad_on_demand_impl_glCopyImageSubData;
+static void GLAD_API_PTR glad_on_demand_impl_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+    PFNGLCOPYTEXIMAGE1DPROC proc = (PFNGLCOPYTEXIMAGE1DPROC) glad_gl_on_demand_loader("glCopyTexImage1D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCopyTexImage1D, proc);
+    proc(target, level, internalformat, x, y, width, border);
+}
+PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D = glad_on_demand_impl_glCopyTexImage1D;
+static void GLAD_API_PTR glad_on_demand_impl_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    PFNGLCOPYTEXIMAGE2DPROC proc = (PFNGLCOPYTEXIMAGE2DPROC) glad_gl_on_demand_loader("glCopyTexImage2D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCopyTexImage2D, proc);
+    proc(target, level, internalformat, x, y, width, height, border);
+}
+PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D = glad_on_demand_impl_glCopyTexImage2D;
+static void GLAD_API_PTR glad_on_demand_impl_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    PFNGLCOPYTEXSUBIMAGE1DPROC proc = (PFNGLCOPYTEXSUBIMAGE1DPROC) glad_gl_on_demand_loader("glCopyTexSubImage1D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCopyTexSubImage1D, proc);
+    proc(target, level, xoffset, x, y, width);
+}
+PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D = glad_on_demand_impl_glCopyTexSubImage1D;
+static void GLAD_API_PTR glad_on_demand_impl_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    PFNGLCOPYTEXSUBIMAGE2DPROC proc = (PFNGLCOPYTEXSUBIMAGE2DPROC) glad_gl_on_demand_loader("glCopyTexSubImage2D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCopyTexSubImage2D, proc);
+    proc(target, level, xoffset, yoffset, x, y, width, height);
+}
+PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D = glad_on_demand_impl_glCopyTexSubImage2D;
+static void GLAD_API_PTR glad_on_demand_impl_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    PFNGLCOPYTEXSUBIMAGE3DPROC proc = (PFNGLCOPYTEXSUBIMAGE3DPROC) glad_gl_on_demand_loader("glCopyTexSubImage3D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCopyTexSubImage3D, proc);
+    proc(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D = glad_on_demand_impl_glCopyTexSubImage3D;
+static void GLAD_API_PTR glad_on_demand_impl_glCreateBuffers(GLsizei n, GLuint * buffers) {
+    PFNGLCREATEBUFFERSPROC proc = (PFNGLCREATEBUFFERSPROC) glad_gl_on_demand_loader("glCreateBuffers");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCreateBuffers, proc);
+    proc(n, buffers);
+}
+PFNGLCREATEBUFFERSPROC glad_glCreateBuffers = glad_on_demand_impl_glCreateBuffers;
+static GLuint GLAD_API_PTR glad_on_demand_impl_glCreateProgram(void) {
+    PFNGLCREATEPROGRAMPROC proc = (PFNGLCREATEPROGRAMPROC) glad_gl_on_demand_loader("glCreateProgram");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCreateProgram, proc);
+    return proc();
+}
+PFNGLCREATEPROGRAMPROC glad_glCreateProgram = glad_on_demand_impl_glCreateProgram;
+static GLuint GLAD_API_PTR glad_on_demand_impl_glCreateShader(GLenum type) {
+    PFNGLCREATESHADERPROC proc = (PFNGLCREATESHADERPROC) glad_gl_on_demand_loader("glCreateShader");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCreateShader, proc);
+    return proc(type);
+}
+PFNGLCREATESHADERPROC glad_glCreateShader = glad_on_demand_impl_glCreateShader;
+static GLuint GLAD_API_PTR glad_on_demand_impl_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const* strings) {
+    PFNGLCREATESHADERPROGRAMVPROC proc = (PFNGLCREATESHADERPROGRAMVPROC) glad_gl_on_demand_loader("glCreateShaderProgramv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCreateShaderProgramv, proc);
+    return proc(type, count, strings);
+}
+PFNGLCREATESHADERPROGRAMVPROC glad_glCreateShaderProgramv = glad_on_demand_impl_glCreateShaderProgramv;
+static void GLAD_API_PTR glad_on_demand_impl_glCreateTextures(GLenum target, GLsizei n, GLuint * textures) {
+    PFNGLCREATETEXTURESPROC proc = (PFNGLCREATETEXTURESPROC) glad_gl_on_demand_loader("glCreateTextures");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCreateTextures, proc);
+    proc(target, n, textures);
+}
+PFNGLCREATETEXTURESPROC glad_glCreateTextures = glad_on_demand_impl_glCreateTextures;
+static void GLAD_API_PTR glad_on_demand_impl_glCreateVertexArrays(GLsizei n, GLuint * arrays) {
+    PFNGLCREATEVERTEXARRAYSPROC proc = (PFNGLCREATEVERTEXARRAYSPROC) glad_gl_on_demand_loader("glCreateVertexArrays");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCreateVertexArrays, proc);
+    proc(n, arrays);
+}
+PFNGLCREATEVERTEXARRAYSPROC glad_glCreateVertexArrays = glad_on_demand_impl_glCreateVertexArrays;
+static void GLAD_API_PTR glad_on_demand_impl_glCullFace(GLenum mode) {
+    PFNGLCULLFACEPROC proc = (PFNGLCULLFACEPROC) glad_gl_on_demand_loader("glCullFace");
+    GLAD_GL_ON_DEMAND_STORE(glad_glCullFace, proc);
+    proc(mode);
+}
+PFNGLCULLFACEPROC glad_glCullFace = glad_on_demand_impl_glCullFace;
+static void GLAD_API_PTR glad_on_demand_impl_glDebugMessageCallback(GLDEBUGPROC callback, const void * userParam) {
+    PFNGLDEBUGMESSAGECALLBACKPROC proc = (PFNGLDEBUGMESSAGECALLBACKPROC) glad_gl_on_demand_loader("glDebugMessageCallback");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDebugMessageCallback, proc);
+    proc(callback, userParam);
+}
+PFNGLDEBUGMESSAGECALLBACKPROC glad_glDebugMessageCallback = glad_on_demand_impl_glDebugMessageCallback;
+static void GLAD_API_PTR glad_on_demand_impl_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint * ids, GLboolean enabled) {
+    PFNGLDEBUGMESSAGECONTROLPROC proc = (PFNGLDEBUGMESSAGECONTROLPROC) glad_gl_on_demand_loader("glDebugMessageControl");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDebugMessageControl, proc);
+    proc(source, type, severity, count, ids, enabled);
+}
+PFNGLDEBUGMESSAGECONTROLPROC glad_glDebugMessageControl = glad_on_demand_impl_glDebugMessageControl;
+static void GLAD_API_PTR glad_on_demand_impl_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * buf) {
+    PFNGLDEBUGMESSAGEINSERTPROC proc = (PFNGLDEBUGMESSAGEINSERTPROC) glad_gl_on_demand_loader("glDebugMessageInsert");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDebugMessageInsert, proc);
+    proc(source, type, id, severity, length, buf);
+}
+PFNGLDEBUGMESSAGEINSERTPROC glad_glDebugMessageInsert = glad_on_demand_impl_glDebugMessageInsert;
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteBuffers(GLsizei n, const GLuint * buffers) {
+    PFNGLDELETEBUFFERSPROC proc = (PFNGLDELETEBUFFERSPROC) glad_gl_on_demand_loader("glDeleteBuffers");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDeleteBuffers, proc);
+    proc(n, buffers);
+}
+PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers = glad_on_demand_impl_glDeleteBuffers;
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteFramebuffers(GLsizei n, const GLuint * framebuffers) {
+    PFNGLDELETEFRAMEBUFFERSPROC proc = (PFNGLDELETEFRAMEBUFFERSPROC) glad_gl_on_demand_loader("glDeleteFramebuffers");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDeleteFramebuffers, proc);
+    proc(n, framebuffers);
+}
+PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers = glad_on_demand_impl_glDeleteFramebuffers;
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteProgram(GLuint program) {
+    PFNGLDELETEPROGRAMPROC proc = (PFNGLDELETEPROGRAMPROC) glad_gl_on_demand_loader("glDeleteProgram");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDeleteProgram, proc);
+    proc(program);
+}
+PFNGLDELETEPROGRAMPROC glad_glDeleteProgram = glad_on_demand_impl_glDeleteProgram;
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteProgramPipelines(GLsizei n, const GLuint * pipelines) {
+    PFNGLDELETEPROGRAMPIPELINESPROC proc = (PFNGLDELETEPROGRAMPIPELINESPROC) glad_gl_on_demand_loader("glDeleteProgramPipelines");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDeleteProgramPipelines, proc);
+    proc(n, pipelines);
+}
+PFNGLDELETEPROGRAMPIPELINESPROC glad_glDeleteProgramPipelines = glad_on_demand_impl_glDeleteProgramPipelines;
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteQueries(GLsizei n, const GLuint * ids) {
+    PFNGLDELETEQUERIESPROC proc = (PFNGLDELETEQUERIESPROC) glad_gl_on_demand_loader("glDeleteQueries");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDeleteQueries, proc);
+    proc(n, ids);
+}
+PFNGLDELETEQUERIESPROC glad_glDeleteQueries = glad_on_demand_impl_glDeleteQueries;
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteRenderbuffers(GLsizei n, const GLuint * renderbuffers) {
+    PFNGLDELETERENDERBUFFERSPROC proc = (PFNGLDELETERENDERBUFFERSPROC) glad_gl_on_demand_loader("glDeleteRenderbuffers");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDeleteRenderbuffers, proc);
+    proc(n, renderbuffers);
+}
+PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers = glad_on_demand_impl_glDeleteRenderbuffers;
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteSamplers(GLsizei count, const GLuint * samplers) {
+    PFNGLDELETESAMPLERSPROC proc = (PFNGLDELETESAMPLERSPROC) glad_gl_on_demand_loader("glDeleteSamplers");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDeleteSamplers, proc);
+    proc(count, samplers);
+}
+PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers = glad_on_demand_impl_glDeleteSamplers;
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteShader(GLuint shader) {
+    PFNGLDELETESHADERPROC proc = (PFNGLDELETESHADERPROC) glad_gl_on_demand_loader("glDeleteShader");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDeleteShader, proc);
+    proc(shader);
+}
+PFNGLDELETESHADERPROC glad_glDeleteShader = glad_on_demand_impl_glDeleteShader;
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteSync(GLsync sync) {
+    PFNGLDELETESYNCPROC proc = (PFNGLDELETESYNCPROC) glad_gl_on_demand_loader("glDeleteSync");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDeleteSync, proc);
+    proc(sync);
+}
+PFNGLDELETESYNCPROC glad_glDeleteSync = glad_on_demand_impl_glDeleteSync;
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteTextures(GLsizei n, const GLuint * textures) {
+    PFNGLDELETETEXTURESPROC proc = (PFNGLDELETETEXTURESPROC) glad_gl_on_demand_loader("glDeleteTextures");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDeleteTextures, proc);
+    proc(n, textures);
+}
+PFNGLDELETETEXTURESPROC glad_glDeleteTextures = glad_on_demand_impl_glDeleteTextures;
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteTransformFeedbacks(GLsizei n, const GLuint * ids) {
+    PFNGLDELETETRANSFORMFEEDBACKSPROC proc = (PFNGLDELETETRANSFORMFEEDBACKSPROC) glad_gl_on_demand_loader("glDeleteTransformFeedbacks");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDeleteTransformFeedbacks, proc);
+    proc(n, ids);
+}
+PFNGLDELETETRANSFORMFEEDBACKSPROC glad_glDeleteTransformFeedbacks = glad_on_demand_impl_glDeleteTransformFeedbacks;
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteVertexArrays(GLsizei n, const GLuint * arrays) {
+    PFNGLDELETEVERTEXARRAYSPROC proc = (PFNGLDELETEVERTEXARRAYSPROC) glad_gl_on_demand_loader("glDeleteVertexArrays");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDeleteVertexArrays, proc);
+    proc(n, arrays);
+}
+PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays = glad_on_demand_impl_glDeleteVertexArrays;
+static void GLAD_API_PTR glad_on_demand_impl_glDepthFunc(GLenum func) {
+    PFNGLDEPTHFUNCPROC proc = (PFNGLDEPTHFUNCPROC) glad_gl_on_demand_loader("glDepthFunc");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDepthFunc, proc);
+    proc(func);
+}
+PFNGLDEPTHFUNCPROC glad_glDepthFunc = glad_on_demand_impl_glDepthFunc;
+static void GLAD_API_PTR glad_on_demand_impl_glDepthMask(GLboolean flag) {
+    PFNGLDEPTHMASKPROC proc = (PFNGLDEPTHMASKPROC) glad_gl_on_demand_loader("glDepthMask");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDepthMask, proc);
+    proc(flag);
+}
+PFNGLDEPTHMASKPROC glad_glDepthMask = glad_on_demand_impl_glDepthMask;
+static void GLAD_API_PTR glad_on_demand_impl_glDepthRange(GLdouble n, GLdouble f) {
+    PFNGLDEPTHRANGEPROC proc = (PFNGLDEPTHRANGEPROC) glad_gl_on_demand_loader("glDepthRange");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDepthRange, proc);
+    proc(n, f);
+}
+PFNGLDEPTHRANGEPROC glad_glDepthRange = glad_on_demand_impl_glDepthRange;
+static void GLAD_API_PTR glad_on_demand_impl_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble * v) {
+    PFNGLDEPTHRANGEARRAYVPROC proc = (PFNGLDEPTHRANGEARRAYVPROC) glad_gl_on_demand_loader("glDepthRangeArrayv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDepthRangeArrayv, proc);
+    proc(first, count, v);
+}
+PFNGLDEPTHRANGEARRAYVPROC glad_glDepthRangeArrayv = glad_on_demand_impl_glDepthRangeArrayv;
+static void GLAD_API_PTR glad_on_demand_impl_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+    PFNGLDEPTHRANGEINDEXEDPROC proc = (PFNGLDEPTHRANGEINDEXEDPROC) glad_gl_on_demand_loader("glDepthRangeIndexed");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDepthRangeIndexed, proc);
+    proc(index, n, f);
+}
+PFNGLDEPTHRANGEINDEXEDPROC glad_glDepthRangeIndexed = glad_on_demand_impl_glDepthRangeIndexed;
+static void GLAD_API_PTR glad_on_demand_impl_glDepthRangef(GLfloat n, GLfloat f) {
+    PFNGLDEPTHRANGEFPROC proc = (PFNGLDEPTHRANGEFPROC) glad_gl_on_demand_loader("glDepthRangef");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDepthRangef, proc);
+    proc(n, f);
+}
+PFNGLDEPTHRANGEFPROC glad_glDepthRangef = glad_on_demand_impl_glDepthRangef;
+static void GLAD_API_PTR glad_on_demand_impl_glDetachShader(GLuint program, GLuint shader) {
+    PFNGLDETACHSHADERPROC proc = (PFNGLDETACHSHADERPROC) glad_gl_on_demand_loader("glDetachShader");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDetachShader, proc);
+    proc(program, shader);
+}
+PFNGLDETACHSHADERPROC glad_glDetachShader = glad_on_demand_impl_glDetachShader;
+static void GLAD_API_PTR glad_on_demand_impl_glDisable(GLenum cap) {
+    PFNGLDISABLEPROC proc = (PFNGLDISABLEPROC) glad_gl_on_demand_loader("glDisable");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDisable, proc);
+    proc(cap);
+}
+PFNGLDISABLEPROC glad_glDisable = glad_on_demand_impl_glDisable;
+static void GLAD_API_PTR glad_on_demand_impl_glDisableVertexAttribArray(GLuint index) {
+    PFNGLDISABLEVERTEXATTRIBARRAYPROC proc = (PFNGLDISABLEVERTEXATTRIBARRAYPROC) glad_gl_on_demand_loader("glDisableVertexAttribArray");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDisableVertexAttribArray, proc);
+    proc(index);
+}
+PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray = glad_on_demand_impl_glDisableVertexAttribArray;
+static void GLAD_API_PTR glad_on_demand_impl_glDisablei(GLenum target, GLuint index) {
+    PFNGLDISABLEIPROC proc = (PFNGLDISABLEIPROC) glad_gl_on_demand_loader("glDisablei");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDisablei, proc);
+    proc(target, index);
+}
+PFNGLDISABLEIPROC glad_glDisablei = glad_on_demand_impl_glDisablei;
+static void GLAD_API_PTR glad_on_demand_impl_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+    PFNGLDISPATCHCOMPUTEPROC proc = (PFNGLDISPATCHCOMPUTEPROC) glad_gl_on_demand_loader("glDispatchCompute");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDispatchCompute, proc);
+    proc(num_groups_x, num_groups_y, num_groups_z);
+}
+PFNGLDISPATCHCOMPUTEPROC glad_glDispatchCompute = glad_on_demand_impl_glDispatchCompute;
+static void GLAD_API_PTR glad_on_demand_impl_glDispatchComputeIndirect(GLintptr indirect) {
+    PFNGLDISPATCHCOMPUTEINDIRECTPROC proc = (PFNGLDISPATCHCOMPUTEINDIRECTPROC) glad_gl_on_demand_loader("glDispatchComputeIndirect");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDispatchComputeIndirect, proc);
+    proc(indirect);
+}
+PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_glDispatchComputeIndirect = glad_on_demand_impl_glDispatchComputeIndirect;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    PFNGLDRAWARRAYSPROC proc = (PFNGLDRAWARRAYSPROC) glad_gl_on_demand_loader("glDrawArrays");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawArrays, proc);
+    proc(mode, first, count);
+}
+PFNGLDRAWARRAYSPROC glad_glDrawArrays = glad_on_demand_impl_glDrawArrays;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawArraysIndirect(GLenum mode, const void * indirect) {
+    PFNGLDRAWARRAYSINDIRECTPROC proc = (PFNGLDRAWARRAYSINDIRECTPROC) glad_gl_on_demand_loader("glDrawArraysIndirect");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawArraysIndirect, proc);
+    proc(mode, indirect);
+}
+PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect = glad_on_demand_impl_glDrawArraysIndirect;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    PFNGLDRAWARRAYSINSTANCEDPROC proc = (PFNGLDRAWARRAYSINSTANCEDPROC) glad_gl_on_demand_loader("glDrawArraysInstanced");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawArraysInstanced, proc);
+    proc(mode, first, count, instancecount);
+}
+PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced = glad_on_demand_impl_glDrawArraysInstanced;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+    PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC proc = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC) glad_gl_on_demand_loader("glDrawArraysInstancedBaseInstance");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawArraysInstancedBaseInstance, proc);
+    proc(mode, first, count, instancecount, baseinstance);
+}
+PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_glDrawArraysInstancedBaseInstance = glad_on_demand_impl_glDrawArraysInstancedBaseInstance;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawBuffer(GLenum buf) {
+    PFNGLDRAWBUFFERPROC proc = (PFNGLDRAWBUFFERPROC) glad_gl_on_demand_loader("glDrawBuffer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawBuffer, proc);
+    proc(buf);
+}
+PFNGLDRAWBUFFERPROC glad_glDrawBuffer = glad_on_demand_impl_glDrawBuffer;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawBuffers(GLsizei n, const GLenum * bufs) {
+    PFNGLDRAWBUFFERSPROC proc = (PFNGLDRAWBUFFERSPROC) glad_gl_on_demand_loader("glDrawBuffers");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawBuffers, proc);
+    proc(n, bufs);
+}
+PFNGLDRAWBUFFERSPROC glad_glDrawBuffers = glad_on_demand_impl_glDrawBuffers;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void * indices) {
+    PFNGLDRAWELEMENTSPROC proc = (PFNGLDRAWELEMENTSPROC) glad_gl_on_demand_loader("glDrawElements");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawElements, proc);
+    proc(mode, count, type, indices);
+}
+PFNGLDRAWELEMENTSPROC glad_glDrawElements = glad_on_demand_impl_glDrawElements;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLint basevertex) {
+    PFNGLDRAWELEMENTSBASEVERTEXPROC proc = (PFNGLDRAWELEMENTSBASEVERTEXPROC) glad_gl_on_demand_loader("glDrawElementsBaseVertex");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawElementsBaseVertex, proc);
+    proc(mode, count, type, indices, basevertex);
+}
+PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex = glad_on_demand_impl_glDrawElementsBaseVertex;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawElementsIndirect(GLenum mode, GLenum type, const void * indirect) {
+    PFNGLDRAWELEMENTSINDIRECTPROC proc = (PFNGLDRAWELEMENTSINDIRECTPROC) glad_gl_on_demand_loader("glDrawElementsIndirect");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawElementsIndirect, proc);
+    proc(mode, type, indirect);
+}
+PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect = glad_on_demand_impl_glDrawElementsIndirect;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount) {
+    PFNGLDRAWELEMENTSINSTANCEDPROC proc = (PFNGLDRAWELEMENTSINSTANCEDPROC) glad_gl_on_demand_loader("glDrawElementsInstanced");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawElementsInstanced, proc);
+    proc(mode, count, type, indices, instancecount);
+}
+PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced = glad_on_demand_impl_glDrawElementsInstanced;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLuint baseinstance) {
+    PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC proc = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC) glad_gl_on_demand_loader("glDrawElementsInstancedBaseInstance");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawElementsInstancedBaseInstance, proc);
+    proc(mode, count, type, indices, instancecount, baseinstance);
+}
+PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_glDrawElementsInstancedBaseInstance = glad_on_demand_impl_glDrawElementsInstancedBaseInstance;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex) {
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC proc = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC) glad_gl_on_demand_loader("glDrawElementsInstancedBaseVertex");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawElementsInstancedBaseVertex, proc);
+    proc(mode, count, type, indices, instancecount, basevertex);
+}
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex = glad_on_demand_impl_glDrawElementsInstancedBaseVertex;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC proc = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC) glad_gl_on_demand_loader("glDrawElementsInstancedBaseVertexBaseInstance");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawElementsInstancedBaseVertexBaseInstance, proc);
+    proc(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_on_demand_impl_glDrawElementsInstancedBaseVertexBaseInstance;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices) {
+    PFNGLDRAWRANGEELEMENTSPROC proc = (PFNGLDRAWRANGEELEMENTSPROC) glad_gl_on_demand_loader("glDrawRangeElements");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawRangeElements, proc);
+    proc(mode, start, end, count, type, indices);
+}
+PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements = glad_on_demand_impl_glDrawRangeElements;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices, GLint basevertex) {
+    PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC proc = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC) glad_gl_on_demand_loader("glDrawRangeElementsBaseVertex");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawRangeElementsBaseVertex, proc);
+    proc(mode, start, end, count, type, indices, basevertex);
+}
+PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex = glad_on_demand_impl_glDrawRangeElementsBaseVertex;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawTransformFeedback(GLenum mode, GLuint id) {
+    PFNGLDRAWTRANSFORMFEEDBACKPROC proc = (PFNGLDRAWTRANSFORMFEEDBACKPROC) glad_gl_on_demand_loader("glDrawTransformFeedback");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawTransformFeedback, proc);
+    proc(mode, id);
+}
+PFNGLDRAWTRANSFORMFEEDBACKPROC glad_glDrawTransformFeedback = glad_on_demand_impl_glDrawTransformFeedback;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+    PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC proc = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC) glad_gl_on_demand_loader("glDrawTransformFeedbackInstanced");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawTransformFeedbackInstanced, proc);
+    proc(mode, id, instancecount);
+}
+PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_glDrawTransformFeedbackInstanced = glad_on_demand_impl_glDrawTransformFeedbackInstanced;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+    PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC proc = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC) glad_gl_on_demand_loader("glDrawTransformFeedbackStream");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawTransformFeedbackStream, proc);
+    proc(mode, id, stream);
+}
+PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_glDrawTransformFeedbackStream = glad_on_demand_impl_glDrawTransformFeedbackStream;
+static void GLAD_API_PTR glad_on_demand_impl_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+    PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC proc = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC) glad_gl_on_demand_loader("glDrawTransformFeedbackStreamInstanced");
+    GLAD_GL_ON_DEMAND_STORE(glad_glDrawTransformFeedbackStreamInstanced, proc);
+    proc(mode, id, stream, instancecount);
+}
+PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_glDrawTransformFeedbackStreamInstanced = glad_on_demand_impl_glDrawTransformFeedbackStreamInstanced;
+static void GLAD_API_PTR glad_on_demand_impl_glEnable(GLenum cap) {
+    PFNGLENABLEPROC proc = (PFNGLENABLEPROC) glad_gl_on_demand_loader("glEnable");
+    GLAD_GL_ON_DEMAND_STORE(glad_glEnable, proc);
+    proc(cap);
+}
+PFNGLENABLEPROC glad_glEnable = glad_on_demand_impl_glEnable;
+static void GLAD_API_PTR glad_on_demand_impl_glEnableVertexAttribArray(GLuint index) {
+    PFNGLENABLEVERTEXATTRIBARRAYPROC proc = (PFNGLENABLEVERTEXATTRIBARRAYPROC) glad_gl_on_demand_loader("glEnableVertexAttribArray");
+    GLAD_GL_ON_DEMAND_STORE(glad_glEnableVertexAttribArray, proc);
+    proc(index);
+}
+PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray = glad_on_demand_impl_glEnableVertexAttribArray;
+static void GLAD_API_PTR glad_on_demand_impl_glEnablei(GLenum target, GLuint index) {
+    PFNGLENABLEIPROC proc = (PFNGLENABLEIPROC) glad_gl_on_demand_loader("glEnablei");
+    GLAD_GL_ON_DEMAND_STORE(glad_glEnablei, proc);
+    proc(target, index);
+}
+PFNGLENABLEIPROC glad_glEnablei = glad_on_demand_impl_glEnablei;
+static void GLAD_API_PTR glad_on_demand_impl_glEndConditionalRender(void) {
+    PFNGLENDCONDITIONALRENDERPROC proc = (PFNGLENDCONDITIONALRENDERPROC) glad_gl_on_demand_loader("glEndConditionalRender");
+    GLAD_GL_ON_DEMAND_STORE(glad_glEndConditionalRender, proc);
+    proc();
+}
+PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender = glad_on_demand_impl_glEndConditionalRender;
+static void GLAD_API_PTR glad_on_demand_impl_glEndQuery(GLenum target) {
+    PFNGLENDQUERYPROC proc = (PFNGLENDQUERYPROC) glad_gl_on_demand_loader("glEndQuery");
+    GLAD_GL_ON_DEMAND_STORE(glad_glEndQuery, proc);
+    proc(target);
+}
+PFNGLENDQUERYPROC glad_glEndQuery = glad_on_demand_impl_glEndQuery;
+static void GLAD_API_PTR glad_on_demand_impl_glEndQueryIndexed(GLenum target, GLuint index) {
+    PFNGLENDQUERYINDEXEDPROC proc = (PFNGLENDQUERYINDEXEDPROC) glad_gl_on_demand_loader("glEndQueryIndexed");
+    GLAD_GL_ON_DEMAND_STORE(glad_glEndQueryIndexed, proc);
+    proc(target, index);
+}
+PFNGLENDQUERYINDEXEDPROC glad_glEndQueryIndexed = glad_on_demand_impl_glEndQueryIndexed;
+static void GLAD_API_PTR glad_on_demand_impl_glEndTransformFeedback(void) {
+    PFNGLENDTRANSFORMFEEDBACKPROC proc = (PFNGLENDTRANSFORMFEEDBACKPROC) glad_gl_on_demand_loader("glEndTransformFeedback");
+    GLAD_GL_ON_DEMAND_STORE(glad_glEndTransformFeedback, proc);
+    proc();
+}
+PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback = glad_on_demand_impl_glEndTransformFeedback;
+static GLsync GLAD_API_PTR glad_on_demand_impl_glFenceSync(GLenum condition, GLbitfield flags) {
+    PFNGLFENCESYNCPROC proc = (PFNGLFENCESYNCPROC) glad_gl_on_demand_loader("glFenceSync");
+    GLAD_GL_ON_DEMAND_STORE(glad_glFenceSync, proc);
+    return proc(condition, flags);
+}
+PFNGLFENCESYNCPROC glad_glFenceSync = glad_on_demand_impl_glFenceSync;
+static void GLAD_API_PTR glad_on_demand_impl_glFinish(void) {
+    PFNGLFINISHPROC proc = (PFNGLFINISHPROC) glad_gl_on_demand_loader("glFinish");
+    GLAD_GL_ON_DEMAND_STORE(glad_glFinish, proc);
+    proc();
+}
+PFNGLFINISHPROC glad_glFinish = glad_on_demand_impl_glFinish;
+static void GLAD_API_PTR glad_on_demand_impl_glFlush(void) {
+    PFNGLFLUSHPROC proc = (PFNGLFLUSHPROC) glad_gl_on_demand_loader("glFlush");
+    GLAD_GL_ON_DEMAND_STORE(glad_glFlush, proc);
+    proc();
+}
+PFNGLFLUSHPROC glad_glFlush = glad_on_demand_impl_glFlush;
+static void GLAD_API_PTR glad_on_demand_impl_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    PFNGLFLUSHMAPPEDBUFFERRANGEPROC proc = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC) glad_gl_on_demand_loader("glFlushMappedBufferRange");
+    GLAD_GL_ON_DEMAND_STORE(glad_glFlushMappedBufferRange, proc);
+    proc(target, offset, length);
+}
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange = glad_on_demand_impl_glFlushMappedBufferRange;
+static void GLAD_API_PTR glad_on_demand_impl_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+    PFNGLFRAMEBUFFERPARAMETERIPROC proc = (PFNGLFRAMEBUFFERPARAMETERIPROC) glad_gl_on_demand_loader("glFramebufferParameteri");
+    GLAD_GL_ON_DEMAND_STORE(glad_glFramebufferParameteri, proc);
+    proc(target, pname, param);
+}
+PFNGLFRAMEBUFFERPARAMETERIPROC glad_glFramebufferParameteri = glad_on_demand_impl_glFramebufferParameteri;
+static void GLAD_API_PTR glad_on_demand_impl_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    PFNGLFRAMEBUFFERRENDERBUFFERPROC proc = (PFNGLFRAMEBUFFERRENDERBUFFERPROC) glad_gl_on_demand_loader("glFramebufferRenderbuffer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glFramebufferRenderbuffer, proc);
+    proc(target, attachment, renderbuffertarget, renderbuffer);
+}
+PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer = glad_on_demand_impl_glFramebufferRenderbuffer;
+static void GLAD_API_PTR glad_on_demand_impl_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    PFNGLFRAMEBUFFERTEXTUREPROC proc = (PFNGLFRAMEBUFFERTEXTUREPROC) glad_gl_on_demand_loader("glFramebufferTexture");
+    GLAD_GL_ON_DEMAND_STORE(glad_glFramebufferTexture, proc);
+    proc(target, attachment, texture, level);
+}
+PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture = glad_on_demand_impl_glFramebufferTexture;
+static void GLAD_API_PTR glad_on_demand_impl_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    PFNGLFRAMEBUFFERTEXTURE1DPROC proc = (PFNGLFRAMEBUFFERTEXTURE1DPROC) glad_gl_on_demand_loader("glFramebufferTexture1D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glFramebufferTexture1D, proc);
+    proc(target, attachment, textarget, texture, level);
+}
+PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D = glad_on_demand_impl_glFramebufferTexture1D;
+static void GLAD_API_PTR glad_on_demand_impl_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    PFNGLFRAMEBUFFERTEXTURE2DPROC proc = (PFNGLFRAMEBUFFERTEXTURE2DPROC) glad_gl_on_demand_loader("glFramebufferTexture2D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glFramebufferTexture2D, proc);
+    proc(target, attachment, textarget, texture, level);
+}
+PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D = glad_on_demand_impl_glFramebufferTexture2D;
+static void GLAD_API_PTR glad_on_demand_impl_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    PFNGLFRAMEBUFFERTEXTURE3DPROC proc = (PFNGLFRAMEBUFFERTEXTURE3DPROC) glad_gl_on_demand_loader("glFramebufferTexture3D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glFramebufferTexture3D, proc);
+    proc(target, attachment, textarget, texture, level, zoffset);
+}
+PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D = glad_on_demand_impl_glFramebufferTexture3D;
+static void GLAD_API_PTR glad_on_demand_impl_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    PFNGLFRAMEBUFFERTEXTURELAYERPROC proc = (PFNGLFRAMEBUFFERTEXTURELAYERPROC) glad_gl_on_demand_loader("glFramebufferTextureLayer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glFramebufferTextureLayer, proc);
+    proc(target, attachment, texture, level, layer);
+}
+PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer = glad_on_demand_impl_glFramebufferTextureLayer;
+static void GLAD_API_PTR glad_on_demand_impl_glFrontFace(GLenum mode) {
+    PFNGLFRONTFACEPROC proc = (PFNGLFRONTFACEPROC) glad_gl_on_demand_loader("glFrontFace");
+    GLAD_GL_ON_DEMAND_STORE(glad_glFrontFace, proc);
+    proc(mode);
+}
+PFNGLFRONTFACEPROC glad_glFrontFace = glad_on_demand_impl_glFrontFace;
+static void GLAD_API_PTR glad_on_demand_impl_glGenBuffers(GLsizei n, GLuint * buffers) {
+    PFNGLGENBUFFERSPROC proc = (PFNGLGENBUFFERSPROC) glad_gl_on_demand_loader("glGenBuffers");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGenBuffers, proc);
+    proc(n, buffers);
+}
+PFNGLGENBUFFERSPROC glad_glGenBuffers = glad_on_demand_impl_glGenBuffers;
+static void GLAD_API_PTR glad_on_demand_impl_glGenFramebuffers(GLsizei n, GLuint * framebuffers) {
+    PFNGLGENFRAMEBUFFERSPROC proc = (PFNGLGENFRAMEBUFFERSPROC) glad_gl_on_demand_loader("glGenFramebuffers");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGenFramebuffers, proc);
+    proc(n, framebuffers);
+}
+PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers = glad_on_demand_impl_glGenFramebuffers;
+static void GLAD_API_PTR glad_on_demand_impl_glGenProgramPipelines(GLsizei n, GLuint * pipelines) {
+    PFNGLGENPROGRAMPIPELINESPROC proc = (PFNGLGENPROGRAMPIPELINESPROC) glad_gl_on_demand_loader("glGenProgramPipelines");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGenProgramPipelines, proc);
+    proc(n, pipelines);
+}
+PFNGLGENPROGRAMPIPELINESPROC glad_glGenProgramPipelines = glad_on_demand_impl_glGenProgramPipelines;
+static void GLAD_API_PTR glad_on_demand_impl_glGenQueries(GLsizei n, GLuint * ids) {
+    PFNGLGENQUERIESPROC proc = (PFNGLGENQUERIESPROC) glad_gl_on_demand_loader("glGenQueries");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGenQueries, proc);
+    proc(n, ids);
+}
+PFNGLGENQUERIESPROC glad_glGenQueries = glad_on_demand_impl_glGenQueries;
+static void GLAD_API_PTR glad_on_demand_impl_glGenRenderbuffers(GLsizei n, GLuint * renderbuffers) {
+    PFNGLGENRENDERBUFFERSPROC proc = (PFNGLGENRENDERBUFFERSPROC) glad_gl_on_demand_loader("glGenRenderbuffers");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGenRenderbuffers, proc);
+    proc(n, renderbuffers);
+}
+PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers = glad_on_demand_impl_glGenRenderbuffers;
+static void GLAD_API_PTR glad_on_demand_impl_glGenSamplers(GLsizei count, GLuint * samplers) {
+    PFNGLGENSAMPLERSPROC proc = (PFNGLGENSAMPLERSPROC) glad_gl_on_demand_loader("glGenSamplers");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGenSamplers, proc);
+    proc(count, samplers);
+}
+PFNGLGENSAMPLERSPROC glad_glGenSamplers = glad_on_demand_impl_glGenSamplers;
+static void GLAD_API_PTR glad_on_demand_impl_glGenTextures(GLsizei n, GLuint * textures) {
+    PFNGLGENTEXTURESPROC proc = (PFNGLGENTEXTURESPROC) glad_gl_on_demand_loader("glGenTextures");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGenTextures, proc);
+    proc(n, textures);
+}
+PFNGLGENTEXTURESPROC glad_glGenTextures = glad_on_demand_impl_glGenTextures;
+static void GLAD_API_PTR glad_on_demand_impl_glGenTransformFeedbacks(GLsizei n, GLuint * ids) {
+    PFNGLGENTRANSFORMFEEDBACKSPROC proc = (PFNGLGENTRANSFORMFEEDBACKSPROC) glad_gl_on_demand_loader("glGenTransformFeedbacks");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGenTransformFeedbacks, proc);
+    proc(n, ids);
+}
+PFNGLGENTRANSFORMFEEDBACKSPROC glad_glGenTransformFeedbacks = glad_on_demand_impl_glGenTransformFeedbacks;
+static void GLAD_API_PTR glad_on_demand_impl_glGenVertexArrays(GLsizei n, GLuint * arrays) {
+    PFNGLGENVERTEXARRAYSPROC proc = (PFNGLGENVERTEXARRAYSPROC) glad_gl_on_demand_loader("glGenVertexArrays");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGenVertexArrays, proc);
+    proc(n, arrays);
+}
+PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays = glad_on_demand_impl_glGenVertexArrays;
+static void GLAD_API_PTR glad_on_demand_impl_glGenerateMipmap(GLenum target) {
+    PFNGLGENERATEMIPMAPPROC proc = (PFNGLGENERATEMIPMAPPROC) glad_gl_on_demand_loader("glGenerateMipmap");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGenerateMipmap, proc);
+    proc(target);
+}
+PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap = glad_on_demand_impl_glGenerateMipmap;
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint * params) {
+    PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC proc = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC) glad_gl_on_demand_loader("glGetActiveAtomicCounterBufferiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetActiveAtomicCounterBufferiv, proc);
+    proc(program, bufferIndex, pname, params);
+}
+PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_glGetActiveAtomicCounterBufferiv = glad_on_demand_impl_glGetActiveAtomicCounterBufferiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) {
+    PFNGLGETACTIVEATTRIBPROC proc = (PFNGLGETACTIVEATTRIBPROC) glad_gl_on_demand_loader("glGetActiveAttrib");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetActiveAttrib, proc);
+    proc(program, index, bufSize, length, size, type, name);
+}
+PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib = glad_on_demand_impl_glGetActiveAttrib;
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name) {
+    PFNGLGETACTIVESUBROUTINENAMEPROC proc = (PFNGLGETACTIVESUBROUTINENAMEPROC) glad_gl_on_demand_loader("glGetActiveSubroutineName");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetActiveSubroutineName, proc);
+    proc(program, shadertype, index, bufSize, length, name);
+}
+PFNGLGETACTIVESUBROUTINENAMEPROC glad_glGetActiveSubroutineName = glad_on_demand_impl_glGetActiveSubroutineName;
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name) {
+    PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC proc = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC) glad_gl_on_demand_loader("glGetActiveSubroutineUniformName");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetActiveSubroutineUniformName, proc);
+    proc(program, shadertype, index, bufSize, length, name);
+}
+PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_glGetActiveSubroutineUniformName = glad_on_demand_impl_glGetActiveSubroutineUniformName;
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint * values) {
+    PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC proc = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC) glad_gl_on_demand_loader("glGetActiveSubroutineUniformiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetActiveSubroutineUniformiv, proc);
+    proc(program, shadertype, index, pname, values);
+}
+PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_glGetActiveSubroutineUniformiv = glad_on_demand_impl_glGetActiveSubroutineUniformiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) {
+    PFNGLGETACTIVEUNIFORMPROC proc = (PFNGLGETACTIVEUNIFORMPROC) glad_gl_on_demand_loader("glGetActiveUniform");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetActiveUniform, proc);
+    proc(program, index, bufSize, length, size, type, name);
+}
+PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform = glad_on_demand_impl_glGetActiveUniform;
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformBlockName) {
+    PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC proc = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC) glad_gl_on_demand_loader("glGetActiveUniformBlockName");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetActiveUniformBlockName, proc);
+    proc(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName = glad_on_demand_impl_glGetActiveUniformBlockName;
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint * params) {
+    PFNGLGETACTIVEUNIFORMBLOCKIVPROC proc = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC) glad_gl_on_demand_loader("glGetActiveUniformBlockiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetActiveUniformBlockiv, proc);
+    proc(program, uniformBlockIndex, pname, params);
+}
+PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv = glad_on_demand_impl_glGetActiveUniformBlockiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformName) {
+    PFNGLGETACTIVEUNIFORMNAMEPROC proc = (PFNGLGETACTIVEUNIFORMNAMEPROC) glad_gl_on_demand_loader("glGetActiveUniformName");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetActiveUniformName, proc);
+    proc(program, uniformIndex, bufSize, length, uniformName);
+}
+PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName = glad_on_demand_impl_glGetActiveUniformName;
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint * uniformIndices, GLenum pname, GLint * params) {
+    PFNGLGETACTIVEUNIFORMSIVPROC proc = (PFNGLGETACTIVEUNIFORMSIVPROC) glad_gl_on_demand_loader("glGetActiveUniformsiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetActiveUniformsiv, proc);
+    proc(program, uniformCount, uniformIndices, pname, params);
+}
+PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv = glad_on_demand_impl_glGetActiveUniformsiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei * count, GLuint * shaders) {
+    PFNGLGETATTACHEDSHADERSPROC proc = (PFNGLGETATTACHEDSHADERSPROC) glad_gl_on_demand_loader("glGetAttachedShaders");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetAttachedShaders, proc);
+    proc(program, maxCount, count, shaders);
+}
+PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders = glad_on_demand_impl_glGetAttachedShaders;
+static GLint GLAD_API_PTR glad_on_demand_impl_glGetAttribLocation(GLuint program, const GLchar * name) {
+    PFNGLGETATTRIBLOCATIONPROC proc = (PFNGLGETATTRIBLOCATIONPROC) glad_gl_on_demand_loader("glGetAttribLocation");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetAttribLocation, proc);
+    return proc(program, name);
+}
+PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation = glad_on_demand_impl_glGetAttribLocation;
+static void GLAD_API_PTR glad_on_demand_impl_glGetBooleani_v(GLenum target, GLuint index, GLboolean * data) {
+    PFNGLGETBOOLEANI_VPROC proc = (PFNGLGETBOOLEANI_VPROC) glad_gl_on_demand_loader("glGetBooleani_v");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetBooleani_v, proc);
+    proc(target, index, data);
+}
+PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v = glad_on_demand_impl_glGetBooleani_v;
+static void GLAD_API_PTR glad_on_demand_impl_glGetBooleanv(GLenum pname, GLboolean * data) {
+    PFNGLGETBOOLEANVPROC proc = (PFNGLGETBOOLEANVPROC) glad_gl_on_demand_loader("glGetBooleanv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetBooleanv, proc);
+    proc(pname, data);
+}
+PFNGLGETBOOLEANVPROC glad_glGetBooleanv = glad_on_demand_impl_glGetBooleanv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 * params) {
+    PFNGLGETBUFFERPARAMETERI64VPROC proc = (PFNGLGETBUFFERPARAMETERI64VPROC) glad_gl_on_demand_loader("glGetBufferParameteri64v");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetBufferParameteri64v, proc);
+    proc(target, pname, params);
+}
+PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v = glad_on_demand_impl_glGetBufferParameteri64v;
+static void GLAD_API_PTR glad_on_demand_impl_glGetBufferParameteriv(GLenum target, GLenum pname, GLint * params) {
+    PFNGLGETBUFFERPARAMETERIVPROC proc = (PFNGLGETBUFFERPARAMETERIVPROC) glad_gl_on_demand_loader("glGetBufferParameteriv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetBufferParameteriv, proc);
+    proc(target, pname, params);
+}
+PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv = glad_on_demand_impl_glGetBufferParameteriv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetBufferPointerv(GLenum target, GLenum pname, void ** params) {
+    PFNGLGETBUFFERPOINTERVPROC proc = (PFNGLGETBUFFERPOINTERVPROC) glad_gl_on_demand_loader("glGetBufferPointerv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetBufferPointerv, proc);
+    proc(target, pname, params);
+}
+PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv = glad_on_demand_impl_glGetBufferPointerv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void * data) {
+    PFNGLGETBUFFERSUBDATAPROC proc = (PFNGLGETBUFFERSUBDATAPROC) glad_gl_on_demand_loader("glGetBufferSubData");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetBufferSubData, proc);
+    proc(target, offset, size, data);
+}
+PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData = glad_on_demand_impl_glGetBufferSubData;
+static void GLAD_API_PTR glad_on_demand_impl_glGetCompressedTexImage(GLenum target, GLint level, void * img) {
+    PFNGLGETCOMPRESSEDTEXIMAGEPROC proc = (PFNGLGETCOMPRESSEDTEXIMAGEPROC) glad_gl_on_demand_loader("glGetCompressedTexImage");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetCompressedTexImage, proc);
+    proc(target, level, img);
+}
+PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage = glad_on_demand_impl_glGetCompressedTexImage;
+static GLuint GLAD_API_PTR glad_on_demand_impl_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum * sources, GLenum * types, GLuint * ids, GLenum * severities, GLsizei * lengths, GLchar * messageLog) {
+    PFNGLGETDEBUGMESSAGELOGPROC proc = (PFNGLGETDEBUGMESSAGELOGPROC) glad_gl_on_demand_loader("glGetDebugMessageLog");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetDebugMessageLog, proc);
+    return proc(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+PFNGLGETDEBUGMESSAGELOGPROC glad_glGetDebugMessageLog = glad_on_demand_impl_glGetDebugMessageLog;
+static void GLAD_API_PTR glad_on_demand_impl_glGetDoublei_v(GLenum target, GLuint index, GLdouble * data) {
+    PFNGLGETDOUBLEI_VPROC proc = (PFNGLGETDOUBLEI_VPROC) glad_gl_on_demand_loader("glGetDoublei_v");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetDoublei_v, proc);
+    proc(target, index, data);
+}
+PFNGLGETDOUBLEI_VPROC glad_glGetDoublei_v = glad_on_demand_impl_glGetDoublei_v;
+static void GLAD_API_PTR glad_on_demand_impl_glGetDoublev(GLenum pname, GLdouble * data) {
+    PFNGLGETDOUBLEVPROC proc = (PFNGLGETDOUBLEVPROC) glad_gl_on_demand_loader("glGetDoublev");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetDoublev, proc);
+    proc(pname, data);
+}
+PFNGLGETDOUBLEVPROC glad_glGetDoublev = glad_on_demand_impl_glGetDoublev;
+static GLenum GLAD_API_PTR glad_on_demand_impl_glGetError(void) {
+    PFNGLGETERRORPROC proc = (PFNGLGETERRORPROC) glad_gl_on_demand_loader("glGetError");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetError, proc);
+    return proc();
+}
+PFNGLGETERRORPROC glad_glGetError = glad_on_demand_impl_glGetError;
+static void GLAD_API_PTR glad_on_demand_impl_glGetFloati_v(GLenum target, GLuint index, GLfloat * data) {
+    PFNGLGETFLOATI_VPROC proc = (PFNGLGETFLOATI_VPROC) glad_gl_on_demand_loader("glGetFloati_v");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetFloati_v, proc);
+    proc(target, index, data);
+}
+PFNGLGETFLOATI_VPROC glad_glGetFloati_v = glad_on_demand_impl_glGetFloati_v;
+static void GLAD_API_PTR glad_on_demand_impl_glGetFloatv(GLenum pname, GLfloat * data) {
+    PFNGLGETFLOATVPROC proc = (PFNGLGETFLOATVPROC) glad_gl_on_demand_loader("glGetFloatv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetFloatv, proc);
+    proc(pname, data);
+}
+PFNGLGETFLOATVPROC glad_glGetFloatv = glad_on_demand_impl_glGetFloatv;
+static GLint GLAD_API_PTR glad_on_demand_impl_glGetFragDataIndex(GLuint program, const GLchar * name) {
+    PFNGLGETFRAGDATAINDEXPROC proc = (PFNGLGETFRAGDATAINDEXPROC) glad_gl_on_demand_loader("glGetFragDataIndex");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetFragDataIndex, proc);
+    return proc(program, name);
+}
+PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex = glad_on_demand_impl_glGetFragDataIndex;
+static GLint GLAD_API_PTR glad_on_demand_impl_glGetFragDataLocation(GLuint program, const GLchar * name) {
+    PFNGLGETFRAGDATALOCATIONPROC proc = (PFNGLGETFRAGDATALOCATIONPROC) glad_gl_on_demand_loader("glGetFragDataLocation");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetFragDataLocation, proc);
+    return proc(program, name);
+}
+PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation = glad_on_demand_impl_glGetFragDataLocation;
+static void GLAD_API_PTR glad_on_demand_impl_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint * params) {
+    PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC proc = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC) glad_gl_on_demand_loader("glGetFramebufferAttachmentParameteriv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetFramebufferAttachmentParameteriv, proc);
+    proc(target, attachment, pname, params);
+}
+PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv = glad_on_demand_impl_glGetFramebufferAttachmentParameteriv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint * params) {
+    PFNGLGETFRAMEBUFFERPARAMETERIVPROC proc = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC) glad_gl_on_demand_loader("glGetFramebufferParameteriv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetFramebufferParameteriv, proc);
+    proc(target, pname, params);
+}
+PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_glGetFramebufferParameteriv = glad_on_demand_impl_glGetFramebufferParameteriv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetInteger64i_v(GLenum target, GLuint index, GLint64 * data) {
+    PFNGLGETINTEGER64I_VPROC proc = (PFNGLGETINTEGER64I_VPROC) glad_gl_on_demand_loader("glGetInteger64i_v");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetInteger64i_v, proc);
+    proc(target, index, data);
+}
+PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v = glad_on_demand_impl_glGetInteger64i_v;
+static void GLAD_API_PTR glad_on_demand_impl_glGetInteger64v(GLenum pname, GLint64 * data) {
+    PFNGLGETINTEGER64VPROC proc = (PFNGLGETINTEGER64VPROC) glad_gl_on_demand_loader("glGetInteger64v");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetInteger64v, proc);
+    proc(pname, data);
+}
+PFNGLGETINTEGER64VPROC glad_glGetInteger64v = glad_on_demand_impl_glGetInteger64v;
+static void GLAD_API_PTR glad_on_demand_impl_glGetIntegeri_v(GLenum target, GLuint index, GLint * data) {
+    PFNGLGETINTEGERI_VPROC proc = (PFNGLGETINTEGERI_VPROC) glad_gl_on_demand_loader("glGetIntegeri_v");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetIntegeri_v, proc);
+    proc(target, index, data);
+}
+PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v = glad_on_demand_impl_glGetIntegeri_v;
+static void GLAD_API_PTR glad_on_demand_impl_glGetIntegerv(GLenum pname, GLint * data) {
+    PFNGLGETINTEGERVPROC proc = (PFNGLGETINTEGERVPROC) glad_gl_on_demand_loader("glGetIntegerv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetIntegerv, proc);
+    proc(pname, data);
+}
+PFNGLGETINTEGERVPROC glad_glGetIntegerv = glad_on_demand_impl_glGetIntegerv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 * params) {
+    PFNGLGETINTERNALFORMATI64VPROC proc = (PFNGLGETINTERNALFORMATI64VPROC) glad_gl_on_demand_loader("glGetInternalformati64v");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetInternalformati64v, proc);
+    proc(target, internalformat, pname, count, params);
+}
+PFNGLGETINTERNALFORMATI64VPROC glad_glGetInternalformati64v = glad_on_demand_impl_glGetInternalformati64v;
+static void GLAD_API_PTR glad_on_demand_impl_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint * params) {
+    PFNGLGETINTERNALFORMATIVPROC proc = (PFNGLGETINTERNALFORMATIVPROC) glad_gl_on_demand_loader("glGetInternalformativ");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetInternalformativ, proc);
+    proc(target, internalformat, pname, count, params);
+}
+PFNGLGETINTERNALFORMATIVPROC glad_glGetInternalformativ = glad_on_demand_impl_glGetInternalformativ;
+static void GLAD_API_PTR glad_on_demand_impl_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat * val) {
+    PFNGLGETMULTISAMPLEFVPROC proc = (PFNGLGETMULTISAMPLEFVPROC) glad_gl_on_demand_loader("glGetMultisamplefv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetMultisamplefv, proc);
+    proc(pname, index, val);
+}
+PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv = glad_on_demand_impl_glGetMultisamplefv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei * length, GLchar * label) {
+    PFNGLGETOBJECTLABELPROC proc = (PFNGLGETOBJECTLABELPROC) glad_gl_on_demand_loader("glGetObjectLabel");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetObjectLabel, proc);
+    proc(identifier, name, bufSize, length, label);
+}
+PFNGLGETOBJECTLABELPROC glad_glGetObjectLabel = glad_on_demand_impl_glGetObjectLabel;
+static void GLAD_API_PTR glad_on_demand_impl_glGetObjectPtrLabel(const void * ptr, GLsizei bufSize, GLsizei * length, GLchar * label) {
+    PFNGLGETOBJECTPTRLABELPROC proc = (PFNGLGETOBJECTPTRLABELPROC) glad_gl_on_demand_loader("glGetObjectPtrLabel");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetObjectPtrLabel, proc);
+    proc(ptr, bufSize, length, label);
+}
+PFNGLGETOBJECTPTRLABELPROC glad_glGetObjectPtrLabel = glad_on_demand_impl_glGetObjectPtrLabel;
+static void GLAD_API_PTR glad_on_demand_impl_glGetPointerv(GLenum pname, void ** params) {
+    PFNGLGETPOINTERVPROC proc = (PFNGLGETPOINTERVPROC) glad_gl_on_demand_loader("glGetPointerv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetPointerv, proc);
+    proc(pname, params);
+}
+PFNGLGETPOINTERVPROC glad_glGetPointerv = glad_on_demand_impl_glGetPointerv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei * length, GLenum * binaryFormat, void * binary) {
+    PFNGLGETPROGRAMBINARYPROC proc = (PFNGLGETPROGRAMBINARYPROC) glad_gl_on_demand_loader("glGetProgramBinary");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetProgramBinary, proc);
+    proc(program, bufSize, length, binaryFormat, binary);
+}
+PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = glad_on_demand_impl_glGetProgramBinary;
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog) {
+    PFNGLGETPROGRAMINFOLOGPROC proc = (PFNGLGETPROGRAMINFOLOGPROC) glad_gl_on_demand_loader("glGetProgramInfoLog");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetProgramInfoLog, proc);
+    proc(program, bufSize, length, infoLog);
+}
+PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog = glad_on_demand_impl_glGetProgramInfoLog;
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint * params) {
+    PFNGLGETPROGRAMINTERFACEIVPROC proc = (PFNGLGETPROGRAMINTERFACEIVPROC) glad_gl_on_demand_loader("glGetProgramInterfaceiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetProgramInterfaceiv, proc);
+    proc(program, programInterface, pname, params);
+}
+PFNGLGETPROGRAMINTERFACEIVPROC glad_glGetProgramInterfaceiv = glad_on_demand_impl_glGetProgramInterfaceiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei * length, GLchar * infoLog) {
+    PFNGLGETPROGRAMPIPELINEINFOLOGPROC proc = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC) glad_gl_on_demand_loader("glGetProgramPipelineInfoLog");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetProgramPipelineInfoLog, proc);
+    proc(pipeline, bufSize, length, infoLog);
+}
+PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_glGetProgramPipelineInfoLog = glad_on_demand_impl_glGetProgramPipelineInfoLog;
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint * params) {
+    PFNGLGETPROGRAMPIPELINEIVPROC proc = (PFNGLGETPROGRAMPIPELINEIVPROC) glad_gl_on_demand_loader("glGetProgramPipelineiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetProgramPipelineiv, proc);
+    proc(pipeline, pname, params);
+}
+PFNGLGETPROGRAMPIPELINEIVPROC glad_glGetProgramPipelineiv = glad_on_demand_impl_glGetProgramPipelineiv;
+static GLuint GLAD_API_PTR glad_on_demand_impl_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar * name) {
+    PFNGLGETPROGRAMRESOURCEINDEXPROC proc = (PFNGLGETPROGRAMRESOURCEINDEXPROC) glad_gl_on_demand_loader("glGetProgramResourceIndex");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetProgramResourceIndex, proc);
+    return proc(program, programInterface, name);
+}
+PFNGLGETPROGRAMRESOURCEINDEXPROC glad_glGetProgramResourceIndex = glad_on_demand_impl_glGetProgramResourceIndex;
+static GLint GLAD_API_PTR glad_on_demand_impl_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar * name) {
+    PFNGLGETPROGRAMRESOURCELOCATIONPROC proc = (PFNGLGETPROGRAMRESOURCELOCATIONPROC) glad_gl_on_demand_loader("glGetProgramResourceLocation");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetProgramResourceLocation, proc);
+    return proc(program, programInterface, name);
+}
+PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_glGetProgramResourceLocation = glad_on_demand_impl_glGetProgramResourceLocation;
+static GLint GLAD_API_PTR glad_on_demand_impl_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar * name) {
+    PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC proc = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC) glad_gl_on_demand_loader("glGetProgramResourceLocationIndex");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetProgramResourceLocationIndex, proc);
+    return proc(program, programInterface, name);
+}
+PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_glGetProgramResourceLocationIndex = glad_on_demand_impl_glGetProgramResourceLocationIndex;
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name) {
+    PFNGLGETPROGRAMRESOURCENAMEPROC proc = (PFNGLGETPROGRAMRESOURCENAMEPROC) glad_gl_on_demand_loader("glGetProgramResourceName");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetProgramResourceName, proc);
+    proc(program, programInterface, index, bufSize, length, name);
+}
+PFNGLGETPROGRAMRESOURCENAMEPROC glad_glGetProgramResourceName = glad_on_demand_impl_glGetProgramResourceName;
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum * props, GLsizei count, GLsizei * length, GLint * params) {
+    PFNGLGETPROGRAMRESOURCEIVPROC proc = (PFNGLGETPROGRAMRESOURCEIVPROC) glad_gl_on_demand_loader("glGetProgramResourceiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetProgramResourceiv, proc);
+    proc(program, programInterface, index, propCount, props, count, length, params);
+}
+PFNGLGETPROGRAMRESOURCEIVPROC glad_glGetProgramResourceiv = glad_on_demand_impl_glGetProgramResourceiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint * values) {
+    PFNGLGETPROGRAMSTAGEIVPROC proc = (PFNGLGETPROGRAMSTAGEIVPROC) glad_gl_on_demand_loader("glGetProgramStageiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetProgramStageiv, proc);
+    proc(program, shadertype, pname, values);
+}
+PFNGLGETPROGRAMSTAGEIVPROC glad_glGetProgramStageiv = glad_on_demand_impl_glGetProgramStageiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramiv(GLuint program, GLenum pname, GLint * params) {
+    PFNGLGETPROGRAMIVPROC proc = (PFNGLGETPROGRAMIVPROC) glad_gl_on_demand_loader("glGetProgramiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetProgramiv, proc);
+    proc(program, pname, params);
+}
+PFNGLGETPROGRAMIVPROC glad_glGetProgramiv = glad_on_demand_impl_glGetProgramiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint * params) {
+    PFNGLGETQUERYINDEXEDIVPROC proc = (PFNGLGETQUERYINDEXEDIVPROC) glad_gl_on_demand_loader("glGetQueryIndexediv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetQueryIndexediv, proc);
+    proc(target, index, pname, params);
+}
+PFNGLGETQUERYINDEXEDIVPROC glad_glGetQueryIndexediv = glad_on_demand_impl_glGetQueryIndexediv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 * params) {
+    PFNGLGETQUERYOBJECTI64VPROC proc = (PFNGLGETQUERYOBJECTI64VPROC) glad_gl_on_demand_loader("glGetQueryObjecti64v");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetQueryObjecti64v, proc);
+    proc(id, pname, params);
+}
+PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v = glad_on_demand_impl_glGetQueryObjecti64v;
+static void GLAD_API_PTR glad_on_demand_impl_glGetQueryObjectiv(GLuint id, GLenum pname, GLint * params) {
+    PFNGLGETQUERYOBJECTIVPROC proc = (PFNGLGETQUERYOBJECTIVPROC) glad_gl_on_demand_loader("glGetQueryObjectiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetQueryObjectiv, proc);
+    proc(id, pname, params);
+}
+PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv = glad_on_demand_impl_glGetQueryObjectiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 * params) {
+    PFNGLGETQUERYOBJECTUI64VPROC proc = (PFNGLGETQUERYOBJECTUI64VPROC) glad_gl_on_demand_loader("glGetQueryObjectui64v");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetQueryObjectui64v, proc);
+    proc(id, pname, params);
+}
+PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v = glad_on_demand_impl_glGetQueryObjectui64v;
+static void GLAD_API_PTR glad_on_demand_impl_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint * params) {
+    PFNGLGETQUERYOBJECTUIVPROC proc = (PFNGLGETQUERYOBJECTUIVPROC) glad_gl_on_demand_loader("glGetQueryObjectuiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetQueryObjectuiv, proc);
+    proc(id, pname, params);
+}
+PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv = glad_on_demand_impl_glGetQueryObjectuiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetQueryiv(GLenum target, GLenum pname, GLint * params) {
+    PFNGLGETQUERYIVPROC proc = (PFNGLGETQUERYIVPROC) glad_gl_on_demand_loader("glGetQueryiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetQueryiv, proc);
+    proc(target, pname, params);
+}
+PFNGLGETQUERYIVPROC glad_glGetQueryiv = glad_on_demand_impl_glGetQueryiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint * params) {
+    PFNGLGETRENDERBUFFERPARAMETERIVPROC proc = (PFNGLGETRENDERBUFFERPARAMETERIVPROC) glad_gl_on_demand_loader("glGetRenderbufferParameteriv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetRenderbufferParameteriv, proc);
+    proc(target, pname, params);
+}
+PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv = glad_on_demand_impl_glGetRenderbufferParameteriv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint * params) {
+    PFNGLGETSAMPLERPARAMETERIIVPROC proc = (PFNGLGETSAMPLERPARAMETERIIVPROC) glad_gl_on_demand_loader("glGetSamplerParameterIiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetSamplerParameterIiv, proc);
+    proc(sampler, pname, params);
+}
+PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv = glad_on_demand_impl_glGetSamplerParameterIiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint * params) {
+    PFNGLGETSAMPLERPARAMETERIUIVPROC proc = (PFNGLGETSAMPLERPARAMETERIUIVPROC) glad_gl_on_demand_loader("glGetSamplerParameterIuiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetSamplerParameterIuiv, proc);
+    proc(sampler, pname, params);
+}
+PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv = glad_on_demand_impl_glGetSamplerParameterIuiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat * params) {
+    PFNGLGETSAMPLERPARAMETERFVPROC proc = (PFNGLGETSAMPLERPARAMETERFVPROC) glad_gl_on_demand_loader("glGetSamplerParameterfv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetSamplerParameterfv, proc);
+    proc(sampler, pname, params);
+}
+PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv = glad_on_demand_impl_glGetSamplerParameterfv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint * params) {
+    PFNGLGETSAMPLERPARAMETERIVPROC proc = (PFNGLGETSAMPLERPARAMETERIVPROC) glad_gl_on_demand_loader("glGetSamplerParameteriv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetSamplerParameteriv, proc);
+    proc(sampler, pname, params);
+}
+PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv = glad_on_demand_impl_glGetSamplerParameteriv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * infoLog) {
+    PFNGLGETSHADERINFOLOGPROC proc = (PFNGLGETSHADERINFOLOGPROC) glad_gl_on_demand_loader("glGetShaderInfoLog");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetShaderInfoLog, proc);
+    proc(shader, bufSize, length, infoLog);
+}
+PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog = glad_on_demand_impl_glGetShaderInfoLog;
+static void GLAD_API_PTR glad_on_demand_impl_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint * range, GLint * precision) {
+    PFNGLGETSHADERPRECISIONFORMATPROC proc = (PFNGLGETSHADERPRECISIONFORMATPROC) glad_gl_on_demand_loader("glGetShaderPrecisionFormat");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetShaderPrecisionFormat, proc);
+    proc(shadertype, precisiontype, range, precision);
+}
+PFNGLGETSHADERPRECISIONFORMATPROC glad_glGetShaderPrecisionFormat = glad_on_demand_impl_glGetShaderPrecisionFormat;
+static void GLAD_API_PTR glad_on_demand_impl_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * source) {
+    PFNGLGETSHADERSOURCEPROC proc = (PFNGLGETSHADERSOURCEPROC) glad_gl_on_demand_loader("glGetShaderSource");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetShaderSource, proc);
+    proc(shader, bufSize, length, source);
+}
+PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource = glad_on_demand_impl_glGetShaderSource;
+static void GLAD_API_PTR glad_on_demand_impl_glGetShaderiv(GLuint shader, GLenum pname, GLint * params) {
+    PFNGLGETSHADERIVPROC proc = (PFNGLGETSHADERIVPROC) glad_gl_on_demand_loader("glGetShaderiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetShaderiv, proc);
+    proc(shader, pname, params);
+}
+PFNGLGETSHADERIVPROC glad_glGetShaderiv = glad_on_demand_impl_glGetShaderiv;
+static const GLubyte * GLAD_API_PTR glad_on_demand_impl_glGetString(GLenum name) {
+    PFNGLGETSTRINGPROC proc = (PFNGLGETSTRINGPROC) glad_gl_on_demand_loader("glGetString");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetString, proc);
+    return proc(name);
+}
+PFNGLGETSTRINGPROC glad_glGetString = glad_on_demand_impl_glGetString;
+static const GLubyte * GLAD_API_PTR glad_on_demand_impl_glGetStringi(GLenum name, GLuint index) {
+    PFNGLGETSTRINGIPROC proc = (PFNGLGETSTRINGIPROC) glad_gl_on_demand_loader("glGetStringi");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetStringi, proc);
+    return proc(name, index);
+}
+PFNGLGETSTRINGIPROC glad_glGetStringi = glad_on_demand_impl_glGetStringi;
+static GLuint GLAD_API_PTR glad_on_demand_impl_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar * name) {
+    PFNGLGETSUBROUTINEINDEXPROC proc = (PFNGLGETSUBROUTINEINDEXPROC) glad_gl_on_demand_loader("glGetSubroutineIndex");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetSubroutineIndex, proc);
+    return proc(program, shadertype, name);
+}
+PFNGLGETSUBROUTINEINDEXPROC glad_glGetSubroutineIndex = glad_on_demand_impl_glGetSubroutineIndex;
+static GLint GLAD_API_PTR glad_on_demand_impl_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar * name) {
+    PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC proc = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC) glad_gl_on_demand_loader("glGetSubroutineUniformLocation");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetSubroutineUniformLocation, proc);
+    return proc(program, shadertype, name);
+}
+PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_glGetSubroutineUniformLocation = glad_on_demand_impl_glGetSubroutineUniformLocation;
+static void GLAD_API_PTR glad_on_demand_impl_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei * length, GLint * values) {
+    PFNGLGETSYNCIVPROC proc = (PFNGLGETSYNCIVPROC) glad_gl_on_demand_loader("glGetSynciv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetSynciv, proc);
+    proc(sync, pname, count, length, values);
+}
+PFNGLGETSYNCIVPROC glad_glGetSynciv = glad_on_demand_impl_glGetSynciv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void * pixels) {
+    PFNGLGETTEXIMAGEPROC proc = (PFNGLGETTEXIMAGEPROC) glad_gl_on_demand_loader("glGetTexImage");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetTexImage, proc);
+    proc(target, level, format, type, pixels);
+}
+PFNGLGETTEXIMAGEPROC glad_glGetTexImage = glad_on_demand_impl_glGetTexImage;
+static void GLAD_API_PTR glad_on_demand_impl_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat * params) {
+    PFNGLGETTEXLEVELPARAMETERFVPROC proc = (PFNGLGETTEXLEVELPARAMETERFVPROC) glad_gl_on_demand_loader("glGetTexLevelParameterfv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetTexLevelParameterfv, proc);
+    proc(target, level, pname, params);
+}
+PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv = glad_on_demand_impl_glGetTexLevelParameterfv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint * params) {
+    PFNGLGETTEXLEVELPARAMETERIVPROC proc = (PFNGLGETTEXLEVELPARAMETERIVPROC) glad_gl_on_demand_loader("glGetTexLevelParameteriv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetTexLevelParameteriv, proc);
+    proc(target, level, pname, params);
+}
+PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv = glad_on_demand_impl_glGetTexLevelParameteriv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetTexParameterIiv(GLenum target, GLenum pname, GLint * params) {
+    PFNGLGETTEXPARAMETERIIVPROC proc = (PFNGLGETTEXPARAMETERIIVPROC) glad_gl_on_demand_loader("glGetTexParameterIiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetTexParameterIiv, proc);
+    proc(target, pname, params);
+}
+PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv = glad_on_demand_impl_glGetTexParameterIiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint * params) {
+    PFNGLGETTEXPARAMETERIUIVPROC proc = (PFNGLGETTEXPARAMETERIUIVPROC) glad_gl_on_demand_loader("glGetTexParameterIuiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetTexParameterIuiv, proc);
+    proc(target, pname, params);
+}
+PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv = glad_on_demand_impl_glGetTexParameterIuiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat * params) {
+    PFNGLGETTEXPARAMETERFVPROC proc = (PFNGLGETTEXPARAMETERFVPROC) glad_gl_on_demand_loader("glGetTexParameterfv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetTexParameterfv, proc);
+    proc(target, pname, params);
+}
+PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv = glad_on_demand_impl_glGetTexParameterfv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetTexParameteriv(GLenum target, GLenum pname, GLint * params) {
+    PFNGLGETTEXPARAMETERIVPROC proc = (PFNGLGETTEXPARAMETERIVPROC) glad_gl_on_demand_loader("glGetTexParameteriv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetTexParameteriv, proc);
+    proc(target, pname, params);
+}
+PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv = glad_on_demand_impl_glGetTexParameteriv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLsizei * size, GLenum * type, GLchar * name) {
+    PFNGLGETTRANSFORMFEEDBACKVARYINGPROC proc = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC) glad_gl_on_demand_loader("glGetTransformFeedbackVarying");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetTransformFeedbackVarying, proc);
+    proc(program, index, bufSize, length, size, type, name);
+}
+PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying = glad_on_demand_impl_glGetTransformFeedbackVarying;
+static GLuint GLAD_API_PTR glad_on_demand_impl_glGetUniformBlockIndex(GLuint program, const GLchar * uniformBlockName) {
+    PFNGLGETUNIFORMBLOCKINDEXPROC proc = (PFNGLGETUNIFORMBLOCKINDEXPROC) glad_gl_on_demand_loader("glGetUniformBlockIndex");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetUniformBlockIndex, proc);
+    return proc(program, uniformBlockName);
+}
+PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex = glad_on_demand_impl_glGetUniformBlockIndex;
+static void GLAD_API_PTR glad_on_demand_impl_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const* uniformNames, GLuint * uniformIndices) {
+    PFNGLGETUNIFORMINDICESPROC proc = (PFNGLGETUNIFORMINDICESPROC) glad_gl_on_demand_loader("glGetUniformIndices");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetUniformIndices, proc);
+    proc(program, uniformCount, uniformNames, uniformIndices);
+}
+PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices = glad_on_demand_impl_glGetUniformIndices;
+static GLint GLAD_API_PTR glad_on_demand_impl_glGetUniformLocation(GLuint program, const GLchar * name) {
+    PFNGLGETUNIFORMLOCATIONPROC proc = (PFNGLGETUNIFORMLOCATIONPROC) glad_gl_on_demand_loader("glGetUniformLocation");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetUniformLocation, proc);
+    return proc(program, name);
+}
+PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation = glad_on_demand_impl_glGetUniformLocation;
+static void GLAD_API_PTR glad_on_demand_impl_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint * params) {
+    PFNGLGETUNIFORMSUBROUTINEUIVPROC proc = (PFNGLGETUNIFORMSUBROUTINEUIVPROC) glad_gl_on_demand_loader("glGetUniformSubroutineuiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetUniformSubroutineuiv, proc);
+    proc(shadertype, location, params);
+}
+PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_glGetUniformSubroutineuiv = glad_on_demand_impl_glGetUniformSubroutineuiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetUniformdv(GLuint program, GLint location, GLdouble * params) {
+    PFNGLGETUNIFORMDVPROC proc = (PFNGLGETUNIFORMDVPROC) glad_gl_on_demand_loader("glGetUniformdv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetUniformdv, proc);
+    proc(program, location, params);
+}
+PFNGLGETUNIFORMDVPROC glad_glGetUniformdv = glad_on_demand_impl_glGetUniformdv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetUniformfv(GLuint program, GLint location, GLfloat * params) {
+    PFNGLGETUNIFORMFVPROC proc = (PFNGLGETUNIFORMFVPROC) glad_gl_on_demand_loader("glGetUniformfv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetUniformfv, proc);
+    proc(program, location, params);
+}
+PFNGLGETUNIFORMFVPROC glad_glGetUniformfv = glad_on_demand_impl_glGetUniformfv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetUniformiv(GLuint program, GLint location, GLint * params) {
+    PFNGLGETUNIFORMIVPROC proc = (PFNGLGETUNIFORMIVPROC) glad_gl_on_demand_loader("glGetUniformiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetUniformiv, proc);
+    proc(program, location, params);
+}
+PFNGLGETUNIFORMIVPROC glad_glGetUniformiv = glad_on_demand_impl_glGetUniformiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetUniformuiv(GLuint program, GLint location, GLuint * params) {
+    PFNGLGETUNIFORMUIVPROC proc = (PFNGLGETUNIFORMUIVPROC) glad_gl_on_demand_loader("glGetUniformuiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetUniformuiv, proc);
+    proc(program, location, params);
+}
+PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv = glad_on_demand_impl_glGetUniformuiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint * params) {
+    PFNGLGETVERTEXATTRIBIIVPROC proc = (PFNGLGETVERTEXATTRIBIIVPROC) glad_gl_on_demand_loader("glGetVertexAttribIiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetVertexAttribIiv, proc);
+    proc(index, pname, params);
+}
+PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv = glad_on_demand_impl_glGetVertexAttribIiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint * params) {
+    PFNGLGETVERTEXATTRIBIUIVPROC proc = (PFNGLGETVERTEXATTRIBIUIVPROC) glad_gl_on_demand_loader("glGetVertexAttribIuiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetVertexAttribIuiv, proc);
+    proc(index, pname, params);
+}
+PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv = glad_on_demand_impl_glGetVertexAttribIuiv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble * params) {
+    PFNGLGETVERTEXATTRIBLDVPROC proc = (PFNGLGETVERTEXATTRIBLDVPROC) glad_gl_on_demand_loader("glGetVertexAttribLdv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetVertexAttribLdv, proc);
+    proc(index, pname, params);
+}
+PFNGLGETVERTEXATTRIBLDVPROC glad_glGetVertexAttribLdv = glad_on_demand_impl_glGetVertexAttribLdv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexAttribPointerv(GLuint index, GLenum pname, void ** pointer) {
+    PFNGLGETVERTEXATTRIBPOINTERVPROC proc = (PFNGLGETVERTEXATTRIBPOINTERVPROC) glad_gl_on_demand_loader("glGetVertexAttribPointerv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetVertexAttribPointerv, proc);
+    proc(index, pname, pointer);
+}
+PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv = glad_on_demand_impl_glGetVertexAttribPointerv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble * params) {
+    PFNGLGETVERTEXATTRIBDVPROC proc = (PFNGLGETVERTEXATTRIBDVPROC) glad_gl_on_demand_loader("glGetVertexAttribdv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetVertexAttribdv, proc);
+    proc(index, pname, params);
+}
+PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv = glad_on_demand_impl_glGetVertexAttribdv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat * params) {
+    PFNGLGETVERTEXATTRIBFVPROC proc = (PFNGLGETVERTEXATTRIBFVPROC) glad_gl_on_demand_loader("glGetVertexAttribfv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetVertexAttribfv, proc);
+    proc(index, pname, params);
+}
+PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv = glad_on_demand_impl_glGetVertexAttribfv;
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexAttribiv(GLuint index, GLenum pname, GLint * params) {
+    PFNGLGETVERTEXATTRIBIVPROC proc = (PFNGLGETVERTEXATTRIBIVPROC) glad_gl_on_demand_loader("glGetVertexAttribiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glGetVertexAttribiv, proc);
+    proc(index, pname, params);
+}
+PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv = glad_on_demand_impl_glGetVertexAttribiv;
+static void GLAD_API_PTR glad_on_demand_impl_glHint(GLenum target, GLenum mode) {
+    PFNGLHINTPROC proc = (PFNGLHINTPROC) glad_gl_on_demand_loader("glHint");
+    GLAD_GL_ON_DEMAND_STORE(glad_glHint, proc);
+    proc(target, mode);
+}
+PFNGLHINTPROC glad_glHint = glad_on_demand_impl_glHint;
+static void GLAD_API_PTR glad_on_demand_impl_glInvalidateBufferData(GLuint buffer) {
+    PFNGLINVALIDATEBUFFERDATAPROC proc = (PFNGLINVALIDATEBUFFERDATAPROC) glad_gl_on_demand_loader("glInvalidateBufferData");
+    GLAD_GL_ON_DEMAND_STORE(glad_glInvalidateBufferData, proc);
+    proc(buffer);
+}
+PFNGLINVALIDATEBUFFERDATAPROC glad_glInvalidateBufferData = glad_on_demand_impl_glInvalidateBufferData;
+static void GLAD_API_PTR glad_on_demand_impl_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    PFNGLINVALIDATEBUFFERSUBDATAPROC proc = (PFNGLINVALIDATEBUFFERSUBDATAPROC) glad_gl_on_demand_loader("glInvalidateBufferSubData");
+    GLAD_GL_ON_DEMAND_STORE(glad_glInvalidateBufferSubData, proc);
+    proc(buffer, offset, length);
+}
+PFNGLINVALIDATEBUFFERSUBDATAPROC glad_glInvalidateBufferSubData = glad_on_demand_impl_glInvalidateBufferSubData;
+static void GLAD_API_PTR glad_on_demand_impl_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum * attachments) {
+    PFNGLINVALIDATEFRAMEBUFFERPROC proc = (PFNGLINVALIDATEFRAMEBUFFERPROC) glad_gl_on_demand_loader("glInvalidateFramebuffer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glInvalidateFramebuffer, proc);
+    proc(target, numAttachments, attachments);
+}
+PFNGLINVALIDATEFRAMEBUFFERPROC glad_glInvalidateFramebuffer = glad_on_demand_impl_glInvalidateFramebuffer;
+static void GLAD_API_PTR glad_on_demand_impl_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum * attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    PFNGLINVALIDATESUBFRAMEBUFFERPROC proc = (PFNGLINVALIDATESUBFRAMEBUFFERPROC) glad_gl_on_demand_loader("glInvalidateSubFramebuffer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glInvalidateSubFramebuffer, proc);
+    proc(target, numAttachments, attachments, x, y, width, height);
+}
+PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_glInvalidateSubFramebuffer = glad_on_demand_impl_glInvalidateSubFramebuffer;
+static void GLAD_API_PTR glad_on_demand_impl_glInvalidateTexImage(GLuint texture, GLint level) {
+    PFNGLINVALIDATETEXIMAGEPROC proc = (PFNGLINVALIDATETEXIMAGEPROC) glad_gl_on_demand_loader("glInvalidateTexImage");
+    GLAD_GL_ON_DEMAND_STORE(glad_glInvalidateTexImage, proc);
+    proc(texture, level);
+}
+PFNGLINVALIDATETEXIMAGEPROC glad_glInvalidateTexImage = glad_on_demand_impl_glInvalidateTexImage;
+static void GLAD_API_PTR glad_on_demand_impl_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+    PFNGLINVALIDATETEXSUBIMAGEPROC proc = (PFNGLINVALIDATETEXSUBIMAGEPROC) glad_gl_on_demand_loader("glInvalidateTexSubImage");
+    GLAD_GL_ON_DEMAND_STORE(glad_glInvalidateTexSubImage, proc);
+    proc(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+PFNGLINVALIDATETEXSUBIMAGEPROC glad_glInvalidateTexSubImage = glad_on_demand_impl_glInvalidateTexSubImage;
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsBuffer(GLuint buffer) {
+    PFNGLISBUFFERPROC proc = (PFNGLISBUFFERPROC) glad_gl_on_demand_loader("glIsBuffer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glIsBuffer, proc);
+    return proc(buffer);
+}
+PFNGLISBUFFERPROC glad_glIsBuffer = glad_on_demand_impl_glIsBuffer;
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsEnabled(GLenum cap) {
+    PFNGLISENABLEDPROC proc = (PFNGLISENABLEDPROC) glad_gl_on_demand_loader("glIsEnabled");
+    GLAD_GL_ON_DEMAND_STORE(glad_glIsEnabled, proc);
+    return proc(cap);
+}
+PFNGLISENABLEDPROC glad_glIsEnabled = glad_on_demand_impl_glIsEnabled;
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsEnabledi(GLenum target, GLuint index) {
+    PFNGLISENABLEDIPROC proc = (PFNGLISENABLEDIPROC) glad_gl_on_demand_loader("glIsEnabledi");
+    GLAD_GL_ON_DEMAND_STORE(glad_glIsEnabledi, proc);
+    return proc(target, index);
+}
+PFNGLISENABLEDIPROC glad_glIsEnabledi = glad_on_demand_impl_glIsEnabledi;
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsFramebuffer(GLuint framebuffer) {
+    PFNGLISFRAMEBUFFERPROC proc = (PFNGLISFRAMEBUFFERPROC) glad_gl_on_demand_loader("glIsFramebuffer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glIsFramebuffer, proc);
+    return proc(framebuffer);
+}
+PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer = glad_on_demand_impl_glIsFramebuffer;
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsProgram(GLuint program) {
+    PFNGLISPROGRAMPROC proc = (PFNGLISPROGRAMPROC) glad_gl_on_demand_loader("glIsProgram");
+    GLAD_GL_ON_DEMAND_STORE(glad_glIsProgram, proc);
+    return proc(program);
+}
+PFNGLISPROGRAMPROC glad_glIsProgram = glad_on_demand_impl_glIsProgram;
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsProgramPipeline(GLuint pipeline) {
+    PFNGLISPROGRAMPIPELINEPROC proc = (PFNGLISPROGRAMPIPELINEPROC) glad_gl_on_demand_loader("glIsProgramPipeline");
+    GLAD_GL_ON_DEMAND_STORE(glad_glIsProgramPipeline, proc);
+    return proc(pipeline);
+}
+PFNGLISPROGRAMPIPELINEPROC glad_glIsProgramPipeline = glad_on_demand_impl_glIsProgramPipeline;
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsQuery(GLuint id) {
+    PFNGLISQUERYPROC proc = (PFNGLISQUERYPROC) glad_gl_on_demand_loader("glIsQuery");
+    GLAD_GL_ON_DEMAND_STORE(glad_glIsQuery, proc);
+    return proc(id);
+}
+PFNGLISQUERYPROC glad_glIsQuery = glad_on_demand_impl_glIsQuery;
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsRenderbuffer(GLuint renderbuffer) {
+    PFNGLISRENDERBUFFERPROC proc = (PFNGLISRENDERBUFFERPROC) glad_gl_on_demand_loader("glIsRenderbuffer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glIsRenderbuffer, proc);
+    return proc(renderbuffer);
+}
+PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer = glad_on_demand_impl_glIsRenderbuffer;
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsSampler(GLuint sampler) {
+    PFNGLISSAMPLERPROC proc = (PFNGLISSAMPLERPROC) glad_gl_on_demand_loader("glIsSampler");
+    GLAD_GL_ON_DEMAND_STORE(glad_glIsSampler, proc);
+    return proc(sampler);
+}
+PFNGLISSAMPLERPROC glad_glIsSampler = glad_on_demand_impl_glIsSampler;
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsShader(GLuint shader) {
+    PFNGLISSHADERPROC proc = (PFNGLISSHADERPROC) glad_gl_on_demand_loader("glIsShader");
+    GLAD_GL_ON_DEMAND_STORE(glad_glIsShader, proc);
+    return proc(shader);
+}
+PFNGLISSHADERPROC glad_glIsShader = glad_on_demand_impl_glIsShader;
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsSync(GLsync sync) {
+    PFNGLISSYNCPROC proc = (PFNGLISSYNCPROC) glad_gl_on_demand_loader("glIsSync");
+    GLAD_GL_ON_DEMAND_STORE(glad_glIsSync, proc);
+    return proc(sync);
+}
+PFNGLISSYNCPROC glad_glIsSync = glad_on_demand_impl_glIsSync;
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsTexture(GLuint texture) {
+    PFNGLISTEXTUREPROC proc = (PFNGLISTEXTUREPROC) glad_gl_on_demand_loader("glIsTexture");
+    GLAD_GL_ON_DEMAND_STORE(glad_glIsTexture, proc);
+    return proc(texture);
+}
+PFNGLISTEXTUREPROC glad_glIsTexture = glad_on_demand_impl_glIsTexture;
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsTransformFeedback(GLuint id) {
+    PFNGLISTRANSFORMFEEDBACKPROC proc = (PFNGLISTRANSFORMFEEDBACKPROC) glad_gl_on_demand_loader("glIsTransformFeedback");
+    GLAD_GL_ON_DEMAND_STORE(glad_glIsTransformFeedback, proc);
+    return proc(id);
+}
+PFNGLISTRANSFORMFEEDBACKPROC glad_glIsTransformFeedback = glad_on_demand_impl_glIsTransformFeedback;
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsVertexArray(GLuint array) {
+    PFNGLISVERTEXARRAYPROC proc = (PFNGLISVERTEXARRAYPROC) glad_gl_on_demand_loader("glIsVertexArray");
+    GLAD_GL_ON_DEMAND_STORE(glad_glIsVertexArray, proc);
+    return proc(array);
+}
+PFNGLISVERTEXARRAYPROC glad_glIsVertexArray = glad_on_demand_impl_glIsVertexArray;
+static void GLAD_API_PTR glad_on_demand_impl_glLineWidth(GLfloat width) {
+    PFNGLLINEWIDTHPROC proc = (PFNGLLINEWIDTHPROC) glad_gl_on_demand_loader("glLineWidth");
+    GLAD_GL_ON_DEMAND_STORE(glad_glLineWidth, proc);
+    proc(width);
+}
+PFNGLLINEWIDTHPROC glad_glLineWidth = glad_on_demand_impl_glLineWidth;
+static void GLAD_API_PTR glad_on_demand_impl_glLinkProgram(GLuint program) {
+    PFNGLLINKPROGRAMPROC proc = (PFNGLLINKPROGRAMPROC) glad_gl_on_demand_loader("glLinkProgram");
+    GLAD_GL_ON_DEMAND_STORE(glad_glLinkProgram, proc);
+    proc(program);
+}
+PFNGLLINKPROGRAMPROC glad_glLinkProgram = glad_on_demand_impl_glLinkProgram;
+static void GLAD_API_PTR glad_on_demand_impl_glLogicOp(GLenum opcode) {
+    PFNGLLOGICOPPROC proc = (PFNGLLOGICOPPROC) glad_gl_on_demand_loader("glLogicOp");
+    GLAD_GL_ON_DEMAND_STORE(glad_glLogicOp, proc);
+    proc(opcode);
+}
+PFNGLLOGICOPPROC glad_glLogicOp = glad_on_demand_impl_glLogicOp;
+static void * GLAD_API_PTR glad_on_demand_impl_glMapBuffer(GLenum target, GLenum access) {
+    PFNGLMAPBUFFERPROC proc = (PFNGLMAPBUFFERPROC) glad_gl_on_demand_loader("glMapBuffer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glMapBuffer, proc);
+    return proc(target, access);
+}
+PFNGLMAPBUFFERPROC glad_glMapBuffer = glad_on_demand_impl_glMapBuffer;
+static void * GLAD_API_PTR glad_on_demand_impl_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    PFNGLMAPBUFFERRANGEPROC proc = (PFNGLMAPBUFFERRANGEPROC) glad_gl_on_demand_loader("glMapBufferRange");
+    GLAD_GL_ON_DEMAND_STORE(glad_glMapBufferRange, proc);
+    return proc(target, offset, length, access);
+}
+PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = glad_on_demand_impl_glMapBufferRange;
+static void GLAD_API_PTR glad_on_demand_impl_glMaxShaderCompilerThreadsKHR(GLuint count) {
+    PFNGLMAXSHADERCOMPILERTHREADSKHRPROC proc = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC) glad_gl_on_demand_loader("glMaxShaderCompilerThreadsKHR");
+    GLAD_GL_ON_DEMAND_STORE(glad_glMaxShaderCompilerThreadsKHR, proc);
+    proc(count);
+}
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR = glad_on_demand_impl_glMaxShaderCompilerThreadsKHR;
+static void GLAD_API_PTR glad_on_demand_impl_glMemoryBarrier(GLbitfield barriers) {
+    PFNGLMEMORYBARRIERPROC proc = (PFNGLMEMORYBARRIERPROC) glad_gl_on_demand_loader("glMemoryBarrier");
+    GLAD_GL_ON_DEMAND_STORE(glad_glMemoryBarrier, proc);
+    proc(barriers);
+}
+PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier = glad_on_demand_impl_glMemoryBarrier;
+static void GLAD_API_PTR glad_on_demand_impl_glMinSampleShading(GLfloat value) {
+    PFNGLMINSAMPLESHADINGPROC proc = (PFNGLMINSAMPLESHADINGPROC) glad_gl_on_demand_loader("glMinSampleShading");
+    GLAD_GL_ON_DEMAND_STORE(glad_glMinSampleShading, proc);
+    proc(value);
+}
+PFNGLMINSAMPLESHADINGPROC glad_glMinSampleShading = glad_on_demand_impl_glMinSampleShading;
+static void GLAD_API_PTR glad_on_demand_impl_glMultiDrawArrays(GLenum mode, const GLint * first, const GLsizei * count, GLsizei drawcount) {
+    PFNGLMULTIDRAWARRAYSPROC proc = (PFNGLMULTIDRAWARRAYSPROC) glad_gl_on_demand_loader("glMultiDrawArrays");
+    GLAD_GL_ON_DEMAND_STORE(glad_glMultiDrawArrays, proc);
+    proc(mode, first, count, drawcount);
+}
+PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays = glad_on_demand_impl_glMultiDrawArrays;
+static void GLAD_API_PTR glad_on_demand_impl_glMultiDrawArraysIndirect(GLenum mode, const void * indirect, GLsizei drawcount, GLsizei stride) {
+    PFNGLMULTIDRAWARRAYSINDIRECTPROC proc = (PFNGLMULTIDRAWARRAYSINDIRECTPROC) glad_gl_on_demand_loader("glMultiDrawArraysIndirect");
+    GLAD_GL_ON_DEMAND_STORE(glad_glMultiDrawArraysIndirect, proc);
+    proc(mode, indirect, drawcount, stride);
+}
+PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect = glad_on_demand_impl_glMultiDrawArraysIndirect;
+static void GLAD_API_PTR glad_on_demand_impl_glMultiDrawElements(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount) {
+    PFNGLMULTIDRAWELEMENTSPROC proc = (PFNGLMULTIDRAWELEMENTSPROC) glad_gl_on_demand_loader("glMultiDrawElements");
+    GLAD_GL_ON_DEMAND_STORE(glad_glMultiDrawElements, proc);
+    proc(mode, count, type, indices, drawcount);
+}
+PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements = glad_on_demand_impl_glMultiDrawElements;
+static void GLAD_API_PTR glad_on_demand_impl_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount, const GLint * basevertex) {
+    PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC proc = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC) glad_gl_on_demand_loader("glMultiDrawElementsBaseVertex");
+    GLAD_GL_ON_DEMAND_STORE(glad_glMultiDrawElementsBaseVertex, proc);
+    proc(mode, count, type, indices, drawcount, basevertex);
+}
+PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex = glad_on_demand_impl_glMultiDrawElementsBaseVertex;
+static void GLAD_API_PTR glad_on_demand_impl_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void * indirect, GLsizei drawcount, GLsizei stride) {
+    PFNGLMULTIDRAWELEMENTSINDIRECTPROC proc = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC) glad_gl_on_demand_loader("glMultiDrawElementsIndirect");
+    GLAD_GL_ON_DEMAND_STORE(glad_glMultiDrawElementsIndirect, proc);
+    proc(mode, type, indirect, drawcount, stride);
+}
+PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect = glad_on_demand_impl_glMultiDrawElementsIndirect;
+static void GLAD_API_PTR glad_on_demand_impl_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void * data, GLenum usage) {
+    PFNGLNAMEDBUFFERDATAPROC proc = (PFNGLNAMEDBUFFERDATAPROC) glad_gl_on_demand_loader("glNamedBufferData");
+    GLAD_GL_ON_DEMAND_STORE(glad_glNamedBufferData, proc);
+    proc(buffer, size, data, usage);
+}
+PFNGLNAMEDBUFFERDATAPROC glad_glNamedBufferData = glad_on_demand_impl_glNamedBufferData;
+static void GLAD_API_PTR glad_on_demand_impl_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void * data) {
+    PFNGLNAMEDBUFFERSUBDATAPROC proc = (PFNGLNAMEDBUFFERSUBDATAPROC) glad_gl_on_demand_loader("glNamedBufferSubData");
+    GLAD_GL_ON_DEMAND_STORE(glad_glNamedBufferSubData, proc);
+    proc(buffer, offset, size, data);
+}
+PFNGLNAMEDBUFFERSUBDATAPROC glad_glNamedBufferSubData = glad_on_demand_impl_glNamedBufferSubData;
+static void GLAD_API_PTR glad_on_demand_impl_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar * label) {
+    PFNGLOBJECTLABELPROC proc = (PFNGLOBJECTLABELPROC) glad_gl_on_demand_loader("glObjectLabel");
+    GLAD_GL_ON_DEMAND_STORE(glad_glObjectLabel, proc);
+    proc(identifier, name, length, label);
+}
+PFNGLOBJECTLABELPROC glad_glObjectLabel = glad_on_demand_impl_glObjectLabel;
+static void GLAD_API_PTR glad_on_demand_impl_glObjectPtrLabel(const void * ptr, GLsizei length, const GLchar * label) {
+    PFNGLOBJECTPTRLABELPROC proc = (PFNGLOBJECTPTRLABELPROC) glad_gl_on_demand_loader("glObjectPtrLabel");
+    GLAD_GL_ON_DEMAND_STORE(glad_glObjectPtrLabel, proc);
+    proc(ptr, length, label);
+}
+PFNGLOBJECTPTRLABELPROC glad_glObjectPtrLabel = glad_on_demand_impl_glObjectPtrLabel;
+static void GLAD_API_PTR glad_on_demand_impl_glPatchParameterfv(GLenum pname, const GLfloat * values) {
+    PFNGLPATCHPARAMETERFVPROC proc = (PFNGLPATCHPARAMETERFVPROC) glad_gl_on_demand_loader("glPatchParameterfv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glPatchParameterfv, proc);
+    proc(pname, values);
+}
+PFNGLPATCHPARAMETERFVPROC glad_glPatchParameterfv = glad_on_demand_impl_glPatchParameterfv;
+static void GLAD_API_PTR glad_on_demand_impl_glPatchParameteri(GLenum pname, GLint value) {
+    PFNGLPATCHPARAMETERIPROC proc = (PFNGLPATCHPARAMETERIPROC) glad_gl_on_demand_loader("glPatchParameteri");
+    GLAD_GL_ON_DEMAND_STORE(glad_glPatchParameteri, proc);
+    proc(pname, value);
+}
+PFNGLPATCHPARAMETERIPROC glad_glPatchParameteri = glad_on_demand_impl_glPatchParameteri;
+static void GLAD_API_PTR glad_on_demand_impl_glPauseTransformFeedback(void) {
+    PFNGLPAUSETRANSFORMFEEDBACKPROC proc = (PFNGLPAUSETRANSFORMFEEDBACKPROC) glad_gl_on_demand_loader("glPauseTransformFeedback");
+    GLAD_GL_ON_DEMAND_STORE(glad_glPauseTransformFeedback, proc);
+    proc();
+}
+PFNGLPAUSETRANSFORMFEEDBACKPROC glad_glPauseTransformFeedback = glad_on_demand_impl_glPauseTransformFeedback;
+static void GLAD_API_PTR glad_on_demand_impl_glPixelStoref(GLenum pname, GLfloat param) {
+    PFNGLPIXELSTOREFPROC proc = (PFNGLPIXELSTOREFPROC) glad_gl_on_demand_loader("glPixelStoref");
+    GLAD_GL_ON_DEMAND_STORE(glad_glPixelStoref, proc);
+    proc(pname, param);
+}
+PFNGLPIXELSTOREFPROC glad_glPixelStoref = glad_on_demand_impl_glPixelStoref;
+static void GLAD_API_PTR glad_on_demand_impl_glPixelStorei(GLenum pname, GLint param) {
+    PFNGLPIXELSTOREIPROC proc = (PFNGLPIXELSTOREIPROC) glad_gl_on_demand_loader("glPixelStorei");
+    GLAD_GL_ON_DEMAND_STORE(glad_glPixelStorei, proc);
+    proc(pname, param);
+}
+PFNGLPIXELSTOREIPROC glad_glPixelStorei = glad_on_demand_impl_glPixelStorei;
+static void GLAD_API_PTR glad_on_demand_impl_glPointParameterf(GLenum pname, GLfloat param) {
+    PFNGLPOINTPARAMETERFPROC proc = (PFNGLPOINTPARAMETERFPROC) glad_gl_on_demand_loader("glPointParameterf");
+    GLAD_GL_ON_DEMAND_STORE(glad_glPointParameterf, proc);
+    proc(pname, param);
+}
+PFNGLPOINTPARAMETERFPROC glad_glPointParameterf = glad_on_demand_impl_glPointParameterf;
+static void GLAD_API_PTR glad_on_demand_impl_glPointParameterfv(GLenum pname, const GLfloat * params) {
+    PFNGLPOINTPARAMETERFVPROC proc = (PFNGLPOINTPARAMETERFVPROC) glad_gl_on_demand_loader("glPointParameterfv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glPointParameterfv, proc);
+    proc(pname, params);
+}
+PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv = glad_on_demand_impl_glPointParameterfv;
+static void GLAD_API_PTR glad_on_demand_impl_glPointParameteri(GLenum pname, GLint param) {
+    PFNGLPOINTPARAMETERIPROC proc = (PFNGLPOINTPARAMETERIPROC) glad_gl_on_demand_loader("glPointParameteri");
+    GLAD_GL_ON_DEMAND_STORE(glad_glPointParameteri, proc);
+    proc(pname, param);
+}
+PFNGLPOINTPARAMETERIPROC glad_glPointParameteri = glad_on_demand_impl_glPointParameteri;
+static void GLAD_API_PTR glad_on_demand_impl_glPointParameteriv(GLenum pname, const GLint * params) {
+    PFNGLPOINTPARAMETERIVPROC proc = (PFNGLPOINTPARAMETERIVPROC) glad_gl_on_demand_loader("glPointParameteriv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glPointParameteriv, proc);
+    proc(pname, params);
+}
+PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv = glad_on_demand_impl_glPointParameteriv;
+static void GLAD_API_PTR glad_on_demand_impl_glPointSize(GLfloat size) {
+    PFNGLPOINTSIZEPROC proc = (PFNGLPOINTSIZEPROC) glad_gl_on_demand_loader("glPointSize");
+    GLAD_GL_ON_DEMAND_STORE(glad_glPointSize, proc);
+    proc(size);
+}
+PFNGLPOINTSIZEPROC glad_glPointSize = glad_on_demand_impl_glPointSize;
+static void GLAD_API_PTR glad_on_demand_impl_glPolygonMode(GLenum face, GLenum mode) {
+    PFNGLPOLYGONMODEPROC proc = (PFNGLPOLYGONMODEPROC) glad_gl_on_demand_loader("glPolygonMode");
+    GLAD_GL_ON_DEMAND_STORE(glad_glPolygonMode, proc);
+    proc(face, mode);
+}
+PFNGLPOLYGONMODEPROC glad_glPolygonMode = glad_on_demand_impl_glPolygonMode;
+static void GLAD_API_PTR glad_on_demand_impl_glPolygonOffset(GLfloat factor, GLfloat units) {
+    PFNGLPOLYGONOFFSETPROC proc = (PFNGLPOLYGONOFFSETPROC) glad_gl_on_demand_loader("glPolygonOffset");
+    GLAD_GL_ON_DEMAND_STORE(glad_glPolygonOffset, proc);
+    proc(factor, units);
+}
+PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset = glad_on_demand_impl_glPolygonOffset;
+static void GLAD_API_PTR glad_on_demand_impl_glPopDebugGroup(void) {
+    PFNGLPOPDEBUGGROUPPROC proc = (PFNGLPOPDEBUGGROUPPROC) glad_gl_on_demand_loader("glPopDebugGroup");
+    GLAD_GL_ON_DEMAND_STORE(glad_glPopDebugGroup, proc);
+    proc();
+}
+PFNGLPOPDEBUGGROUPPROC glad_glPopDebugGroup = glad_on_demand_impl_glPopDebugGroup;
+static void GLAD_API_PTR glad_on_demand_impl_glPrimitiveRestartIndex(GLuint index) {
+    PFNGLPRIMITIVERESTARTINDEXPROC proc = (PFNGLPRIMITIVERESTARTINDEXPROC) glad_gl_on_demand_loader("glPrimitiveRestartIndex");
+    GLAD_GL_ON_DEMAND_STORE(glad_glPrimitiveRestartIndex, proc);
+    proc(index);
+}
+PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex = glad_on_demand_impl_glPrimitiveRestartIndex;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramBinary(GLuint program, GLenum binaryFormat, const void * binary, GLsizei length) {
+    PFNGLPROGRAMBINARYPROC proc = (PFNGLPROGRAMBINARYPROC) glad_gl_on_demand_loader("glProgramBinary");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramBinary, proc);
+    proc(program, binaryFormat, binary, length);
+}
+PFNGLPROGRAMBINARYPROC glad_glProgramBinary = glad_on_demand_impl_glProgramBinary;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+    PFNGLPROGRAMPARAMETERIPROC proc = (PFNGLPROGRAMPARAMETERIPROC) glad_gl_on_demand_loader("glProgramParameteri");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramParameteri, proc);
+    proc(program, pname, value);
+}
+PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = glad_on_demand_impl_glProgramParameteri;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+    PFNGLPROGRAMUNIFORM1DPROC proc = (PFNGLPROGRAMUNIFORM1DPROC) glad_gl_on_demand_loader("glProgramUniform1d");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform1d, proc);
+    proc(program, location, v0);
+}
+PFNGLPROGRAMUNIFORM1DPROC glad_glProgramUniform1d = glad_on_demand_impl_glProgramUniform1d;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble * value) {
+    PFNGLPROGRAMUNIFORM1DVPROC proc = (PFNGLPROGRAMUNIFORM1DVPROC) glad_gl_on_demand_loader("glProgramUniform1dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform1dv, proc);
+    proc(program, location, count, value);
+}
+PFNGLPROGRAMUNIFORM1DVPROC glad_glProgramUniform1dv = glad_on_demand_impl_glProgramUniform1dv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+    PFNGLPROGRAMUNIFORM1FPROC proc = (PFNGLPROGRAMUNIFORM1FPROC) glad_gl_on_demand_loader("glProgramUniform1f");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform1f, proc);
+    proc(program, location, v0);
+}
+PFNGLPROGRAMUNIFORM1FPROC glad_glProgramUniform1f = glad_on_demand_impl_glProgramUniform1f;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat * value) {
+    PFNGLPROGRAMUNIFORM1FVPROC proc = (PFNGLPROGRAMUNIFORM1FVPROC) glad_gl_on_demand_loader("glProgramUniform1fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform1fv, proc);
+    proc(program, location, count, value);
+}
+PFNGLPROGRAMUNIFORM1FVPROC glad_glProgramUniform1fv = glad_on_demand_impl_glProgramUniform1fv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+    PFNGLPROGRAMUNIFORM1IPROC proc = (PFNGLPROGRAMUNIFORM1IPROC) glad_gl_on_demand_loader("glProgramUniform1i");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform1i, proc);
+    proc(program, location, v0);
+}
+PFNGLPROGRAMUNIFORM1IPROC glad_glProgramUniform1i = glad_on_demand_impl_glProgramUniform1i;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint * value) {
+    PFNGLPROGRAMUNIFORM1IVPROC proc = (PFNGLPROGRAMUNIFORM1IVPROC) glad_gl_on_demand_loader("glProgramUniform1iv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform1iv, proc);
+    proc(program, location, count, value);
+}
+PFNGLPROGRAMUNIFORM1IVPROC glad_glProgramUniform1iv = glad_on_demand_impl_glProgramUniform1iv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+    PFNGLPROGRAMUNIFORM1UIPROC proc = (PFNGLPROGRAMUNIFORM1UIPROC) glad_gl_on_demand_loader("glProgramUniform1ui");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform1ui, proc);
+    proc(program, location, v0);
+}
+PFNGLPROGRAMUNIFORM1UIPROC glad_glProgramUniform1ui = glad_on_demand_impl_glProgramUniform1ui;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint * value) {
+    PFNGLPROGRAMUNIFORM1UIVPROC proc = (PFNGLPROGRAMUNIFORM1UIVPROC) glad_gl_on_demand_loader("glProgramUniform1uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform1uiv, proc);
+    proc(program, location, count, value);
+}
+PFNGLPROGRAMUNIFORM1UIVPROC glad_glProgramUniform1uiv = glad_on_demand_impl_glProgramUniform1uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+    PFNGLPROGRAMUNIFORM2DPROC proc = (PFNGLPROGRAMUNIFORM2DPROC) glad_gl_on_demand_loader("glProgramUniform2d");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform2d, proc);
+    proc(program, location, v0, v1);
+}
+PFNGLPROGRAMUNIFORM2DPROC glad_glProgramUniform2d = glad_on_demand_impl_glProgramUniform2d;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble * value) {
+    PFNGLPROGRAMUNIFORM2DVPROC proc = (PFNGLPROGRAMUNIFORM2DVPROC) glad_gl_on_demand_loader("glProgramUniform2dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform2dv, proc);
+    proc(program, location, count, value);
+}
+PFNGLPROGRAMUNIFORM2DVPROC glad_glProgramUniform2dv = glad_on_demand_impl_glProgramUniform2dv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+    PFNGLPROGRAMUNIFORM2FPROC proc = (PFNGLPROGRAMUNIFORM2FPROC) glad_gl_on_demand_loader("glProgramUniform2f");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform2f, proc);
+    proc(program, location, v0, v1);
+}
+PFNGLPROGRAMUNIFORM2FPROC glad_glProgramUniform2f = glad_on_demand_impl_glProgramUniform2f;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat * value) {
+    PFNGLPROGRAMUNIFORM2FVPROC proc = (PFNGLPROGRAMUNIFORM2FVPROC) glad_gl_on_demand_loader("glProgramUniform2fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform2fv, proc);
+    proc(program, location, count, value);
+}
+PFNGLPROGRAMUNIFORM2FVPROC glad_glProgramUniform2fv = glad_on_demand_impl_glProgramUniform2fv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+    PFNGLPROGRAMUNIFORM2IPROC proc = (PFNGLPROGRAMUNIFORM2IPROC) glad_gl_on_demand_loader("glProgramUniform2i");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform2i, proc);
+    proc(program, location, v0, v1);
+}
+PFNGLPROGRAMUNIFORM2IPROC glad_glProgramUniform2i = glad_on_demand_impl_glProgramUniform2i;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint * value) {
+    PFNGLPROGRAMUNIFORM2IVPROC proc = (PFNGLPROGRAMUNIFORM2IVPROC) glad_gl_on_demand_loader("glProgramUniform2iv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform2iv, proc);
+    proc(program, location, count, value);
+}
+PFNGLPROGRAMUNIFORM2IVPROC glad_glProgramUniform2iv = glad_on_demand_impl_glProgramUniform2iv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+    PFNGLPROGRAMUNIFORM2UIPROC proc = (PFNGLPROGRAMUNIFORM2UIPROC) glad_gl_on_demand_loader("glProgramUniform2ui");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform2ui, proc);
+    proc(program, location, v0, v1);
+}
+PFNGLPROGRAMUNIFORM2UIPROC glad_glProgramUniform2ui = glad_on_demand_impl_glProgramUniform2ui;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint * value) {
+    PFNGLPROGRAMUNIFORM2UIVPROC proc = (PFNGLPROGRAMUNIFORM2UIVPROC) glad_gl_on_demand_loader("glProgramUniform2uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform2uiv, proc);
+    proc(program, location, count, value);
+}
+PFNGLPROGRAMUNIFORM2UIVPROC glad_glProgramUniform2uiv = glad_on_demand_impl_glProgramUniform2uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+    PFNGLPROGRAMUNIFORM3DPROC proc = (PFNGLPROGRAMUNIFORM3DPROC) glad_gl_on_demand_loader("glProgramUniform3d");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform3d, proc);
+    proc(program, location, v0, v1, v2);
+}
+PFNGLPROGRAMUNIFORM3DPROC glad_glProgramUniform3d = glad_on_demand_impl_glProgramUniform3d;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble * value) {
+    PFNGLPROGRAMUNIFORM3DVPROC proc = (PFNGLPROGRAMUNIFORM3DVPROC) glad_gl_on_demand_loader("glProgramUniform3dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform3dv, proc);
+    proc(program, location, count, value);
+}
+PFNGLPROGRAMUNIFORM3DVPROC glad_glProgramUniform3dv = glad_on_demand_impl_glProgramUniform3dv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    PFNGLPROGRAMUNIFORM3FPROC proc = (PFNGLPROGRAMUNIFORM3FPROC) glad_gl_on_demand_loader("glProgramUniform3f");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform3f, proc);
+    proc(program, location, v0, v1, v2);
+}
+PFNGLPROGRAMUNIFORM3FPROC glad_glProgramUniform3f = glad_on_demand_impl_glProgramUniform3f;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat * value) {
+    PFNGLPROGRAMUNIFORM3FVPROC proc = (PFNGLPROGRAMUNIFORM3FVPROC) glad_gl_on_demand_loader("glProgramUniform3fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform3fv, proc);
+    proc(program, location, count, value);
+}
+PFNGLPROGRAMUNIFORM3FVPROC glad_glProgramUniform3fv = glad_on_demand_impl_glProgramUniform3fv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+    PFNGLPROGRAMUNIFORM3IPROC proc = (PFNGLPROGRAMUNIFORM3IPROC) glad_gl_on_demand_loader("glProgramUniform3i");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform3i, proc);
+    proc(program, location, v0, v1, v2);
+}
+PFNGLPROGRAMUNIFORM3IPROC glad_glProgramUniform3i = glad_on_demand_impl_glProgramUniform3i;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint * value) {
+    PFNGLPROGRAMUNIFORM3IVPROC proc = (PFNGLPROGRAMUNIFORM3IVPROC) glad_gl_on_demand_loader("glProgramUniform3iv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform3iv, proc);
+    proc(program, location, count, value);
+}
+PFNGLPROGRAMUNIFORM3IVPROC glad_glProgramUniform3iv = glad_on_demand_impl_glProgramUniform3iv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    PFNGLPROGRAMUNIFORM3UIPROC proc = (PFNGLPROGRAMUNIFORM3UIPROC) glad_gl_on_demand_loader("glProgramUniform3ui");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform3ui, proc);
+    proc(program, location, v0, v1, v2);
+}
+PFNGLPROGRAMUNIFORM3UIPROC glad_glProgramUniform3ui = glad_on_demand_impl_glProgramUniform3ui;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint * value) {
+    PFNGLPROGRAMUNIFORM3UIVPROC proc = (PFNGLPROGRAMUNIFORM3UIVPROC) glad_gl_on_demand_loader("glProgramUniform3uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform3uiv, proc);
+    proc(program, location, count, value);
+}
+PFNGLPROGRAMUNIFORM3UIVPROC glad_glProgramUniform3uiv = glad_on_demand_impl_glProgramUniform3uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+    PFNGLPROGRAMUNIFORM4DPROC proc = (PFNGLPROGRAMUNIFORM4DPROC) glad_gl_on_demand_loader("glProgramUniform4d");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform4d, proc);
+    proc(program, location, v0, v1, v2, v3);
+}
+PFNGLPROGRAMUNIFORM4DPROC glad_glProgramUniform4d = glad_on_demand_impl_glProgramUniform4d;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble * value) {
+    PFNGLPROGRAMUNIFORM4DVPROC proc = (PFNGLPROGRAMUNIFORM4DVPROC) glad_gl_on_demand_loader("glProgramUniform4dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform4dv, proc);
+    proc(program, location, count, value);
+}
+PFNGLPROGRAMUNIFORM4DVPROC glad_glProgramUniform4dv = glad_on_demand_impl_glProgramUniform4dv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    PFNGLPROGRAMUNIFORM4FPROC proc = (PFNGLPROGRAMUNIFORM4FPROC) glad_gl_on_demand_loader("glProgramUniform4f");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform4f, proc);
+    proc(program, location, v0, v1, v2, v3);
+}
+PFNGLPROGRAMUNIFORM4FPROC glad_glProgramUniform4f = glad_on_demand_impl_glProgramUniform4f;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat * value) {
+    PFNGLPROGRAMUNIFORM4FVPROC proc = (PFNGLPROGRAMUNIFORM4FVPROC) glad_gl_on_demand_loader("glProgramUniform4fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform4fv, proc);
+    proc(program, location, count, value);
+}
+PFNGLPROGRAMUNIFORM4FVPROC glad_glProgramUniform4fv = glad_on_demand_impl_glProgramUniform4fv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    PFNGLPROGRAMUNIFORM4IPROC proc = (PFNGLPROGRAMUNIFORM4IPROC) glad_gl_on_demand_loader("glProgramUniform4i");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform4i, proc);
+    proc(program, location, v0, v1, v2, v3);
+}
+PFNGLPROGRAMUNIFORM4IPROC glad_glProgramUniform4i = glad_on_demand_impl_glProgramUniform4i;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint * value) {
+    PFNGLPROGRAMUNIFORM4IVPROC proc = (PFNGLPROGRAMUNIFORM4IVPROC) glad_gl_on_demand_loader("glProgramUniform4iv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform4iv, proc);
+    proc(program, location, count, value);
+}
+PFNGLPROGRAMUNIFORM4IVPROC glad_glProgramUniform4iv = glad_on_demand_impl_glProgramUniform4iv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    PFNGLPROGRAMUNIFORM4UIPROC proc = (PFNGLPROGRAMUNIFORM4UIPROC) glad_gl_on_demand_loader("glProgramUniform4ui");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform4ui, proc);
+    proc(program, location, v0, v1, v2, v3);
+}
+PFNGLPROGRAMUNIFORM4UIPROC glad_glProgramUniform4ui = glad_on_demand_impl_glProgramUniform4ui;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint * value) {
+    PFNGLPROGRAMUNIFORM4UIVPROC proc = (PFNGLPROGRAMUNIFORM4UIVPROC) glad_gl_on_demand_loader("glProgramUniform4uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniform4uiv, proc);
+    proc(program, location, count, value);
+}
+PFNGLPROGRAMUNIFORM4UIVPROC glad_glProgramUniform4uiv = glad_on_demand_impl_glProgramUniform4uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLPROGRAMUNIFORMMATRIX2DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix2dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix2dv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_glProgramUniformMatrix2dv = glad_on_demand_impl_glProgramUniformMatrix2dv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLPROGRAMUNIFORMMATRIX2FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix2fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix2fv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_glProgramUniformMatrix2fv = glad_on_demand_impl_glProgramUniformMatrix2fv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix2x3dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix2x3dv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_glProgramUniformMatrix2x3dv = glad_on_demand_impl_glProgramUniformMatrix2x3dv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix2x3fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix2x3fv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_glProgramUniformMatrix2x3fv = glad_on_demand_impl_glProgramUniformMatrix2x3fv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix2x4dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix2x4dv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_glProgramUniformMatrix2x4dv = glad_on_demand_impl_glProgramUniformMatrix2x4dv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix2x4fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix2x4fv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_glProgramUniformMatrix2x4fv = glad_on_demand_impl_glProgramUniformMatrix2x4fv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLPROGRAMUNIFORMMATRIX3DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix3dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix3dv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_glProgramUniformMatrix3dv = glad_on_demand_impl_glProgramUniformMatrix3dv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLPROGRAMUNIFORMMATRIX3FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix3fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix3fv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_glProgramUniformMatrix3fv = glad_on_demand_impl_glProgramUniformMatrix3fv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix3x2dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix3x2dv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_glProgramUniformMatrix3x2dv = glad_on_demand_impl_glProgramUniformMatrix3x2dv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix3x2fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix3x2fv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_glProgramUniformMatrix3x2fv = glad_on_demand_impl_glProgramUniformMatrix3x2fv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix3x4dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix3x4dv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_glProgramUniformMatrix3x4dv = glad_on_demand_impl_glProgramUniformMatrix3x4dv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix3x4fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix3x4fv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_glProgramUniformMatrix3x4fv = glad_on_demand_impl_glProgramUniformMatrix3x4fv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLPROGRAMUNIFORMMATRIX4DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix4dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix4dv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_glProgramUniformMatrix4dv = glad_on_demand_impl_glProgramUniformMatrix4dv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLPROGRAMUNIFORMMATRIX4FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix4fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix4fv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_glProgramUniformMatrix4fv = glad_on_demand_impl_glProgramUniformMatrix4fv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix4x2dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix4x2dv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_glProgramUniformMatrix4x2dv = glad_on_demand_impl_glProgramUniformMatrix4x2dv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix4x2fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix4x2fv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_glProgramUniformMatrix4x2fv = glad_on_demand_impl_glProgramUniformMatrix4x2fv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix4x3dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix4x3dv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_glProgramUniformMatrix4x3dv = glad_on_demand_impl_glProgramUniformMatrix4x3dv;
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix4x3fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProgramUniformMatrix4x3fv, proc);
+    proc(program, location, count, transpose, value);
+}
+PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_glProgramUniformMatrix4x3fv = glad_on_demand_impl_glProgramUniformMatrix4x3fv;
+static void GLAD_API_PTR glad_on_demand_impl_glProvokingVertex(GLenum mode) {
+    PFNGLPROVOKINGVERTEXPROC proc = (PFNGLPROVOKINGVERTEXPROC) glad_gl_on_demand_loader("glProvokingVertex");
+    GLAD_GL_ON_DEMAND_STORE(glad_glProvokingVertex, proc);
+    proc(mode);
+}
+PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex = glad_on_demand_impl_glProvokingVertex;
+static void GLAD_API_PTR glad_on_demand_impl_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar * message) {
+    PFNGLPUSHDEBUGGROUPPROC proc = (PFNGLPUSHDEBUGGROUPPROC) glad_gl_on_demand_loader("glPushDebugGroup");
+    GLAD_GL_ON_DEMAND_STORE(glad_glPushDebugGroup, proc);
+    proc(source, id, length, message);
+}
+PFNGLPUSHDEBUGGROUPPROC glad_glPushDebugGroup = glad_on_demand_impl_glPushDebugGroup;
+static void GLAD_API_PTR glad_on_demand_impl_glQueryCounter(GLuint id, GLenum target) {
+    PFNGLQUERYCOUNTERPROC proc = (PFNGLQUERYCOUNTERPROC) glad_gl_on_demand_loader("glQueryCounter");
+    GLAD_GL_ON_DEMAND_STORE(glad_glQueryCounter, proc);
+    proc(id, target);
+}
+PFNGLQUERYCOUNTERPROC glad_glQueryCounter = glad_on_demand_impl_glQueryCounter;
+static void GLAD_API_PTR glad_on_demand_impl_glReadBuffer(GLenum src) {
+    PFNGLREADBUFFERPROC proc = (PFNGLREADBUFFERPROC) glad_gl_on_demand_loader("glReadBuffer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glReadBuffer, proc);
+    proc(src);
+}
+PFNGLREADBUFFERPROC glad_glReadBuffer = glad_on_demand_impl_glReadBuffer;
+static void GLAD_API_PTR glad_on_demand_impl_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void * pixels) {
+    PFNGLREADPIXELSPROC proc = (PFNGLREADPIXELSPROC) glad_gl_on_demand_loader("glReadPixels");
+    GLAD_GL_ON_DEMAND_STORE(glad_glReadPixels, proc);
+    proc(x, y, width, height, format, type, pixels);
+}
+PFNGLREADPIXELSPROC glad_glReadPixels = glad_on_demand_impl_glReadPixels;
+static void GLAD_API_PTR glad_on_demand_impl_glReleaseShaderCompiler(void) {
+    PFNGLRELEASESHADERCOMPILERPROC proc = (PFNGLRELEASESHADERCOMPILERPROC) glad_gl_on_demand_loader("glReleaseShaderCompiler");
+    GLAD_GL_ON_DEMAND_STORE(glad_glReleaseShaderCompiler, proc);
+    proc();
+}
+PFNGLRELEASESHADERCOMPILERPROC glad_glReleaseShaderCompiler = glad_on_demand_impl_glReleaseShaderCompiler;
+static void GLAD_API_PTR glad_on_demand_impl_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    PFNGLRENDERBUFFERSTORAGEPROC proc = (PFNGLRENDERBUFFERSTORAGEPROC) glad_gl_on_demand_loader("glRenderbufferStorage");
+    GLAD_GL_ON_DEMAND_STORE(glad_glRenderbufferStorage, proc);
+    proc(target, internalformat, width, height);
+}
+PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage = glad_on_demand_impl_glRenderbufferStorage;
+static void GLAD_API_PTR glad_on_demand_impl_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC proc = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC) glad_gl_on_demand_loader("glRenderbufferStorageMultisample");
+    GLAD_GL_ON_DEMAND_STORE(glad_glRenderbufferStorageMultisample, proc);
+    proc(target, samples, internalformat, width, height);
+}
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample = glad_on_demand_impl_glRenderbufferStorageMultisample;
+static void GLAD_API_PTR glad_on_demand_impl_glResumeTransformFeedback(void) {
+    PFNGLRESUMETRANSFORMFEEDBACKPROC proc = (PFNGLRESUMETRANSFORMFEEDBACKPROC) glad_gl_on_demand_loader("glResumeTransformFeedback");
+    GLAD_GL_ON_DEMAND_STORE(glad_glResumeTransformFeedback, proc);
+    proc();
+}
+PFNGLRESUMETRANSFORMFEEDBACKPROC glad_glResumeTransformFeedback = glad_on_demand_impl_glResumeTransformFeedback;
+static void GLAD_API_PTR glad_on_demand_impl_glSampleCoverage(GLfloat value, GLboolean invert) {
+    PFNGLSAMPLECOVERAGEPROC proc = (PFNGLSAMPLECOVERAGEPROC) glad_gl_on_demand_loader("glSampleCoverage");
+    GLAD_GL_ON_DEMAND_STORE(glad_glSampleCoverage, proc);
+    proc(value, invert);
+}
+PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage = glad_on_demand_impl_glSampleCoverage;
+static void GLAD_API_PTR glad_on_demand_impl_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+    PFNGLSAMPLEMASKIPROC proc = (PFNGLSAMPLEMASKIPROC) glad_gl_on_demand_loader("glSampleMaski");
+    GLAD_GL_ON_DEMAND_STORE(glad_glSampleMaski, proc);
+    proc(maskNumber, mask);
+}
+PFNGLSAMPLEMASKIPROC glad_glSampleMaski = glad_on_demand_impl_glSampleMaski;
+static void GLAD_API_PTR glad_on_demand_impl_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint * param) {
+    PFNGLSAMPLERPARAMETERIIVPROC proc = (PFNGLSAMPLERPARAMETERIIVPROC) glad_gl_on_demand_loader("glSamplerParameterIiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glSamplerParameterIiv, proc);
+    proc(sampler, pname, param);
+}
+PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv = glad_on_demand_impl_glSamplerParameterIiv;
+static void GLAD_API_PTR glad_on_demand_impl_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint * param) {
+    PFNGLSAMPLERPARAMETERIUIVPROC proc = (PFNGLSAMPLERPARAMETERIUIVPROC) glad_gl_on_demand_loader("glSamplerParameterIuiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glSamplerParameterIuiv, proc);
+    proc(sampler, pname, param);
+}
+PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv = glad_on_demand_impl_glSamplerParameterIuiv;
+static void GLAD_API_PTR glad_on_demand_impl_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    PFNGLSAMPLERPARAMETERFPROC proc = (PFNGLSAMPLERPARAMETERFPROC) glad_gl_on_demand_loader("glSamplerParameterf");
+    GLAD_GL_ON_DEMAND_STORE(glad_glSamplerParameterf, proc);
+    proc(sampler, pname, param);
+}
+PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf = glad_on_demand_impl_glSamplerParameterf;
+static void GLAD_API_PTR glad_on_demand_impl_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat * param) {
+    PFNGLSAMPLERPARAMETERFVPROC proc = (PFNGLSAMPLERPARAMETERFVPROC) glad_gl_on_demand_loader("glSamplerParameterfv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glSamplerParameterfv, proc);
+    proc(sampler, pname, param);
+}
+PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv = glad_on_demand_impl_glSamplerParameterfv;
+static void GLAD_API_PTR glad_on_demand_impl_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    PFNGLSAMPLERPARAMETERIPROC proc = (PFNGLSAMPLERPARAMETERIPROC) glad_gl_on_demand_loader("glSamplerParameteri");
+    GLAD_GL_ON_DEMAND_STORE(glad_glSamplerParameteri, proc);
+    proc(sampler, pname, param);
+}
+PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri = glad_on_demand_impl_glSamplerParameteri;
+static void GLAD_API_PTR glad_on_demand_impl_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint * param) {
+    PFNGLSAMPLERPARAMETERIVPROC proc = (PFNGLSAMPLERPARAMETERIVPROC) glad_gl_on_demand_loader("glSamplerParameteriv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glSamplerParameteriv, proc);
+    proc(sampler, pname, param);
+}
+PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv = glad_on_demand_impl_glSamplerParameteriv;
+static void GLAD_API_PTR glad_on_demand_impl_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    PFNGLSCISSORPROC proc = (PFNGLSCISSORPROC) glad_gl_on_demand_loader("glScissor");
+    GLAD_GL_ON_DEMAND_STORE(glad_glScissor, proc);
+    proc(x, y, width, height);
+}
+PFNGLSCISSORPROC glad_glScissor = glad_on_demand_impl_glScissor;
+static void GLAD_API_PTR glad_on_demand_impl_glScissorArrayv(GLuint first, GLsizei count, const GLint * v) {
+    PFNGLSCISSORARRAYVPROC proc = (PFNGLSCISSORARRAYVPROC) glad_gl_on_demand_loader("glScissorArrayv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glScissorArrayv, proc);
+    proc(first, count, v);
+}
+PFNGLSCISSORARRAYVPROC glad_glScissorArrayv = glad_on_demand_impl_glScissorArrayv;
+static void GLAD_API_PTR glad_on_demand_impl_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+    PFNGLSCISSORINDEXEDPROC proc = (PFNGLSCISSORINDEXEDPROC) glad_gl_on_demand_loader("glScissorIndexed");
+    GLAD_GL_ON_DEMAND_STORE(glad_glScissorIndexed, proc);
+    proc(index, left, bottom, width, height);
+}
+PFNGLSCISSORINDEXEDPROC glad_glScissorIndexed = glad_on_demand_impl_glScissorIndexed;
+static void GLAD_API_PTR glad_on_demand_impl_glScissorIndexedv(GLuint index, const GLint * v) {
+    PFNGLSCISSORINDEXEDVPROC proc = (PFNGLSCISSORINDEXEDVPROC) glad_gl_on_demand_loader("glScissorIndexedv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glScissorIndexedv, proc);
+    proc(index, v);
+}
+PFNGLSCISSORINDEXEDVPROC glad_glScissorIndexedv = glad_on_demand_impl_glScissorIndexedv;
+static void GLAD_API_PTR glad_on_demand_impl_glShaderBinary(GLsizei count, const GLuint * shaders, GLenum binaryFormat, const void * binary, GLsizei length) {
+    PFNGLSHADERBINARYPROC proc = (PFNGLSHADERBINARYPROC) glad_gl_on_demand_loader("glShaderBinary");
+    GLAD_GL_ON_DEMAND_STORE(glad_glShaderBinary, proc);
+    proc(count, shaders, binaryFormat, binary, length);
+}
+PFNGLSHADERBINARYPROC glad_glShaderBinary = glad_on_demand_impl_glShaderBinary;
+static void GLAD_API_PTR glad_on_demand_impl_glShaderSource(GLuint shader, GLsizei count, const GLchar *const* string, const GLint * length) {
+    PFNGLSHADERSOURCEPROC proc = (PFNGLSHADERSOURCEPROC) glad_gl_on_demand_loader("glShaderSource");
+    GLAD_GL_ON_DEMAND_STORE(glad_glShaderSource, proc);
+    proc(shader, count, string, length);
+}
+PFNGLSHADERSOURCEPROC glad_glShaderSource = glad_on_demand_impl_glShaderSource;
+static void GLAD_API_PTR glad_on_demand_impl_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+    PFNGLSHADERSTORAGEBLOCKBINDINGPROC proc = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC) glad_gl_on_demand_loader("glShaderStorageBlockBinding");
+    GLAD_GL_ON_DEMAND_STORE(glad_glShaderStorageBlockBinding, proc);
+    proc(program, storageBlockIndex, storageBlockBinding);
+}
+PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_glShaderStorageBlockBinding = glad_on_demand_impl_glShaderStorageBlockBinding;
+static void GLAD_API_PTR glad_on_demand_impl_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+    PFNGLSTENCILFUNCPROC proc = (PFNGLSTENCILFUNCPROC) glad_gl_on_demand_loader("glStencilFunc");
+    GLAD_GL_ON_DEMAND_STORE(glad_glStencilFunc, proc);
+    proc(func, ref, mask);
+}
+PFNGLSTENCILFUNCPROC glad_glStencilFunc = glad_on_demand_impl_glStencilFunc;
+static void GLAD_API_PTR glad_on_demand_impl_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    PFNGLSTENCILFUNCSEPARATEPROC proc = (PFNGLSTENCILFUNCSEPARATEPROC) glad_gl_on_demand_loader("glStencilFuncSeparate");
+    GLAD_GL_ON_DEMAND_STORE(glad_glStencilFuncSeparate, proc);
+    proc(face, func, ref, mask);
+}
+PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate = glad_on_demand_impl_glStencilFuncSeparate;
+static void GLAD_API_PTR glad_on_demand_impl_glStencilMask(GLuint mask) {
+    PFNGLSTENCILMASKPROC proc = (PFNGLSTENCILMASKPROC) glad_gl_on_demand_loader("glStencilMask");
+    GLAD_GL_ON_DEMAND_STORE(glad_glStencilMask, proc);
+    proc(mask);
+}
+PFNGLSTENCILMASKPROC glad_glStencilMask = glad_on_demand_impl_glStencilMask;
+static void GLAD_API_PTR glad_on_demand_impl_glStencilMaskSeparate(GLenum face, GLuint mask) {
+    PFNGLSTENCILMASKSEPARATEPROC proc = (PFNGLSTENCILMASKSEPARATEPROC) glad_gl_on_demand_loader("glStencilMaskSeparate");
+    GLAD_GL_ON_DEMAND_STORE(glad_glStencilMaskSeparate, proc);
+    proc(face, mask);
+}
+PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate = glad_on_demand_impl_glStencilMaskSeparate;
+static void GLAD_API_PTR glad_on_demand_impl_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    PFNGLSTENCILOPPROC proc = (PFNGLSTENCILOPPROC) glad_gl_on_demand_loader("glStencilOp");
+    GLAD_GL_ON_DEMAND_STORE(glad_glStencilOp, proc);
+    proc(fail, zfail, zpass);
+}
+PFNGLSTENCILOPPROC glad_glStencilOp = glad_on_demand_impl_glStencilOp;
+static void GLAD_API_PTR glad_on_demand_impl_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    PFNGLSTENCILOPSEPARATEPROC proc = (PFNGLSTENCILOPSEPARATEPROC) glad_gl_on_demand_loader("glStencilOpSeparate");
+    GLAD_GL_ON_DEMAND_STORE(glad_glStencilOpSeparate, proc);
+    proc(face, sfail, dpfail, dppass);
+}
+PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate = glad_on_demand_impl_glStencilOpSeparate;
+static void GLAD_API_PTR glad_on_demand_impl_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    PFNGLTEXBUFFERPROC proc = (PFNGLTEXBUFFERPROC) glad_gl_on_demand_loader("glTexBuffer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexBuffer, proc);
+    proc(target, internalformat, buffer);
+}
+PFNGLTEXBUFFERPROC glad_glTexBuffer = glad_on_demand_impl_glTexBuffer;
+static void GLAD_API_PTR glad_on_demand_impl_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    PFNGLTEXBUFFERRANGEPROC proc = (PFNGLTEXBUFFERRANGEPROC) glad_gl_on_demand_loader("glTexBufferRange");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexBufferRange, proc);
+    proc(target, internalformat, buffer, offset, size);
+}
+PFNGLTEXBUFFERRANGEPROC glad_glTexBufferRange = glad_on_demand_impl_glTexBufferRange;
+static void GLAD_API_PTR glad_on_demand_impl_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void * pixels) {
+    PFNGLTEXIMAGE1DPROC proc = (PFNGLTEXIMAGE1DPROC) glad_gl_on_demand_loader("glTexImage1D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexImage1D, proc);
+    proc(target, level, internalformat, width, border, format, type, pixels);
+}
+PFNGLTEXIMAGE1DPROC glad_glTexImage1D = glad_on_demand_impl_glTexImage1D;
+static void GLAD_API_PTR glad_on_demand_impl_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void * pixels) {
+    PFNGLTEXIMAGE2DPROC proc = (PFNGLTEXIMAGE2DPROC) glad_gl_on_demand_loader("glTexImage2D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexImage2D, proc);
+    proc(target, level, internalformat, width, height, border, format, type, pixels);
+}
+PFNGLTEXIMAGE2DPROC glad_glTexImage2D = glad_on_demand_impl_glTexImage2D;
+static void GLAD_API_PTR glad_on_demand_impl_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    PFNGLTEXIMAGE2DMULTISAMPLEPROC proc = (PFNGLTEXIMAGE2DMULTISAMPLEPROC) glad_gl_on_demand_loader("glTexImage2DMultisample");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexImage2DMultisample, proc);
+    proc(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample = glad_on_demand_impl_glTexImage2DMultisample;
+static void GLAD_API_PTR glad_on_demand_impl_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void * pixels) {
+    PFNGLTEXIMAGE3DPROC proc = (PFNGLTEXIMAGE3DPROC) glad_gl_on_demand_loader("glTexImage3D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexImage3D, proc);
+    proc(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+PFNGLTEXIMAGE3DPROC glad_glTexImage3D = glad_on_demand_impl_glTexImage3D;
+static void GLAD_API_PTR glad_on_demand_impl_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    PFNGLTEXIMAGE3DMULTISAMPLEPROC proc = (PFNGLTEXIMAGE3DMULTISAMPLEPROC) glad_gl_on_demand_loader("glTexImage3DMultisample");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexImage3DMultisample, proc);
+    proc(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample = glad_on_demand_impl_glTexImage3DMultisample;
+static void GLAD_API_PTR glad_on_demand_impl_glTexParameterIiv(GLenum target, GLenum pname, const GLint * params) {
+    PFNGLTEXPARAMETERIIVPROC proc = (PFNGLTEXPARAMETERIIVPROC) glad_gl_on_demand_loader("glTexParameterIiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexParameterIiv, proc);
+    proc(target, pname, params);
+}
+PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv = glad_on_demand_impl_glTexParameterIiv;
+static void GLAD_API_PTR glad_on_demand_impl_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint * params) {
+    PFNGLTEXPARAMETERIUIVPROC proc = (PFNGLTEXPARAMETERIUIVPROC) glad_gl_on_demand_loader("glTexParameterIuiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexParameterIuiv, proc);
+    proc(target, pname, params);
+}
+PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv = glad_on_demand_impl_glTexParameterIuiv;
+static void GLAD_API_PTR glad_on_demand_impl_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    PFNGLTEXPARAMETERFPROC proc = (PFNGLTEXPARAMETERFPROC) glad_gl_on_demand_loader("glTexParameterf");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexParameterf, proc);
+    proc(target, pname, param);
+}
+PFNGLTEXPARAMETERFPROC glad_glTexParameterf = glad_on_demand_impl_glTexParameterf;
+static void GLAD_API_PTR glad_on_demand_impl_glTexParameterfv(GLenum target, GLenum pname, const GLfloat * params) {
+    PFNGLTEXPARAMETERFVPROC proc = (PFNGLTEXPARAMETERFVPROC) glad_gl_on_demand_loader("glTexParameterfv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexParameterfv, proc);
+    proc(target, pname, params);
+}
+PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv = glad_on_demand_impl_glTexParameterfv;
+static void GLAD_API_PTR glad_on_demand_impl_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+    PFNGLTEXPARAMETERIPROC proc = (PFNGLTEXPARAMETERIPROC) glad_gl_on_demand_loader("glTexParameteri");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexParameteri, proc);
+    proc(target, pname, param);
+}
+PFNGLTEXPARAMETERIPROC glad_glTexParameteri = glad_on_demand_impl_glTexParameteri;
+static void GLAD_API_PTR glad_on_demand_impl_glTexParameteriv(GLenum target, GLenum pname, const GLint * params) {
+    PFNGLTEXPARAMETERIVPROC proc = (PFNGLTEXPARAMETERIVPROC) glad_gl_on_demand_loader("glTexParameteriv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexParameteriv, proc);
+    proc(target, pname, params);
+}
+PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv = glad_on_demand_impl_glTexParameteriv;
+static void GLAD_API_PTR glad_on_demand_impl_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+    PFNGLTEXSTORAGE1DPROC proc = (PFNGLTEXSTORAGE1DPROC) glad_gl_on_demand_loader("glTexStorage1D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexStorage1D, proc);
+    proc(target, levels, internalformat, width);
+}
+PFNGLTEXSTORAGE1DPROC glad_glTexStorage1D = glad_on_demand_impl_glTexStorage1D;
+static void GLAD_API_PTR glad_on_demand_impl_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    PFNGLTEXSTORAGE2DPROC proc = (PFNGLTEXSTORAGE2DPROC) glad_gl_on_demand_loader("glTexStorage2D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexStorage2D, proc);
+    proc(target, levels, internalformat, width, height);
+}
+PFNGLTEXSTORAGE2DPROC glad_glTexStorage2D = glad_on_demand_impl_glTexStorage2D;
+static void GLAD_API_PTR glad_on_demand_impl_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    PFNGLTEXSTORAGE2DMULTISAMPLEPROC proc = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC) glad_gl_on_demand_loader("glTexStorage2DMultisample");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexStorage2DMultisample, proc);
+    proc(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_glTexStorage2DMultisample = glad_on_demand_impl_glTexStorage2DMultisample;
+static void GLAD_API_PTR glad_on_demand_impl_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    PFNGLTEXSTORAGE3DPROC proc = (PFNGLTEXSTORAGE3DPROC) glad_gl_on_demand_loader("glTexStorage3D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexStorage3D, proc);
+    proc(target, levels, internalformat, width, height, depth);
+}
+PFNGLTEXSTORAGE3DPROC glad_glTexStorage3D = glad_on_demand_impl_glTexStorage3D;
+static void GLAD_API_PTR glad_on_demand_impl_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    PFNGLTEXSTORAGE3DMULTISAMPLEPROC proc = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC) glad_gl_on_demand_loader("glTexStorage3DMultisample");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexStorage3DMultisample, proc);
+    proc(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_glTexStorage3DMultisample = glad_on_demand_impl_glTexStorage3DMultisample;
+static void GLAD_API_PTR glad_on_demand_impl_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels) {
+    PFNGLTEXSUBIMAGE1DPROC proc = (PFNGLTEXSUBIMAGE1DPROC) glad_gl_on_demand_loader("glTexSubImage1D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexSubImage1D, proc);
+    proc(target, level, xoffset, width, format, type, pixels);
+}
+PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D = glad_on_demand_impl_glTexSubImage1D;
+static void GLAD_API_PTR glad_on_demand_impl_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels) {
+    PFNGLTEXSUBIMAGE2DPROC proc = (PFNGLTEXSUBIMAGE2DPROC) glad_gl_on_demand_loader("glTexSubImage2D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexSubImage2D, proc);
+    proc(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D = glad_on_demand_impl_glTexSubImage2D;
+static void GLAD_API_PTR glad_on_demand_impl_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels) {
+    PFNGLTEXSUBIMAGE3DPROC proc = (PFNGLTEXSUBIMAGE3DPROC) glad_gl_on_demand_loader("glTexSubImage3D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTexSubImage3D, proc);
+    proc(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D = glad_on_demand_impl_glTexSubImage3D;
+static void GLAD_API_PTR glad_on_demand_impl_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+    PFNGLTEXTUREPARAMETERIPROC proc = (PFNGLTEXTUREPARAMETERIPROC) glad_gl_on_demand_loader("glTextureParameteri");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTextureParameteri, proc);
+    proc(texture, pname, param);
+}
+PFNGLTEXTUREPARAMETERIPROC glad_glTextureParameteri = glad_on_demand_impl_glTextureParameteri;
+static void GLAD_API_PTR glad_on_demand_impl_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    PFNGLTEXTURESTORAGE2DPROC proc = (PFNGLTEXTURESTORAGE2DPROC) glad_gl_on_demand_loader("glTextureStorage2D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTextureStorage2D, proc);
+    proc(texture, levels, internalformat, width, height);
+}
+PFNGLTEXTURESTORAGE2DPROC glad_glTextureStorage2D = glad_on_demand_impl_glTextureStorage2D;
+static void GLAD_API_PTR glad_on_demand_impl_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels) {
+    PFNGLTEXTURESUBIMAGE2DPROC proc = (PFNGLTEXTURESUBIMAGE2DPROC) glad_gl_on_demand_loader("glTextureSubImage2D");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTextureSubImage2D, proc);
+    proc(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+PFNGLTEXTURESUBIMAGE2DPROC glad_glTextureSubImage2D = glad_on_demand_impl_glTextureSubImage2D;
+static void GLAD_API_PTR glad_on_demand_impl_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+    PFNGLTEXTUREVIEWPROC proc = (PFNGLTEXTUREVIEWPROC) glad_gl_on_demand_loader("glTextureView");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTextureView, proc);
+    proc(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+PFNGLTEXTUREVIEWPROC glad_glTextureView = glad_on_demand_impl_glTextureView;
+static void GLAD_API_PTR glad_on_demand_impl_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const* varyings, GLenum bufferMode) {
+    PFNGLTRANSFORMFEEDBACKVARYINGSPROC proc = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC) glad_gl_on_demand_loader("glTransformFeedbackVaryings");
+    GLAD_GL_ON_DEMAND_STORE(glad_glTransformFeedbackVaryings, proc);
+    proc(program, count, varyings, bufferMode);
+}
+PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings = glad_on_demand_impl_glTransformFeedbackVaryings;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform1d(GLint location, GLdouble x) {
+    PFNGLUNIFORM1DPROC proc = (PFNGLUNIFORM1DPROC) glad_gl_on_demand_loader("glUniform1d");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform1d, proc);
+    proc(location, x);
+}
+PFNGLUNIFORM1DPROC glad_glUniform1d = glad_on_demand_impl_glUniform1d;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform1dv(GLint location, GLsizei count, const GLdouble * value) {
+    PFNGLUNIFORM1DVPROC proc = (PFNGLUNIFORM1DVPROC) glad_gl_on_demand_loader("glUniform1dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform1dv, proc);
+    proc(location, count, value);
+}
+PFNGLUNIFORM1DVPROC glad_glUniform1dv = glad_on_demand_impl_glUniform1dv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform1f(GLint location, GLfloat v0) {
+    PFNGLUNIFORM1FPROC proc = (PFNGLUNIFORM1FPROC) glad_gl_on_demand_loader("glUniform1f");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform1f, proc);
+    proc(location, v0);
+}
+PFNGLUNIFORM1FPROC glad_glUniform1f = glad_on_demand_impl_glUniform1f;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform1fv(GLint location, GLsizei count, const GLfloat * value) {
+    PFNGLUNIFORM1FVPROC proc = (PFNGLUNIFORM1FVPROC) glad_gl_on_demand_loader("glUniform1fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform1fv, proc);
+    proc(location, count, value);
+}
+PFNGLUNIFORM1FVPROC glad_glUniform1fv = glad_on_demand_impl_glUniform1fv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform1i(GLint location, GLint v0) {
+    PFNGLUNIFORM1IPROC proc = (PFNGLUNIFORM1IPROC) glad_gl_on_demand_loader("glUniform1i");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform1i, proc);
+    proc(location, v0);
+}
+PFNGLUNIFORM1IPROC glad_glUniform1i = glad_on_demand_impl_glUniform1i;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform1iv(GLint location, GLsizei count, const GLint * value) {
+    PFNGLUNIFORM1IVPROC proc = (PFNGLUNIFORM1IVPROC) glad_gl_on_demand_loader("glUniform1iv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform1iv, proc);
+    proc(location, count, value);
+}
+PFNGLUNIFORM1IVPROC glad_glUniform1iv = glad_on_demand_impl_glUniform1iv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform1ui(GLint location, GLuint v0) {
+    PFNGLUNIFORM1UIPROC proc = (PFNGLUNIFORM1UIPROC) glad_gl_on_demand_loader("glUniform1ui");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform1ui, proc);
+    proc(location, v0);
+}
+PFNGLUNIFORM1UIPROC glad_glUniform1ui = glad_on_demand_impl_glUniform1ui;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform1uiv(GLint location, GLsizei count, const GLuint * value) {
+    PFNGLUNIFORM1UIVPROC proc = (PFNGLUNIFORM1UIVPROC) glad_gl_on_demand_loader("glUniform1uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform1uiv, proc);
+    proc(location, count, value);
+}
+PFNGLUNIFORM1UIVPROC glad_glUniform1uiv = glad_on_demand_impl_glUniform1uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+    PFNGLUNIFORM2DPROC proc = (PFNGLUNIFORM2DPROC) glad_gl_on_demand_loader("glUniform2d");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform2d, proc);
+    proc(location, x, y);
+}
+PFNGLUNIFORM2DPROC glad_glUniform2d = glad_on_demand_impl_glUniform2d;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform2dv(GLint location, GLsizei count, const GLdouble * value) {
+    PFNGLUNIFORM2DVPROC proc = (PFNGLUNIFORM2DVPROC) glad_gl_on_demand_loader("glUniform2dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform2dv, proc);
+    proc(location, count, value);
+}
+PFNGLUNIFORM2DVPROC glad_glUniform2dv = glad_on_demand_impl_glUniform2dv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    PFNGLUNIFORM2FPROC proc = (PFNGLUNIFORM2FPROC) glad_gl_on_demand_loader("glUniform2f");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform2f, proc);
+    proc(location, v0, v1);
+}
+PFNGLUNIFORM2FPROC glad_glUniform2f = glad_on_demand_impl_glUniform2f;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform2fv(GLint location, GLsizei count, const GLfloat * value) {
+    PFNGLUNIFORM2FVPROC proc = (PFNGLUNIFORM2FVPROC) glad_gl_on_demand_loader("glUniform2fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform2fv, proc);
+    proc(location, count, value);
+}
+PFNGLUNIFORM2FVPROC glad_glUniform2fv = glad_on_demand_impl_glUniform2fv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform2i(GLint location, GLint v0, GLint v1) {
+    PFNGLUNIFORM2IPROC proc = (PFNGLUNIFORM2IPROC) glad_gl_on_demand_loader("glUniform2i");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform2i, proc);
+    proc(location, v0, v1);
+}
+PFNGLUNIFORM2IPROC glad_glUniform2i = glad_on_demand_impl_glUniform2i;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform2iv(GLint location, GLsizei count, const GLint * value) {
+    PFNGLUNIFORM2IVPROC proc = (PFNGLUNIFORM2IVPROC) glad_gl_on_demand_loader("glUniform2iv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform2iv, proc);
+    proc(location, count, value);
+}
+PFNGLUNIFORM2IVPROC glad_glUniform2iv = glad_on_demand_impl_glUniform2iv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+    PFNGLUNIFORM2UIPROC proc = (PFNGLUNIFORM2UIPROC) glad_gl_on_demand_loader("glUniform2ui");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform2ui, proc);
+    proc(location, v0, v1);
+}
+PFNGLUNIFORM2UIPROC glad_glUniform2ui = glad_on_demand_impl_glUniform2ui;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform2uiv(GLint location, GLsizei count, const GLuint * value) {
+    PFNGLUNIFORM2UIVPROC proc = (PFNGLUNIFORM2UIVPROC) glad_gl_on_demand_loader("glUniform2uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform2uiv, proc);
+    proc(location, count, value);
+}
+PFNGLUNIFORM2UIVPROC glad_glUniform2uiv = glad_on_demand_impl_glUniform2uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+    PFNGLUNIFORM3DPROC proc = (PFNGLUNIFORM3DPROC) glad_gl_on_demand_loader("glUniform3d");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform3d, proc);
+    proc(location, x, y, z);
+}
+PFNGLUNIFORM3DPROC glad_glUniform3d = glad_on_demand_impl_glUniform3d;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform3dv(GLint location, GLsizei count, const GLdouble * value) {
+    PFNGLUNIFORM3DVPROC proc = (PFNGLUNIFORM3DVPROC) glad_gl_on_demand_loader("glUniform3dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform3dv, proc);
+    proc(location, count, value);
+}
+PFNGLUNIFORM3DVPROC glad_glUniform3dv = glad_on_demand_impl_glUniform3dv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    PFNGLUNIFORM3FPROC proc = (PFNGLUNIFORM3FPROC) glad_gl_on_demand_loader("glUniform3f");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform3f, proc);
+    proc(location, v0, v1, v2);
+}
+PFNGLUNIFORM3FPROC glad_glUniform3f = glad_on_demand_impl_glUniform3f;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform3fv(GLint location, GLsizei count, const GLfloat * value) {
+    PFNGLUNIFORM3FVPROC proc = (PFNGLUNIFORM3FVPROC) glad_gl_on_demand_loader("glUniform3fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform3fv, proc);
+    proc(location, count, value);
+}
+PFNGLUNIFORM3FVPROC glad_glUniform3fv = glad_on_demand_impl_glUniform3fv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    PFNGLUNIFORM3IPROC proc = (PFNGLUNIFORM3IPROC) glad_gl_on_demand_loader("glUniform3i");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform3i, proc);
+    proc(location, v0, v1, v2);
+}
+PFNGLUNIFORM3IPROC glad_glUniform3i = glad_on_demand_impl_glUniform3i;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform3iv(GLint location, GLsizei count, const GLint * value) {
+    PFNGLUNIFORM3IVPROC proc = (PFNGLUNIFORM3IVPROC) glad_gl_on_demand_loader("glUniform3iv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform3iv, proc);
+    proc(location, count, value);
+}
+PFNGLUNIFORM3IVPROC glad_glUniform3iv = glad_on_demand_impl_glUniform3iv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    PFNGLUNIFORM3UIPROC proc = (PFNGLUNIFORM3UIPROC) glad_gl_on_demand_loader("glUniform3ui");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform3ui, proc);
+    proc(location, v0, v1, v2);
+}
+PFNGLUNIFORM3UIPROC glad_glUniform3ui = glad_on_demand_impl_glUniform3ui;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform3uiv(GLint location, GLsizei count, const GLuint * value) {
+    PFNGLUNIFORM3UIVPROC proc = (PFNGLUNIFORM3UIVPROC) glad_gl_on_demand_loader("glUniform3uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform3uiv, proc);
+    proc(location, count, value);
+}
+PFNGLUNIFORM3UIVPROC glad_glUniform3uiv = glad_on_demand_impl_glUniform3uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    PFNGLUNIFORM4DPROC proc = (PFNGLUNIFORM4DPROC) glad_gl_on_demand_loader("glUniform4d");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform4d, proc);
+    proc(location, x, y, z, w);
+}
+PFNGLUNIFORM4DPROC glad_glUniform4d = glad_on_demand_impl_glUniform4d;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform4dv(GLint location, GLsizei count, const GLdouble * value) {
+    PFNGLUNIFORM4DVPROC proc = (PFNGLUNIFORM4DVPROC) glad_gl_on_demand_loader("glUniform4dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform4dv, proc);
+    proc(location, count, value);
+}
+PFNGLUNIFORM4DVPROC glad_glUniform4dv = glad_on_demand_impl_glUniform4dv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    PFNGLUNIFORM4FPROC proc = (PFNGLUNIFORM4FPROC) glad_gl_on_demand_loader("glUniform4f");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform4f, proc);
+    proc(location, v0, v1, v2, v3);
+}
+PFNGLUNIFORM4FPROC glad_glUniform4f = glad_on_demand_impl_glUniform4f;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform4fv(GLint location, GLsizei count, const GLfloat * value) {
+    PFNGLUNIFORM4FVPROC proc = (PFNGLUNIFORM4FVPROC) glad_gl_on_demand_loader("glUniform4fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform4fv, proc);
+    proc(location, count, value);
+}
+PFNGLUNIFORM4FVPROC glad_glUniform4fv = glad_on_demand_impl_glUniform4fv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    PFNGLUNIFORM4IPROC proc = (PFNGLUNIFORM4IPROC) glad_gl_on_demand_loader("glUniform4i");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform4i, proc);
+    proc(location, v0, v1, v2, v3);
+}
+PFNGLUNIFORM4IPROC glad_glUniform4i = glad_on_demand_impl_glUniform4i;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform4iv(GLint location, GLsizei count, const GLint * value) {
+    PFNGLUNIFORM4IVPROC proc = (PFNGLUNIFORM4IVPROC) glad_gl_on_demand_loader("glUniform4iv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform4iv, proc);
+    proc(location, count, value);
+}
+PFNGLUNIFORM4IVPROC glad_glUniform4iv = glad_on_demand_impl_glUniform4iv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    PFNGLUNIFORM4UIPROC proc = (PFNGLUNIFORM4UIPROC) glad_gl_on_demand_loader("glUniform4ui");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform4ui, proc);
+    proc(location, v0, v1, v2, v3);
+}
+PFNGLUNIFORM4UIPROC glad_glUniform4ui = glad_on_demand_impl_glUniform4ui;
+static void GLAD_API_PTR glad_on_demand_impl_glUniform4uiv(GLint location, GLsizei count, const GLuint * value) {
+    PFNGLUNIFORM4UIVPROC proc = (PFNGLUNIFORM4UIVPROC) glad_gl_on_demand_loader("glUniform4uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniform4uiv, proc);
+    proc(location, count, value);
+}
+PFNGLUNIFORM4UIVPROC glad_glUniform4uiv = glad_on_demand_impl_glUniform4uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    PFNGLUNIFORMBLOCKBINDINGPROC proc = (PFNGLUNIFORMBLOCKBINDINGPROC) glad_gl_on_demand_loader("glUniformBlockBinding");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformBlockBinding, proc);
+    proc(program, uniformBlockIndex, uniformBlockBinding);
+}
+PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding = glad_on_demand_impl_glUniformBlockBinding;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLUNIFORMMATRIX2DVPROC proc = (PFNGLUNIFORMMATRIX2DVPROC) glad_gl_on_demand_loader("glUniformMatrix2dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix2dv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX2DVPROC glad_glUniformMatrix2dv = glad_on_demand_impl_glUniformMatrix2dv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLUNIFORMMATRIX2FVPROC proc = (PFNGLUNIFORMMATRIX2FVPROC) glad_gl_on_demand_loader("glUniformMatrix2fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix2fv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv = glad_on_demand_impl_glUniformMatrix2fv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLUNIFORMMATRIX2X3DVPROC proc = (PFNGLUNIFORMMATRIX2X3DVPROC) glad_gl_on_demand_loader("glUniformMatrix2x3dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix2x3dv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX2X3DVPROC glad_glUniformMatrix2x3dv = glad_on_demand_impl_glUniformMatrix2x3dv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLUNIFORMMATRIX2X3FVPROC proc = (PFNGLUNIFORMMATRIX2X3FVPROC) glad_gl_on_demand_loader("glUniformMatrix2x3fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix2x3fv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv = glad_on_demand_impl_glUniformMatrix2x3fv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLUNIFORMMATRIX2X4DVPROC proc = (PFNGLUNIFORMMATRIX2X4DVPROC) glad_gl_on_demand_loader("glUniformMatrix2x4dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix2x4dv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX2X4DVPROC glad_glUniformMatrix2x4dv = glad_on_demand_impl_glUniformMatrix2x4dv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLUNIFORMMATRIX2X4FVPROC proc = (PFNGLUNIFORMMATRIX2X4FVPROC) glad_gl_on_demand_loader("glUniformMatrix2x4fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix2x4fv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv = glad_on_demand_impl_glUniformMatrix2x4fv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLUNIFORMMATRIX3DVPROC proc = (PFNGLUNIFORMMATRIX3DVPROC) glad_gl_on_demand_loader("glUniformMatrix3dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix3dv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX3DVPROC glad_glUniformMatrix3dv = glad_on_demand_impl_glUniformMatrix3dv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLUNIFORMMATRIX3FVPROC proc = (PFNGLUNIFORMMATRIX3FVPROC) glad_gl_on_demand_loader("glUniformMatrix3fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix3fv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv = glad_on_demand_impl_glUniformMatrix3fv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLUNIFORMMATRIX3X2DVPROC proc = (PFNGLUNIFORMMATRIX3X2DVPROC) glad_gl_on_demand_loader("glUniformMatrix3x2dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix3x2dv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX3X2DVPROC glad_glUniformMatrix3x2dv = glad_on_demand_impl_glUniformMatrix3x2dv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLUNIFORMMATRIX3X2FVPROC proc = (PFNGLUNIFORMMATRIX3X2FVPROC) glad_gl_on_demand_loader("glUniformMatrix3x2fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix3x2fv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv = glad_on_demand_impl_glUniformMatrix3x2fv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLUNIFORMMATRIX3X4DVPROC proc = (PFNGLUNIFORMMATRIX3X4DVPROC) glad_gl_on_demand_loader("glUniformMatrix3x4dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix3x4dv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX3X4DVPROC glad_glUniformMatrix3x4dv = glad_on_demand_impl_glUniformMatrix3x4dv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLUNIFORMMATRIX3X4FVPROC proc = (PFNGLUNIFORMMATRIX3X4FVPROC) glad_gl_on_demand_loader("glUniformMatrix3x4fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix3x4fv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv = glad_on_demand_impl_glUniformMatrix3x4fv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLUNIFORMMATRIX4DVPROC proc = (PFNGLUNIFORMMATRIX4DVPROC) glad_gl_on_demand_loader("glUniformMatrix4dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix4dv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX4DVPROC glad_glUniformMatrix4dv = glad_on_demand_impl_glUniformMatrix4dv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLUNIFORMMATRIX4FVPROC proc = (PFNGLUNIFORMMATRIX4FVPROC) glad_gl_on_demand_loader("glUniformMatrix4fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix4fv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv = glad_on_demand_impl_glUniformMatrix4fv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLUNIFORMMATRIX4X2DVPROC proc = (PFNGLUNIFORMMATRIX4X2DVPROC) glad_gl_on_demand_loader("glUniformMatrix4x2dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix4x2dv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX4X2DVPROC glad_glUniformMatrix4x2dv = glad_on_demand_impl_glUniformMatrix4x2dv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLUNIFORMMATRIX4X2FVPROC proc = (PFNGLUNIFORMMATRIX4X2FVPROC) glad_gl_on_demand_loader("glUniformMatrix4x2fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix4x2fv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv = glad_on_demand_impl_glUniformMatrix4x2fv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    PFNGLUNIFORMMATRIX4X3DVPROC proc = (PFNGLUNIFORMMATRIX4X3DVPROC) glad_gl_on_demand_loader("glUniformMatrix4x3dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix4x3dv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX4X3DVPROC glad_glUniformMatrix4x3dv = glad_on_demand_impl_glUniformMatrix4x3dv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    PFNGLUNIFORMMATRIX4X3FVPROC proc = (PFNGLUNIFORMMATRIX4X3FVPROC) glad_gl_on_demand_loader("glUniformMatrix4x3fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformMatrix4x3fv, proc);
+    proc(location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv = glad_on_demand_impl_glUniformMatrix4x3fv;
+static void GLAD_API_PTR glad_on_demand_impl_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint * indices) {
+    PFNGLUNIFORMSUBROUTINESUIVPROC proc = (PFNGLUNIFORMSUBROUTINESUIVPROC) glad_gl_on_demand_loader("glUniformSubroutinesuiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUniformSubroutinesuiv, proc);
+    proc(shadertype, count, indices);
+}
+PFNGLUNIFORMSUBROUTINESUIVPROC glad_glUniformSubroutinesuiv = glad_on_demand_impl_glUniformSubroutinesuiv;
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glUnmapBuffer(GLenum target) {
+    PFNGLUNMAPBUFFERPROC proc = (PFNGLUNMAPBUFFERPROC) glad_gl_on_demand_loader("glUnmapBuffer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUnmapBuffer, proc);
+    return proc(target);
+}
+PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer = glad_on_demand_impl_glUnmapBuffer;
+static void GLAD_API_PTR glad_on_demand_impl_glUseProgram(GLuint program) {
+    PFNGLUSEPROGRAMPROC proc = (PFNGLUSEPROGRAMPROC) glad_gl_on_demand_loader("glUseProgram");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUseProgram, proc);
+    proc(program);
+}
+PFNGLUSEPROGRAMPROC glad_glUseProgram = glad_on_demand_impl_glUseProgram;
+static void GLAD_API_PTR glad_on_demand_impl_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+    PFNGLUSEPROGRAMSTAGESPROC proc = (PFNGLUSEPROGRAMSTAGESPROC) glad_gl_on_demand_loader("glUseProgramStages");
+    GLAD_GL_ON_DEMAND_STORE(glad_glUseProgramStages, proc);
+    proc(pipeline, stages, program);
+}
+PFNGLUSEPROGRAMSTAGESPROC glad_glUseProgramStages = glad_on_demand_impl_glUseProgramStages;
+static void GLAD_API_PTR glad_on_demand_impl_glValidateProgram(GLuint program) {
+    PFNGLVALIDATEPROGRAMPROC proc = (PFNGLVALIDATEPROGRAMPROC) glad_gl_on_demand_loader("glValidateProgram");
+    GLAD_GL_ON_DEMAND_STORE(glad_glValidateProgram, proc);
+    proc(program);
+}
+PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram = glad_on_demand_impl_glValidateProgram;
+static void GLAD_API_PTR glad_on_demand_impl_glValidateProgramPipeline(GLuint pipeline) {
+    PFNGLVALIDATEPROGRAMPIPELINEPROC proc = (PFNGLVALIDATEPROGRAMPIPELINEPROC) glad_gl_on_demand_loader("glValidateProgramPipeline");
+    GLAD_GL_ON_DEMAND_STORE(glad_glValidateProgramPipeline, proc);
+    proc(pipeline);
+}
+PFNGLVALIDATEPROGRAMPIPELINEPROC glad_glValidateProgramPipeline = glad_on_demand_impl_glValidateProgramPipeline;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib1d(GLuint index, GLdouble x) {
+    PFNGLVERTEXATTRIB1DPROC proc = (PFNGLVERTEXATTRIB1DPROC) glad_gl_on_demand_loader("glVertexAttrib1d");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib1d, proc);
+    proc(index, x);
+}
+PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d = glad_on_demand_impl_glVertexAttrib1d;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib1dv(GLuint index, const GLdouble * v) {
+    PFNGLVERTEXATTRIB1DVPROC proc = (PFNGLVERTEXATTRIB1DVPROC) glad_gl_on_demand_loader("glVertexAttrib1dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib1dv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv = glad_on_demand_impl_glVertexAttrib1dv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib1f(GLuint index, GLfloat x) {
+    PFNGLVERTEXATTRIB1FPROC proc = (PFNGLVERTEXATTRIB1FPROC) glad_gl_on_demand_loader("glVertexAttrib1f");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib1f, proc);
+    proc(index, x);
+}
+PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f = glad_on_demand_impl_glVertexAttrib1f;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib1fv(GLuint index, const GLfloat * v) {
+    PFNGLVERTEXATTRIB1FVPROC proc = (PFNGLVERTEXATTRIB1FVPROC) glad_gl_on_demand_loader("glVertexAttrib1fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib1fv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv = glad_on_demand_impl_glVertexAttrib1fv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib1s(GLuint index, GLshort x) {
+    PFNGLVERTEXATTRIB1SPROC proc = (PFNGLVERTEXATTRIB1SPROC) glad_gl_on_demand_loader("glVertexAttrib1s");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib1s, proc);
+    proc(index, x);
+}
+PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s = glad_on_demand_impl_glVertexAttrib1s;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib1sv(GLuint index, const GLshort * v) {
+    PFNGLVERTEXATTRIB1SVPROC proc = (PFNGLVERTEXATTRIB1SVPROC) glad_gl_on_demand_loader("glVertexAttrib1sv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib1sv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv = glad_on_demand_impl_glVertexAttrib1sv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+    PFNGLVERTEXATTRIB2DPROC proc = (PFNGLVERTEXATTRIB2DPROC) glad_gl_on_demand_loader("glVertexAttrib2d");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib2d, proc);
+    proc(index, x, y);
+}
+PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d = glad_on_demand_impl_glVertexAttrib2d;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib2dv(GLuint index, const GLdouble * v) {
+    PFNGLVERTEXATTRIB2DVPROC proc = (PFNGLVERTEXATTRIB2DVPROC) glad_gl_on_demand_loader("glVertexAttrib2dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib2dv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv = glad_on_demand_impl_glVertexAttrib2dv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    PFNGLVERTEXATTRIB2FPROC proc = (PFNGLVERTEXATTRIB2FPROC) glad_gl_on_demand_loader("glVertexAttrib2f");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib2f, proc);
+    proc(index, x, y);
+}
+PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f = glad_on_demand_impl_glVertexAttrib2f;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib2fv(GLuint index, const GLfloat * v) {
+    PFNGLVERTEXATTRIB2FVPROC proc = (PFNGLVERTEXATTRIB2FVPROC) glad_gl_on_demand_loader("glVertexAttrib2fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib2fv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv = glad_on_demand_impl_glVertexAttrib2fv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+    PFNGLVERTEXATTRIB2SPROC proc = (PFNGLVERTEXATTRIB2SPROC) glad_gl_on_demand_loader("glVertexAttrib2s");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib2s, proc);
+    proc(index, x, y);
+}
+PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s = glad_on_demand_impl_glVertexAttrib2s;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib2sv(GLuint index, const GLshort * v) {
+    PFNGLVERTEXATTRIB2SVPROC proc = (PFNGLVERTEXATTRIB2SVPROC) glad_gl_on_demand_loader("glVertexAttrib2sv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib2sv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv = glad_on_demand_impl_glVertexAttrib2sv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    PFNGLVERTEXATTRIB3DPROC proc = (PFNGLVERTEXATTRIB3DPROC) glad_gl_on_demand_loader("glVertexAttrib3d");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib3d, proc);
+    proc(index, x, y, z);
+}
+PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d = glad_on_demand_impl_glVertexAttrib3d;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib3dv(GLuint index, const GLdouble * v) {
+    PFNGLVERTEXATTRIB3DVPROC proc = (PFNGLVERTEXATTRIB3DVPROC) glad_gl_on_demand_loader("glVertexAttrib3dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib3dv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv = glad_on_demand_impl_glVertexAttrib3dv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    PFNGLVERTEXATTRIB3FPROC proc = (PFNGLVERTEXATTRIB3FPROC) glad_gl_on_demand_loader("glVertexAttrib3f");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib3f, proc);
+    proc(index, x, y, z);
+}
+PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f = glad_on_demand_impl_glVertexAttrib3f;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib3fv(GLuint index, const GLfloat * v) {
+    PFNGLVERTEXATTRIB3FVPROC proc = (PFNGLVERTEXATTRIB3FVPROC) glad_gl_on_demand_loader("glVertexAttrib3fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib3fv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv = glad_on_demand_impl_glVertexAttrib3fv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+    PFNGLVERTEXATTRIB3SPROC proc = (PFNGLVERTEXATTRIB3SPROC) glad_gl_on_demand_loader("glVertexAttrib3s");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib3s, proc);
+    proc(index, x, y, z);
+}
+PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s = glad_on_demand_impl_glVertexAttrib3s;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib3sv(GLuint index, const GLshort * v) {
+    PFNGLVERTEXATTRIB3SVPROC proc = (PFNGLVERTEXATTRIB3SVPROC) glad_gl_on_demand_loader("glVertexAttrib3sv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib3sv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv = glad_on_demand_impl_glVertexAttrib3sv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4Nbv(GLuint index, const GLbyte * v) {
+    PFNGLVERTEXATTRIB4NBVPROC proc = (PFNGLVERTEXATTRIB4NBVPROC) glad_gl_on_demand_loader("glVertexAttrib4Nbv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4Nbv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv = glad_on_demand_impl_glVertexAttrib4Nbv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4Niv(GLuint index, const GLint * v) {
+    PFNGLVERTEXATTRIB4NIVPROC proc = (PFNGLVERTEXATTRIB4NIVPROC) glad_gl_on_demand_loader("glVertexAttrib4Niv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4Niv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv = glad_on_demand_impl_glVertexAttrib4Niv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4Nsv(GLuint index, const GLshort * v) {
+    PFNGLVERTEXATTRIB4NSVPROC proc = (PFNGLVERTEXATTRIB4NSVPROC) glad_gl_on_demand_loader("glVertexAttrib4Nsv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4Nsv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv = glad_on_demand_impl_glVertexAttrib4Nsv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+    PFNGLVERTEXATTRIB4NUBPROC proc = (PFNGLVERTEXATTRIB4NUBPROC) glad_gl_on_demand_loader("glVertexAttrib4Nub");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4Nub, proc);
+    proc(index, x, y, z, w);
+}
+PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub = glad_on_demand_impl_glVertexAttrib4Nub;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4Nubv(GLuint index, const GLubyte * v) {
+    PFNGLVERTEXATTRIB4NUBVPROC proc = (PFNGLVERTEXATTRIB4NUBVPROC) glad_gl_on_demand_loader("glVertexAttrib4Nubv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4Nubv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv = glad_on_demand_impl_glVertexAttrib4Nubv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4Nuiv(GLuint index, const GLuint * v) {
+    PFNGLVERTEXATTRIB4NUIVPROC proc = (PFNGLVERTEXATTRIB4NUIVPROC) glad_gl_on_demand_loader("glVertexAttrib4Nuiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4Nuiv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv = glad_on_demand_impl_glVertexAttrib4Nuiv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4Nusv(GLuint index, const GLushort * v) {
+    PFNGLVERTEXATTRIB4NUSVPROC proc = (PFNGLVERTEXATTRIB4NUSVPROC) glad_gl_on_demand_loader("glVertexAttrib4Nusv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4Nusv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv = glad_on_demand_impl_glVertexAttrib4Nusv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4bv(GLuint index, const GLbyte * v) {
+    PFNGLVERTEXATTRIB4BVPROC proc = (PFNGLVERTEXATTRIB4BVPROC) glad_gl_on_demand_loader("glVertexAttrib4bv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4bv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv = glad_on_demand_impl_glVertexAttrib4bv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    PFNGLVERTEXATTRIB4DPROC proc = (PFNGLVERTEXATTRIB4DPROC) glad_gl_on_demand_loader("glVertexAttrib4d");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4d, proc);
+    proc(index, x, y, z, w);
+}
+PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d = glad_on_demand_impl_glVertexAttrib4d;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4dv(GLuint index, const GLdouble * v) {
+    PFNGLVERTEXATTRIB4DVPROC proc = (PFNGLVERTEXATTRIB4DVPROC) glad_gl_on_demand_loader("glVertexAttrib4dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4dv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv = glad_on_demand_impl_glVertexAttrib4dv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    PFNGLVERTEXATTRIB4FPROC proc = (PFNGLVERTEXATTRIB4FPROC) glad_gl_on_demand_loader("glVertexAttrib4f");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4f, proc);
+    proc(index, x, y, z, w);
+}
+PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f = glad_on_demand_impl_glVertexAttrib4f;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4fv(GLuint index, const GLfloat * v) {
+    PFNGLVERTEXATTRIB4FVPROC proc = (PFNGLVERTEXATTRIB4FVPROC) glad_gl_on_demand_loader("glVertexAttrib4fv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4fv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv = glad_on_demand_impl_glVertexAttrib4fv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4iv(GLuint index, const GLint * v) {
+    PFNGLVERTEXATTRIB4IVPROC proc = (PFNGLVERTEXATTRIB4IVPROC) glad_gl_on_demand_loader("glVertexAttrib4iv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4iv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv = glad_on_demand_impl_glVertexAttrib4iv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+    PFNGLVERTEXATTRIB4SPROC proc = (PFNGLVERTEXATTRIB4SPROC) glad_gl_on_demand_loader("glVertexAttrib4s");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4s, proc);
+    proc(index, x, y, z, w);
+}
+PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s = glad_on_demand_impl_glVertexAttrib4s;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4sv(GLuint index, const GLshort * v) {
+    PFNGLVERTEXATTRIB4SVPROC proc = (PFNGLVERTEXATTRIB4SVPROC) glad_gl_on_demand_loader("glVertexAttrib4sv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4sv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv = glad_on_demand_impl_glVertexAttrib4sv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4ubv(GLuint index, const GLubyte * v) {
+    PFNGLVERTEXATTRIB4UBVPROC proc = (PFNGLVERTEXATTRIB4UBVPROC) glad_gl_on_demand_loader("glVertexAttrib4ubv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4ubv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv = glad_on_demand_impl_glVertexAttrib4ubv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4uiv(GLuint index, const GLuint * v) {
+    PFNGLVERTEXATTRIB4UIVPROC proc = (PFNGLVERTEXATTRIB4UIVPROC) glad_gl_on_demand_loader("glVertexAttrib4uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4uiv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv = glad_on_demand_impl_glVertexAttrib4uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4usv(GLuint index, const GLushort * v) {
+    PFNGLVERTEXATTRIB4USVPROC proc = (PFNGLVERTEXATTRIB4USVPROC) glad_gl_on_demand_loader("glVertexAttrib4usv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttrib4usv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv = glad_on_demand_impl_glVertexAttrib4usv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+    PFNGLVERTEXATTRIBBINDINGPROC proc = (PFNGLVERTEXATTRIBBINDINGPROC) glad_gl_on_demand_loader("glVertexAttribBinding");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribBinding, proc);
+    proc(attribindex, bindingindex);
+}
+PFNGLVERTEXATTRIBBINDINGPROC glad_glVertexAttribBinding = glad_on_demand_impl_glVertexAttribBinding;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+    PFNGLVERTEXATTRIBDIVISORPROC proc = (PFNGLVERTEXATTRIBDIVISORPROC) glad_gl_on_demand_loader("glVertexAttribDivisor");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribDivisor, proc);
+    proc(index, divisor);
+}
+PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor = glad_on_demand_impl_glVertexAttribDivisor;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    PFNGLVERTEXATTRIBFORMATPROC proc = (PFNGLVERTEXATTRIBFORMATPROC) glad_gl_on_demand_loader("glVertexAttribFormat");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribFormat, proc);
+    proc(attribindex, size, type, normalized, relativeoffset);
+}
+PFNGLVERTEXATTRIBFORMATPROC glad_glVertexAttribFormat = glad_on_demand_impl_glVertexAttribFormat;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI1i(GLuint index, GLint x) {
+    PFNGLVERTEXATTRIBI1IPROC proc = (PFNGLVERTEXATTRIBI1IPROC) glad_gl_on_demand_loader("glVertexAttribI1i");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI1i, proc);
+    proc(index, x);
+}
+PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i = glad_on_demand_impl_glVertexAttribI1i;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI1iv(GLuint index, const GLint * v) {
+    PFNGLVERTEXATTRIBI1IVPROC proc = (PFNGLVERTEXATTRIBI1IVPROC) glad_gl_on_demand_loader("glVertexAttribI1iv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI1iv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv = glad_on_demand_impl_glVertexAttribI1iv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI1ui(GLuint index, GLuint x) {
+    PFNGLVERTEXATTRIBI1UIPROC proc = (PFNGLVERTEXATTRIBI1UIPROC) glad_gl_on_demand_loader("glVertexAttribI1ui");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI1ui, proc);
+    proc(index, x);
+}
+PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui = glad_on_demand_impl_glVertexAttribI1ui;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI1uiv(GLuint index, const GLuint * v) {
+    PFNGLVERTEXATTRIBI1UIVPROC proc = (PFNGLVERTEXATTRIBI1UIVPROC) glad_gl_on_demand_loader("glVertexAttribI1uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI1uiv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv = glad_on_demand_impl_glVertexAttribI1uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+    PFNGLVERTEXATTRIBI2IPROC proc = (PFNGLVERTEXATTRIBI2IPROC) glad_gl_on_demand_loader("glVertexAttribI2i");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI2i, proc);
+    proc(index, x, y);
+}
+PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i = glad_on_demand_impl_glVertexAttribI2i;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI2iv(GLuint index, const GLint * v) {
+    PFNGLVERTEXATTRIBI2IVPROC proc = (PFNGLVERTEXATTRIBI2IVPROC) glad_gl_on_demand_loader("glVertexAttribI2iv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI2iv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv = glad_on_demand_impl_glVertexAttribI2iv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+    PFNGLVERTEXATTRIBI2UIPROC proc = (PFNGLVERTEXATTRIBI2UIPROC) glad_gl_on_demand_loader("glVertexAttribI2ui");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI2ui, proc);
+    proc(index, x, y);
+}
+PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui = glad_on_demand_impl_glVertexAttribI2ui;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI2uiv(GLuint index, const GLuint * v) {
+    PFNGLVERTEXATTRIBI2UIVPROC proc = (PFNGLVERTEXATTRIBI2UIVPROC) glad_gl_on_demand_loader("glVertexAttribI2uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI2uiv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv = glad_on_demand_impl_glVertexAttribI2uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+    PFNGLVERTEXATTRIBI3IPROC proc = (PFNGLVERTEXATTRIBI3IPROC) glad_gl_on_demand_loader("glVertexAttribI3i");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI3i, proc);
+    proc(index, x, y, z);
+}
+PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i = glad_on_demand_impl_glVertexAttribI3i;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI3iv(GLuint index, const GLint * v) {
+    PFNGLVERTEXATTRIBI3IVPROC proc = (PFNGLVERTEXATTRIBI3IVPROC) glad_gl_on_demand_loader("glVertexAttribI3iv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI3iv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv = glad_on_demand_impl_glVertexAttribI3iv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+    PFNGLVERTEXATTRIBI3UIPROC proc = (PFNGLVERTEXATTRIBI3UIPROC) glad_gl_on_demand_loader("glVertexAttribI3ui");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI3ui, proc);
+    proc(index, x, y, z);
+}
+PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui = glad_on_demand_impl_glVertexAttribI3ui;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI3uiv(GLuint index, const GLuint * v) {
+    PFNGLVERTEXATTRIBI3UIVPROC proc = (PFNGLVERTEXATTRIBI3UIVPROC) glad_gl_on_demand_loader("glVertexAttribI3uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI3uiv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv = glad_on_demand_impl_glVertexAttribI3uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI4bv(GLuint index, const GLbyte * v) {
+    PFNGLVERTEXATTRIBI4BVPROC proc = (PFNGLVERTEXATTRIBI4BVPROC) glad_gl_on_demand_loader("glVertexAttribI4bv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI4bv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv = glad_on_demand_impl_glVertexAttribI4bv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    PFNGLVERTEXATTRIBI4IPROC proc = (PFNGLVERTEXATTRIBI4IPROC) glad_gl_on_demand_loader("glVertexAttribI4i");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI4i, proc);
+    proc(index, x, y, z, w);
+}
+PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i = glad_on_demand_impl_glVertexAttribI4i;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI4iv(GLuint index, const GLint * v) {
+    PFNGLVERTEXATTRIBI4IVPROC proc = (PFNGLVERTEXATTRIBI4IVPROC) glad_gl_on_demand_loader("glVertexAttribI4iv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI4iv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv = glad_on_demand_impl_glVertexAttribI4iv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI4sv(GLuint index, const GLshort * v) {
+    PFNGLVERTEXATTRIBI4SVPROC proc = (PFNGLVERTEXATTRIBI4SVPROC) glad_gl_on_demand_loader("glVertexAttribI4sv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI4sv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv = glad_on_demand_impl_glVertexAttribI4sv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI4ubv(GLuint index, const GLubyte * v) {
+    PFNGLVERTEXATTRIBI4UBVPROC proc = (PFNGLVERTEXATTRIBI4UBVPROC) glad_gl_on_demand_loader("glVertexAttribI4ubv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI4ubv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv = glad_on_demand_impl_glVertexAttribI4ubv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    PFNGLVERTEXATTRIBI4UIPROC proc = (PFNGLVERTEXATTRIBI4UIPROC) glad_gl_on_demand_loader("glVertexAttribI4ui");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI4ui, proc);
+    proc(index, x, y, z, w);
+}
+PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui = glad_on_demand_impl_glVertexAttribI4ui;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI4uiv(GLuint index, const GLuint * v) {
+    PFNGLVERTEXATTRIBI4UIVPROC proc = (PFNGLVERTEXATTRIBI4UIVPROC) glad_gl_on_demand_loader("glVertexAttribI4uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI4uiv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv = glad_on_demand_impl_glVertexAttribI4uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI4usv(GLuint index, const GLushort * v) {
+    PFNGLVERTEXATTRIBI4USVPROC proc = (PFNGLVERTEXATTRIBI4USVPROC) glad_gl_on_demand_loader("glVertexAttribI4usv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribI4usv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv = glad_on_demand_impl_glVertexAttribI4usv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    PFNGLVERTEXATTRIBIFORMATPROC proc = (PFNGLVERTEXATTRIBIFORMATPROC) glad_gl_on_demand_loader("glVertexAttribIFormat");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribIFormat, proc);
+    proc(attribindex, size, type, relativeoffset);
+}
+PFNGLVERTEXATTRIBIFORMATPROC glad_glVertexAttribIFormat = glad_on_demand_impl_glVertexAttribIFormat;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer) {
+    PFNGLVERTEXATTRIBIPOINTERPROC proc = (PFNGLVERTEXATTRIBIPOINTERPROC) glad_gl_on_demand_loader("glVertexAttribIPointer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribIPointer, proc);
+    proc(index, size, type, stride, pointer);
+}
+PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer = glad_on_demand_impl_glVertexAttribIPointer;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribL1d(GLuint index, GLdouble x) {
+    PFNGLVERTEXATTRIBL1DPROC proc = (PFNGLVERTEXATTRIBL1DPROC) glad_gl_on_demand_loader("glVertexAttribL1d");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribL1d, proc);
+    proc(index, x);
+}
+PFNGLVERTEXATTRIBL1DPROC glad_glVertexAttribL1d = glad_on_demand_impl_glVertexAttribL1d;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribL1dv(GLuint index, const GLdouble * v) {
+    PFNGLVERTEXATTRIBL1DVPROC proc = (PFNGLVERTEXATTRIBL1DVPROC) glad_gl_on_demand_loader("glVertexAttribL1dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribL1dv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIBL1DVPROC glad_glVertexAttribL1dv = glad_on_demand_impl_glVertexAttribL1dv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+    PFNGLVERTEXATTRIBL2DPROC proc = (PFNGLVERTEXATTRIBL2DPROC) glad_gl_on_demand_loader("glVertexAttribL2d");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribL2d, proc);
+    proc(index, x, y);
+}
+PFNGLVERTEXATTRIBL2DPROC glad_glVertexAttribL2d = glad_on_demand_impl_glVertexAttribL2d;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribL2dv(GLuint index, const GLdouble * v) {
+    PFNGLVERTEXATTRIBL2DVPROC proc = (PFNGLVERTEXATTRIBL2DVPROC) glad_gl_on_demand_loader("glVertexAttribL2dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribL2dv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIBL2DVPROC glad_glVertexAttribL2dv = glad_on_demand_impl_glVertexAttribL2dv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    PFNGLVERTEXATTRIBL3DPROC proc = (PFNGLVERTEXATTRIBL3DPROC) glad_gl_on_demand_loader("glVertexAttribL3d");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribL3d, proc);
+    proc(index, x, y, z);
+}
+PFNGLVERTEXATTRIBL3DPROC glad_glVertexAttribL3d = glad_on_demand_impl_glVertexAttribL3d;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribL3dv(GLuint index, const GLdouble * v) {
+    PFNGLVERTEXATTRIBL3DVPROC proc = (PFNGLVERTEXATTRIBL3DVPROC) glad_gl_on_demand_loader("glVertexAttribL3dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribL3dv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIBL3DVPROC glad_glVertexAttribL3dv = glad_on_demand_impl_glVertexAttribL3dv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    PFNGLVERTEXATTRIBL4DPROC proc = (PFNGLVERTEXATTRIBL4DPROC) glad_gl_on_demand_loader("glVertexAttribL4d");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribL4d, proc);
+    proc(index, x, y, z, w);
+}
+PFNGLVERTEXATTRIBL4DPROC glad_glVertexAttribL4d = glad_on_demand_impl_glVertexAttribL4d;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribL4dv(GLuint index, const GLdouble * v) {
+    PFNGLVERTEXATTRIBL4DVPROC proc = (PFNGLVERTEXATTRIBL4DVPROC) glad_gl_on_demand_loader("glVertexAttribL4dv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribL4dv, proc);
+    proc(index, v);
+}
+PFNGLVERTEXATTRIBL4DVPROC glad_glVertexAttribL4dv = glad_on_demand_impl_glVertexAttribL4dv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    PFNGLVERTEXATTRIBLFORMATPROC proc = (PFNGLVERTEXATTRIBLFORMATPROC) glad_gl_on_demand_loader("glVertexAttribLFormat");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribLFormat, proc);
+    proc(attribindex, size, type, relativeoffset);
+}
+PFNGLVERTEXATTRIBLFORMATPROC glad_glVertexAttribLFormat = glad_on_demand_impl_glVertexAttribLFormat;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer) {
+    PFNGLVERTEXATTRIBLPOINTERPROC proc = (PFNGLVERTEXATTRIBLPOINTERPROC) glad_gl_on_demand_loader("glVertexAttribLPointer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribLPointer, proc);
+    proc(index, size, type, stride, pointer);
+}
+PFNGLVERTEXATTRIBLPOINTERPROC glad_glVertexAttribLPointer = glad_on_demand_impl_glVertexAttribLPointer;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    PFNGLVERTEXATTRIBP1UIPROC proc = (PFNGLVERTEXATTRIBP1UIPROC) glad_gl_on_demand_loader("glVertexAttribP1ui");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribP1ui, proc);
+    proc(index, type, normalized, value);
+}
+PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui = glad_on_demand_impl_glVertexAttribP1ui;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    PFNGLVERTEXATTRIBP1UIVPROC proc = (PFNGLVERTEXATTRIBP1UIVPROC) glad_gl_on_demand_loader("glVertexAttribP1uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribP1uiv, proc);
+    proc(index, type, normalized, value);
+}
+PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv = glad_on_demand_impl_glVertexAttribP1uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    PFNGLVERTEXATTRIBP2UIPROC proc = (PFNGLVERTEXATTRIBP2UIPROC) glad_gl_on_demand_loader("glVertexAttribP2ui");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribP2ui, proc);
+    proc(index, type, normalized, value);
+}
+PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui = glad_on_demand_impl_glVertexAttribP2ui;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    PFNGLVERTEXATTRIBP2UIVPROC proc = (PFNGLVERTEXATTRIBP2UIVPROC) glad_gl_on_demand_loader("glVertexAttribP2uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribP2uiv, proc);
+    proc(index, type, normalized, value);
+}
+PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv = glad_on_demand_impl_glVertexAttribP2uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    PFNGLVERTEXATTRIBP3UIPROC proc = (PFNGLVERTEXATTRIBP3UIPROC) glad_gl_on_demand_loader("glVertexAttribP3ui");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribP3ui, proc);
+    proc(index, type, normalized, value);
+}
+PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui = glad_on_demand_impl_glVertexAttribP3ui;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    PFNGLVERTEXATTRIBP3UIVPROC proc = (PFNGLVERTEXATTRIBP3UIVPROC) glad_gl_on_demand_loader("glVertexAttribP3uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribP3uiv, proc);
+    proc(index, type, normalized, value);
+}
+PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv = glad_on_demand_impl_glVertexAttribP3uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    PFNGLVERTEXATTRIBP4UIPROC proc = (PFNGLVERTEXATTRIBP4UIPROC) glad_gl_on_demand_loader("glVertexAttribP4ui");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribP4ui, proc);
+    proc(index, type, normalized, value);
+}
+PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui = glad_on_demand_impl_glVertexAttribP4ui;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    PFNGLVERTEXATTRIBP4UIVPROC proc = (PFNGLVERTEXATTRIBP4UIVPROC) glad_gl_on_demand_loader("glVertexAttribP4uiv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribP4uiv, proc);
+    proc(index, type, normalized, value);
+}
+PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv = glad_on_demand_impl_glVertexAttribP4uiv;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer) {
+    PFNGLVERTEXATTRIBPOINTERPROC proc = (PFNGLVERTEXATTRIBPOINTERPROC) glad_gl_on_demand_loader("glVertexAttribPointer");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexAttribPointer, proc);
+    proc(index, size, type, normalized, stride, pointer);
+}
+PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer = glad_on_demand_impl_glVertexAttribPointer;
+static void GLAD_API_PTR glad_on_demand_impl_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+    PFNGLVERTEXBINDINGDIVISORPROC proc = (PFNGLVERTEXBINDINGDIVISORPROC) glad_gl_on_demand_loader("glVertexBindingDivisor");
+    GLAD_GL_ON_DEMAND_STORE(glad_glVertexBindingDivisor, proc);
+    proc(bindingindex, divisor);
+}
+PFNGLVERTEXBINDINGDIVISORPROC glad_glVertexBindingDivisor = glad_on_demand_impl_glVertexBindingDivisor;
+static void GLAD_API_PTR glad_on_demand_impl_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    PFNGLVIEWPORTPROC proc = (PFNGLVIEWPORTPROC) glad_gl_on_demand_loader("glViewport");
+    GLAD_GL_ON_DEMAND_STORE(glad_glViewport, proc);
+    proc(x, y, width, height);
+}
+PFNGLVIEWPORTPROC glad_glViewport = glad_on_demand_impl_glViewport;
+static void GLAD_API_PTR glad_on_demand_impl_glViewportArrayv(GLuint first, GLsizei count, const GLfloat * v) {
+    PFNGLVIEWPORTARRAYVPROC proc = (PFNGLVIEWPORTARRAYVPROC) glad_gl_on_demand_loader("glViewportArrayv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glViewportArrayv, proc);
+    proc(first, count, v);
+}
+PFNGLVIEWPORTARRAYVPROC glad_glViewportArrayv = glad_on_demand_impl_glViewportArrayv;
+static void GLAD_API_PTR glad_on_demand_impl_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+    PFNGLVIEWPORTINDEXEDFPROC proc = (PFNGLVIEWPORTINDEXEDFPROC) glad_gl_on_demand_loader("glViewportIndexedf");
+    GLAD_GL_ON_DEMAND_STORE(glad_glViewportIndexedf, proc);
+    proc(index, x, y, w, h);
+}
+PFNGLVIEWPORTINDEXEDFPROC glad_glViewportIndexedf = glad_on_demand_impl_glViewportIndexedf;
+static void GLAD_API_PTR glad_on_demand_impl_glViewportIndexedfv(GLuint index, const GLfloat * v) {
+    PFNGLVIEWPORTINDEXEDFVPROC proc = (PFNGLVIEWPORTINDEXEDFVPROC) glad_gl_on_demand_loader("glViewportIndexedfv");
+    GLAD_GL_ON_DEMAND_STORE(glad_glViewportIndexedfv, proc);
+    proc(index, v);
+}
+PFNGLVIEWPORTINDEXEDFVPROC glad_glViewportIndexedfv = glad_on_demand_impl_glViewportIndexedfv;
+static void GLAD_API_PTR glad_on_demand_impl_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    PFNGLWAITSYNCPROC proc = (PFNGLWAITSYNCPROC) glad_gl_on_demand_loader("glWaitSync");
+    GLAD_GL_ON_DEMAND_STORE(glad_glWaitSync, proc);
+    proc(sync, flags, timeout);
+}
+PFNGLWAITSYNCPROC glad_glWaitSync = glad_on_demand_impl_glWaitSync;
+#else
 PFNGLACTIVESHADERPROGRAMPROC glad_glActiveShaderProgram = NULL;
 PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
 PFNGLATTACHSHADERPROC glad_glAttachShader = NULL;
@@ -58,6 +3357,7 @@ PFNGLBINDPROGRAMPIPELINEPROC glad_glBindProgramPipeline = NULL;
 PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer = NULL;
 PFNGLBINDSAMPLERPROC glad_glBindSampler = NULL;
 PFNGLBINDTEXTUREPROC glad_glBindTexture = NULL;
+PFNGLBINDTEXTUREUNITPROC glad_glBindTextureUnit = NULL;
 PFNGLBINDTRANSFORMFEEDBACKPROC glad_glBindTransformFeedback = NULL;
 PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray = NULL;
 PFNGLBINDVERTEXBUFFERPROC glad_glBindVertexBuffer = NULL;
@@ -72,6 +3372,7 @@ PFNGLBLENDFUNCSEPARATEIPROC glad_glBlendFuncSeparatei = NULL;
 PFNGLBLENDFUNCIPROC glad_glBlendFunci = NULL;
 PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = NULL;
 PFNGLBUFFERDATAPROC glad_glBufferData = NULL;
+PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = NULL;
 PFNGLBUFFERSUBDATAPROC glad_glBufferSubData = NULL;
 PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = NULL;
 PFNGLCLAMPCOLORPROC glad_glClampColor = NULL;
@@ -103,9 +3404,12 @@ PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D = NULL;
 PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D = NULL;
 PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D = NULL;
 PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D = NULL;
+PFNGLCREATEBUFFERSPROC glad_glCreateBuffers = NULL;
 PFNGLCREATEPROGRAMPROC glad_glCreateProgram = NULL;
 PFNGLCREATESHADERPROC glad_glCreateShader = NULL;
 PFNGLCREATESHADERPROGRAMVPROC glad_glCreateShaderProgramv = NULL;
+PFNGLCREATETEXTURESPROC glad_glCreateTextures = NULL;
+PFNGLCREATEVERTEXARRAYSPROC glad_glCreateVertexArrays = NULL;
 PFNGLCULLFACEPROC glad_glCullFace = NULL;
 PFNGLDEBUGMESSAGECALLBACKPROC glad_glDebugMessageCallback = NULL;
 PFNGLDEBUGMESSAGECONTROLPROC glad_glDebugMessageControl = NULL;
@@ -302,6 +3606,7 @@ PFNGLLINKPROGRAMPROC glad_glLinkProgram = NULL;
 PFNGLLOGICOPPROC glad_glLogicOp = NULL;
 PFNGLMAPBUFFERPROC glad_glMapBuffer = NULL;
 PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = NULL;
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR = NULL;
 PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier = NULL;
 PFNGLMINSAMPLESHADINGPROC glad_glMinSampleShading = NULL;
 PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays = NULL;
@@ -309,6 +3614,8 @@ PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect = NULL;
 PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements = NULL;
 PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex = NULL;
 PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect = NULL;
+PFNGLNAMEDBUFFERDATAPROC glad_glNamedBufferData = NULL;
+PFNGLNAMEDBUFFERSUBDATAPROC glad_glNamedBufferSubData = NULL;
 PFNGLOBJECTLABELPROC glad_glObjectLabel = NULL;
 PFNGLOBJECTPTRLABELPROC glad_glObjectPtrLabel = NULL;
 PFNGLPATCHPARAMETERFVPROC glad_glPatchParameterfv = NULL;
@@ -428,6 +3735,9 @@ PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_glTexStorage3DMultisample = NULL;
 PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D = NULL;
 PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D = NULL;
 PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D = NULL;
+PFNGLTEXTUREPARAMETERIPROC glad_glTextureParameteri = NULL;
+PFNGLTEXTURESTORAGE2DPROC glad_glTextureStorage2D = NULL;
+PFNGLTEXTURESUBIMAGE2DPROC glad_glTextureSubImage2D = NULL;
 PFNGLTEXTUREVIEWPROC glad_glTextureView = NULL;
 PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings = NULL;
 PFNGLUNIFORM1DPROC glad_glUniform1d = NULL;
@@ -573,6 +3883,7 @@ PFNGLVIEWPORTARRAYVPROC glad_glViewportArrayv = NULL;
 PFNGLVIEWPORTINDEXEDFPROC glad_glViewportIndexedf = NULL;
 PFNGLVIEWPORTINDEXEDFVPROC glad_glViewportIndexedfv = NULL;
 PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
+#endif /* GLAD_OPTION_GL_ON_DEMAND */
 
 
 static void glad_gl_load_GL_VERSION_1_0( GLADuserptrloadfunc load, void* userptr) {
@@ -1162,6 +4473,29 @@ static void glad_gl_load_GL_VERSION_4_3( GLADuserptrloadfunc load, void* userptr
     glad_glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC) load(userptr, "glVertexBindingDivisor");
 }
 
+static void glad_gl_load_GL_ARB_buffer_storage( GLADuserptrloadfunc load, void* userptr) {
+    if(!GLAD_GL_ARB_buffer_storage) return;
+    glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC) load(userptr, "glBufferStorage");
+}
+
+static void glad_gl_load_GL_ARB_direct_state_access( GLADuserptrloadfunc load, void* userptr) {
+    if(!GLAD_GL_ARB_direct_state_access) return;
+    glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC) load(userptr, "glBindTextureUnit");
+    glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC) load(userptr, "glCreateBuffers");
+    glad_glCreateTextures = (PFNGLCREATETEXTURESPROC) load(userptr, "glCreateTextures");
+    glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC) load(userptr, "glCreateVertexArrays");
+    glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC) load(userptr, "glNamedBufferData");
+    glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC) load(userptr, "glNamedBufferSubData");
+    glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC) load(userptr, "glTextureParameteri");
+    glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC) load(userptr, "glTextureStorage2D");
+    glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC) load(userptr, "glTextureSubImage2D");
+}
+
+static void glad_gl_load_GL_KHR_parallel_shader_compile( GLADuserptrloadfunc load, void* userptr) {
+    if(!GLAD_GL_KHR_parallel_shader_compile) return;
+    glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC) load(userptr, "glMaxShaderCompilerThreadsKHR");
+}
+
 
 
 #if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
@@ -1268,7 +4602,9 @@ static int glad_gl_find_extensions_gl( int version) {
     char **exts_i = NULL;
     if (!glad_gl_get_extensions(version, &exts, &num_exts_i, &exts_i)) return 0;
 
-    (void) glad_gl_has_extension;
+    GLAD_GL_ARB_buffer_storage = glad_gl_has_extension(version, exts, num_exts_i, exts_i, "GL_ARB_buffer_storage");
+    GLAD_GL_ARB_direct_state_access = glad_gl_has_extension(version, exts, num_exts_i, exts_i, "GL_ARB_direct_state_access");
+    GLAD_GL_KHR_parallel_shader_compile = glad_gl_has_extension(version, exts, num_exts_i, exts_i, "GL_KHR_parallel_shader_compile");
 
     glad_gl_free_extensions(exts_i, num_exts_i);
 
@@ -1327,6 +4663,12 @@ int gladLoadGLUserPtr( GLADuserptrloadfunc load, void *userptr) {
     if(glad_glGetString(GL_VERSION) == NULL) return 0;
     version = glad_gl_find_core_gl();
 
+#ifdef GLAD_OPTION_GL_ON_DEMAND
+    /* Entry points stay stubs and resolve themselves on first call through this loader, */
+    /* userptr has to stay valid as long as any GL function may be called for the first time. */
+    glad_gl_on_demand_load = load;
+    glad_gl_on_demand_userptr = userptr;
+#else
     glad_gl_load_GL_VERSION_1_0(load, userptr);
     glad_gl_load_GL_VERSION_1_1(load, userptr);
     glad_gl_load_GL_VERSION_1_2(load, userptr);
@@ -1343,8 +4685,14 @@ int gladLoadGLUserPtr( GLADuserptrloadfunc load, void *userptr) {
     glad_gl_load_GL_VERSION_4_1(load, userptr);
     glad_gl_load_GL_VERSION_4_2(load, userptr);
     glad_gl_load_GL_VERSION_4_3(load, userptr);
+#endif
 
     if (!glad_gl_find_extensions_gl(version)) return 0;
+#ifndef GLAD_OPTION_GL_ON_DEMAND
+    glad_gl_load_GL_ARB_buffer_storage(load, userptr);
+    glad_gl_load_GL_ARB_direct_state_access(load, userptr);
+    glad_gl_load_GL_KHR_parallel_shader_compile(load, userptr);
+#endif
 
 
 
@@ -1499,7 +4847,12 @@ int gladLoaderLoadGL(void) {
     int version = 0;
     void *handle;
     int did_load = 0;
+#ifdef GLAD_OPTION_GL_ON_DEMAND
+    /* Used by on demand loader after this returns, library is kept open until gladLoaderUnloadGL() */
+    static struct _glad_gl_userptr userptr;
+#else
     struct _glad_gl_userptr userptr;
+#endif
 
     did_load = _gl_handle == NULL;
     handle = glad_gl_dlopen_handle();
@@ -1508,9 +4861,11 @@ int gladLoaderLoadGL(void) {
 
         version = gladLoadGLUserPtr(glad_gl_get_proc, &userptr);
 
+#ifndef GLAD_OPTION_GL_ON_DEMAND
         if (did_load) {
             gladLoaderUnloadGL();
         }
+#endif
     }
 
     return version;
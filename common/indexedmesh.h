@@ -0,0 +1,264 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+
+// Size of FIFO post-transform cache used for triangle reordering and ACMR reports. Real GPUs differ
+// (and many don't use strict FIFO), but order optimized for 16 entries does well on all of them.
+#define INDEXED_MESH_CACHE_SIZE 16
+
+// Triangle list turned into unique vertices and index buffer, prepared for drawing with indexed draws.
+// Vertices are arbitrary runs of floats (vertexFloats per vertex), two vertices are the same only when
+// all their floats are bitwise equal.
+typedef struct IndexedMesh {
+    float* vertices;
+    uint32_t vertexCount;
+    uint32_t vertexFloats;
+    uint32_t* indices;
+    uint32_t indexCount;
+} IndexedMesh;
+
+// Average cache miss ratio - vertex shader invocations per triangle, with FIFO cache of given size.
+// Non-indexed triangles always get 3.0, every triangle sharing all vertices with cached ones would be 0.0
+// (the lower limit for closed meshes is about 0.5).
+inline static float computeACMR(const uint32_t* indices, uint32_t indexCount, uint32_t vertexCount, uint32_t cacheSize) {
+    if (indexCount < 3) {
+        return 0.f;
+    }
+
+    // Vertex is in the cache while fewer than cacheSize misses happened since it was inserted
+    uint32_t* insertedAt = (uint32_t*) malloc(vertexCount * sizeof(uint32_t));
+    bool* cached = (bool*) calloc(vertexCount, sizeof(bool));
+    uint32_t misses = 0;
+    for (uint32_t i = 0; i < indexCount; i++) {
+        uint32_t vertex = indices[i];
+        if (!cached[vertex] || misses - insertedAt[vertex] >= cacheSize) {
+            cached[vertex] = true;
+            insertedAt[vertex] = misses++;
+        }
+    }
+    free(insertedAt);
+    free(cached);
+
+    return (float) misses / (float) (indexCount / 3);
+}
+
+// FNV-1a over vertex bytes
+inline static uint32_t hashMeshVertex(const float* vertex, uint32_t vertexFloats) {
+    const unsigned char* bytes = (const unsigned char*) vertex;
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < vertexFloats * sizeof(float); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+
+    return hash;
+}
+
+// Welds duplicate vertices of triangle list (e.g. cube corners shared by several triangles) and builds
+// index buffer referencing them. Unique vertices are looked up in open addressing hash table.
+inline static void weldMeshVertices(IndexedMesh* mesh, const float* vertices, uint32_t vertexCount, uint32_t vertexFloats) {
+    size_t vertexSize = vertexFloats * sizeof(float);
+    mesh->vertexFloats = vertexFloats;
+    mesh->vertices = (float*) malloc(vertexCount * vertexSize);
+    mesh->vertexCount = 0;
+    mesh->indices = (uint32_t*) malloc(vertexCount * sizeof(uint32_t));
+    mesh->indexCount = vertexCount;
+
+    uint32_t tableSize = 1;
+    while (tableSize < vertexCount * 2) {
+        tableSize <<= 1;
+    }
+    uint32_t* table = (uint32_t*) malloc(tableSize * sizeof(uint32_t));
+    memset(table, 0xFF, tableSize * sizeof(uint32_t)); // UINT32_MAX - empty slot
+
+    for (uint32_t i = 0; i < vertexCount; i++) {
+        const float* vertex = &vertices[i * vertexFloats];
+        uint32_t slot = hashMeshVertex(vertex, vertexFloats) & (tableSize - 1);
+        while (table[slot] != UINT32_MAX && memcmp(&mesh->vertices[table[slot] * vertexFloats], vertex, vertexSize) != 0) {
+            slot = (slot + 1) & (tableSize - 1);
+        }
+        if (table[slot] == UINT32_MAX) {
+            table[slot] = mesh->vertexCount;
+            memcpy(&mesh->vertices[mesh->vertexCount * vertexFloats], vertex, vertexSize);
+            mesh->vertexCount++;
+        }
+        mesh->indices[i] = table[slot];
+    }
+    free(table);
+}
+
+// Picks vertex to fan around next: the one among vertices of just emitted triangles, which still has
+// triangles left and will be in the cache when they are emitted. Falls back to recently used vertices
+// with triangles left (dead-end stack) and then to the next vertex in input order.
+inline static int32_t nextFanningVertex(const uint32_t* candidates, uint32_t candidateCount, const uint32_t* liveTriangles,
+    const uint32_t* cacheTime, uint32_t time, uint32_t cacheSize, uint32_t* deadEnd, uint32_t* deadEndCount,
+    uint32_t* cursor, uint32_t vertexCount) {
+    int32_t best = -1;
+    int64_t bestPriority = -1;
+    for (uint32_t i = 0; i < candidateCount; i++) {
+        uint32_t vertex = candidates[i];
+        if (liveTriangles[vertex] == 0) {
+            continue;
+        }
+        // Vertex which would drop out of the cache while its fan is emitted gets the lowest priority
+        int64_t priority = 0;
+        if (time - cacheTime[vertex] + 2 * liveTriangles[vertex] <= cacheSize) {
+            priority = time - cacheTime[vertex];
+        }
+        if (priority > bestPriority) {
+            best = (int32_t) vertex;
+            bestPriority = priority;
+        }
+    }
+    if (best >= 0) {
+        return best;
+    }
+
+    while (*deadEndCount > 0) {
+        uint32_t vertex = deadEnd[--(*deadEndCount)];
+        if (liveTriangles[vertex] > 0) {
+            return (int32_t) vertex;
+        }
+    }
+    while (*cursor < vertexCount) {
+        if (liveTriangles[*cursor] > 0) {
+            return (int32_t) *cursor;
+        }
+        (*cursor)++;
+    }
+
+    return -1;
+}
+
+// Reorders triangles for post-transform cache hits with Tipsify (Sander, Nehab, Barczak: "Fast Triangle
+// Reordering for Vertex Locality and Reduced Overdraw"). Triangles are emitted in fans around one vertex
+// at a time, and the next fan is centered on a vertex which is still in the cache. Runs in linear time.
+inline static void optimizeVertexCache(IndexedMesh* mesh, uint32_t cacheSize) {
+    uint32_t vertexCount = mesh->vertexCount;
+    uint32_t triangleCount = mesh->indexCount / 3;
+
+    // Triangles of every vertex, packed one vertex after another
+    uint32_t* liveTriangles = (uint32_t*) calloc(vertexCount, sizeof(uint32_t));
+    uint32_t* adjacencyOffsets = (uint32_t*) malloc((vertexCount + 1) * sizeof(uint32_t));
+    uint32_t* adjacency = (uint32_t*) malloc(triangleCount * 3 * sizeof(uint32_t));
+    for (uint32_t i = 0; i < triangleCount * 3; i++) {
+        liveTriangles[mesh->indices[i]]++;
+    }
+    adjacencyOffsets[0] = 0;
+    for (uint32_t i = 0; i < vertexCount; i++) {
+        adjacencyOffsets[i + 1] = adjacencyOffsets[i] + liveTriangles[i];
+    }
+    uint32_t* adjacencyFill = (uint32_t*) malloc(vertexCount * sizeof(uint32_t));
+    memcpy(adjacencyFill, adjacencyOffsets, vertexCount * sizeof(uint32_t));
+    for (uint32_t i = 0; i < triangleCount * 3; i++) {
+        adjacency[adjacencyFill[mesh->indices[i]]++] = i / 3;
+    }
+    free(adjacencyFill);
+
+    uint32_t* cacheTime = (uint32_t*) calloc(vertexCount, sizeof(uint32_t));
+    uint32_t* deadEnd = (uint32_t*) malloc(triangleCount * 3 * sizeof(uint32_t));
+    uint32_t* candidates = (uint32_t*) malloc(triangleCount * 3 * sizeof(uint32_t));
+    bool* emitted = (bool*) calloc(triangleCount, sizeof(bool));
+    uint32_t* output = (uint32_t*) malloc(triangleCount * 3 * sizeof(uint32_t));
+    uint32_t outputCount = 0, deadEndCount = 0, cursor = 1;
+    uint32_t time = cacheSize + 1;
+
+    int32_t fanning = vertexCount > 0 ? 0 : -1;
+    while (fanning >= 0) {
+        uint32_t candidateCount = 0;
+        for (uint32_t i = adjacencyOffsets[fanning]; i < adjacencyOffsets[fanning + 1]; i++) {
+            uint32_t triangle = adjacency[i];
+            if (emitted[triangle]) {
+                continue;
+            }
+            for (uint32_t j = 0; j < 3; j++) {
+                uint32_t vertex = mesh->indices[triangle * 3 + j];
+                output[outputCount++] = vertex;
+                deadEnd[deadEndCount++] = vertex;
+                candidates[candidateCount++] = vertex;
+                liveTriangles[vertex]--;
+                if (time - cacheTime[vertex] > cacheSize) {
+                    cacheTime[vertex] = time++;
+                }
+            }
+            emitted[triangle] = true;
+        }
+        fanning = nextFanningVertex(candidates, candidateCount, liveTriangles, cacheTime, time, cacheSize,
+            deadEnd, &deadEndCount, &cursor, vertexCount);
+    }
+
+    memcpy(mesh->indices, output, outputCount * sizeof(uint32_t));
+    free(liveTriangles);
+    free(adjacencyOffsets);
+    free(adjacency);
+    free(cacheTime);
+    free(deadEnd);
+    free(candidates);
+    free(emitted);
+    free(output);
+}
+
+// Reorders vertices to the order in which indices first reference them, so vertex fetches walk
+// through memory mostly forward. Vertices no triangle uses are dropped.
+inline static void optimizeVertexFetch(IndexedMesh* mesh) {
+    size_t vertexSize = mesh->vertexFloats * sizeof(float);
+    uint32_t* remap = (uint32_t*) malloc(mesh->vertexCount * sizeof(uint32_t));
+    memset(remap, 0xFF, mesh->vertexCount * sizeof(uint32_t));
+    float* vertices = (float*) malloc(mesh->vertexCount * vertexSize);
+
+    uint32_t vertexCount = 0;
+    for (uint32_t i = 0; i < mesh->indexCount; i++) {
+        uint32_t vertex = mesh->indices[i];
+        if (remap[vertex] == UINT32_MAX) {
+            remap[vertex] = vertexCount;
+            memcpy(&vertices[vertexCount * mesh->vertexFloats], &mesh->vertices[vertex * mesh->vertexFloats], vertexSize);
+            vertexCount++;
+        }
+        mesh->indices[i] = remap[vertex];
+    }
+
+    free(remap);
+    free(mesh->vertices);
+    mesh->vertices = vertices;
+    mesh->vertexCount = vertexCount;
+}
+
+// Welds, reorders triangles for vertex cache and vertices for fetch locality. Logs vertex shader
+// invocations per triangle (ACMR) before and after.
+inline static void buildIndexedMesh(IndexedMesh* mesh, const float* vertices, uint32_t vertexCount, uint32_t vertexFloats) {
+    weldMeshVertices(mesh, vertices, vertexCount, vertexFloats);
+    float weldedACMR = computeACMR(mesh->indices, mesh->indexCount, mesh->vertexCount, INDEXED_MESH_CACHE_SIZE);
+    optimizeVertexCache(mesh, INDEXED_MESH_CACHE_SIZE);
+    optimizeVertexFetch(mesh);
+    float optimizedACMR = computeACMR(mesh->indices, mesh->indexCount, mesh->vertexCount, INDEXED_MESH_CACHE_SIZE);
+
+    LOG3DHW("[indexedmesh] Built indexed mesh (%d -> %d vertices, %d indices), ACMR: 3.00 non-indexed, %.2f welded, %.2f optimized",
+        vertexCount, mesh->vertexCount, mesh->indexCount, weldedACMR, optimizedACMR);
+}
+
+// Meshes with up to 65536 vertices are drawn with 16 bit indices, which halves index fetch traffic
+inline static uint32_t indexedMeshIndexSize(const IndexedMesh* mesh) {
+    return mesh->vertexCount <= 65536 ? sizeof(uint16_t) : sizeof(uint32_t);
+}
+
+// Writes indexCount indices of indexedMeshIndexSize() bytes each
+inline static void writeIndexedMeshIndices(const IndexedMesh* mesh, void* destination) {
+    if (indexedMeshIndexSize(mesh) == sizeof(uint16_t)) {
+        uint16_t* indices = (uint16_t*) destination;
+        for (uint32_t i = 0; i < mesh->indexCount; i++) {
+            indices[i] = (uint16_t) mesh->indices[i];
+        }
+    } else {
+        memcpy(destination, mesh->indices, mesh->indexCount * sizeof(uint32_t));
+    }
+}
+
+inline static void destroyIndexedMesh(IndexedMesh* mesh) {
+    free(mesh->vertices);
+    free(mesh->indices);
+    memset(mesh, 0, sizeof(IndexedMesh));
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <stdlib.h>
+
+// Minimal thread, mutex and condition variable wrappers shared by all examples.
+// Win32 API is used on Windows, POSIX threads everywhere else.
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+
+typedef HANDLE Thread;
+typedef CRITICAL_SECTION Mutex;
+typedef CONDITION_VARIABLE CondVar;
+#else
+#include <pthread.h>
+
+typedef pthread_t Thread;
+typedef pthread_mutex_t Mutex;
+typedef pthread_cond_t CondVar;
+#endif
+
+typedef void (*ThreadFunction)(void* userData);
+
+typedef struct ThreadStart {
+    ThreadFunction function;
+    void* userData;
+} ThreadStart;
+
+// Both platforms expect different thread entry point signatures, so we start every thread
+// through this trampoline, which unpacks ThreadStart and calls our function.
+#ifdef _WIN32
+static DWORD WINAPI threadTrampoline(LPVOID param) {
+#else
+static void* threadTrampoline(void* param) {
+#endif
+    ThreadStart start = *(ThreadStart*) param;
+    free(param);
+
+    start.function(start.userData);
+
+#ifdef _WIN32
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+inline static int createThread(Thread* thread, ThreadFunction function, void* userData) {
+    ThreadStart* start = (ThreadStart*) malloc(sizeof(ThreadStart));
+    start->function = function;
+    start->userData = userData;
+
+#ifdef _WIN32
+    *thread = CreateThread(NULL, 0, threadTrampoline, start, 0, NULL);
+    return *thread != NULL;
+#else
+    return pthread_create(thread, NULL, threadTrampoline, start) == 0;
+#endif
+}
+
+inline static void joinThread(Thread thread) {
+#ifdef _WIN32
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+#else
+    pthread_join(thread, NULL);
+#endif
+}
+
+inline static void initMutex(Mutex* mutex) {
+#ifdef _WIN32
+    InitializeCriticalSection(mutex);
+#else
+    pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+inline static void destroyMutex(Mutex* mutex) {
+#ifdef _WIN32
+    DeleteCriticalSection(mutex);
+#else
+    pthread_mutex_destroy(mutex);
+#endif
+}
+
+inline static void lockMutex(Mutex* mutex) {
+#ifdef _WIN32
+    EnterCriticalSection(mutex);
+#else
+    pthread_mutex_lock(mutex);
+#endif
+}
+
+inline static void unlockMutex(Mutex* mutex) {
+#ifdef _WIN32
+    LeaveCriticalSection(mutex);
+#else
+    pthread_mutex_unlock(mutex);
+#endif
+}
+
+inline static void initCondVar(CondVar* condVar) {
+#ifdef _WIN32
+    InitializeConditionVariable(condVar);
+#else
+    pthread_cond_init(condVar, NULL);
+#endif
+}
+
+inline static void destroyCondVar(CondVar* condVar) {
+#ifdef _WIN32
+    // Win32 condition variables don't need to be destroyed
+    (void) condVar;
+#else
+    pthread_cond_destroy(condVar);
+#endif
+}
+
+// Mutex has to be locked by the caller; it's released while waiting and locked again before returning
+inline static void waitCondVar(CondVar* condVar, Mutex* mutex) {
+#ifdef _WIN32
+    SleepConditionVariableCS(condVar, mutex, INFINITE);
+#else
+    pthread_cond_wait(condVar, mutex);
+#endif
+}
+
+inline static void signalCondVar(CondVar* condVar) {
+#ifdef _WIN32
+    WakeConditionVariable(condVar);
+#else
+    pthread_cond_signal(condVar);
+#endif
+}
+
+inline static void broadcastCondVar(CondVar* condVar) {
+#ifdef _WIN32
+    WakeAllConditionVariable(condVar);
+#else
+    pthread_cond_broadcast(condVar);
+#endif
+}
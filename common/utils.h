@@ -12,14 +12,33 @@
 
 #define M_PI 3.14159265358979323846
 
+#define ARRAY_SIZE(arr) (sizeof(arr) / sizeof((arr)[0]))
+
 inline static int clampi(int val, int min, int max) {
     const int t = val < min ? min : val;
     
     return t > max ? max : t;
 }
 
-#ifndef _WIN32
+// Milliseconds from arbitrary point in the past, for measuring durations. Monotonic clock isn't affected
+// by system time changes, unlike wall clock (time(), timespec_get() with TIME_UTC).
+#ifdef _WIN32
+inline static double monotonicMilliseconds(void) {
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    return (double) counter.QuadPart * 1000.0 / (double) frequency.QuadPart;
+}
+#else
 #include <time.h>
+inline static double monotonicMilliseconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &now); // same raw hardware timer as used for frame delta time
+
+    return (double) now.tv_sec * 1000.0 + (double) now.tv_nsec / 1.0e6;
+}
+
 // Calculate nanoseconds difference between two clock_gettime() results
 inline static long nanosecDiff(struct timespec start, struct timespec end) {
     if ((end.tv_nsec - start.tv_nsec) < 0) {
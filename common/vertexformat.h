@@ -0,0 +1,210 @@
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+// Layout of vertices in vertex buffer, shared by both backends - OpenGL turns it into glVertexAttribPointer()
+// calls (applyVertexFormat(), opengl/src/mesh.c), Vulkan into binding and attribute descriptions
+// (fillVertexInputDescriptions(), vulkan/src/pipeline.c). Source vertices are always floats, they are
+// encoded into the format with encodeVertices().
+#define VERTEX_FORMAT_MAX_ATTRIBUTES 4
+
+typedef enum VertexEncoding {
+    VERTEX_ENCODING_FLOAT32,
+    VERTEX_ENCODING_HALF_FLOAT,
+    VERTEX_ENCODING_SNORM16, // [-1, 1], positions are mapped into it with per-mesh scale and bias
+    VERTEX_ENCODING_UNORM16, // [0, 1], e.g. texture coords
+    VERTEX_ENCODING_OCTAHEDRAL_SNORM16 // unit vector (normal) folded onto octahedron, stored as 2 components
+} VertexEncoding;
+
+typedef enum VertexSemantic {
+    VERTEX_SEMANTIC_POSITION,
+    VERTEX_SEMANTIC_TEX_COORDS,
+    VERTEX_SEMANTIC_NORMAL
+} VertexSemantic;
+
+typedef struct VertexAttribute {
+    uint32_t location; // shader input location
+    VertexSemantic semantic;
+    VertexEncoding encoding;
+    uint32_t components; // in source vertex
+    uint32_t sourceOffset; // first float of the attribute in source vertex
+    uint32_t offset; // bytes from start of encoded vertex
+} VertexAttribute;
+
+typedef struct VertexFormat {
+    VertexAttribute attributes[VERTEX_FORMAT_MAX_ATTRIBUTES];
+    uint32_t attributeCount;
+    uint32_t stride;
+
+    // Source position = encoded position * scale + bias. Drawing code folds it into model matrix
+    // (getVertexDequantization()), so shaders read quantized positions as they are.
+    float positionScale[3];
+    float positionBias[3];
+} VertexFormat;
+
+inline static void initVertexFormat(VertexFormat* format) {
+    memset(format, 0, sizeof(VertexFormat));
+    for (int i = 0; i < 3; i++) {
+        format->positionScale[i] = 1.f;
+    }
+}
+
+// Components stored in the vertex buffer. 16 bit attributes with 3 components are padded to 4 - vertex formats
+// with 6 bytes aren't supported for vertex buffers by many Vulkan implementations.
+inline static uint32_t vertexAttributeStoredComponents(const VertexAttribute* attribute) {
+    if (attribute->encoding == VERTEX_ENCODING_OCTAHEDRAL_SNORM16) {
+        return 2;
+    }
+    if (attribute->encoding != VERTEX_ENCODING_FLOAT32 && attribute->components == 3) {
+        return 4;
+    }
+
+    return attribute->components;
+}
+
+inline static uint32_t vertexAttributeSize(const VertexAttribute* attribute) {
+    uint32_t componentSize = attribute->encoding == VERTEX_ENCODING_FLOAT32 ? sizeof(float) : sizeof(uint16_t);
+
+    return vertexAttributeStoredComponents(attribute) * componentSize;
+}
+
+// Attributes are packed in the order they are added, every one starts 4 byte aligned
+inline static void addVertexAttribute(VertexFormat* format, uint32_t location, VertexSemantic semantic, VertexEncoding encoding,
+    uint32_t components, uint32_t sourceOffset) {
+    VertexAttribute* attribute = &format->attributes[format->attributeCount++];
+    attribute->location = location;
+    attribute->semantic = semantic;
+    attribute->encoding = encoding;
+    attribute->components = components;
+    attribute->sourceOffset = sourceOffset;
+    attribute->offset = format->stride;
+    format->stride += (vertexAttributeSize(attribute) + 3) & ~3u;
+}
+
+// Sets position scale and bias, so bounds of the vertices fill the whole snorm16 range. Other encodings
+// store positions as they are.
+inline static void fitVertexPositions(VertexFormat* format, const float* vertices, uint32_t vertexCount, uint32_t sourceFloats) {
+    for (uint32_t a = 0; a < format->attributeCount; a++) {
+        const VertexAttribute* attribute = &format->attributes[a];
+        if (attribute->semantic != VERTEX_SEMANTIC_POSITION || attribute->encoding != VERTEX_ENCODING_SNORM16) {
+            continue;
+        }
+
+        for (uint32_t c = 0; c < attribute->components && c < 3; c++) {
+            float minimum = vertices[attribute->sourceOffset + c], maximum = minimum;
+            for (uint32_t i = 1; i < vertexCount; i++) {
+                float value = vertices[i * sourceFloats + attribute->sourceOffset + c];
+                minimum = value < minimum ? value : minimum;
+                maximum = value > maximum ? value : maximum;
+            }
+            format->positionBias[c] = (minimum + maximum) * 0.5f;
+            format->positionScale[c] = maximum > minimum ? (maximum - minimum) * 0.5f : 1.f;
+        }
+    }
+}
+
+// Model matrix of encoded positions - multiplies model matrix of the mesh from the right
+inline static void getVertexDequantization(const VertexFormat* format, float dequantization[4][4]) {
+    memset(dequantization, 0, sizeof(float) * 16);
+    for (int i = 0; i < 3; i++) {
+        dequantization[i][i] = format->positionScale[i];
+        dequantization[3][i] = format->positionBias[i];
+    }
+    dequantization[3][3] = 1.f;
+}
+
+// Round to nearest even, values out of half range become infinity, denormals are flushed to zero
+inline static uint16_t encodeHalfFloat(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    int32_t exponent = (int32_t) ((bits >> 23) & 0xFFu) - 127 + 15;
+    uint32_t mantissa = bits & 0x7FFFFFu;
+
+    if (exponent <= 0) {
+        return (uint16_t) sign;
+    }
+    if (exponent >= 31) {
+        return (uint16_t) (sign | 0x7C00u | (((bits >> 23) & 0xFFu) == 0xFFu && mantissa != 0 ? 0x200u : 0u));
+    }
+
+    uint32_t half = sign | ((uint32_t) exponent << 10) | (mantissa >> 13);
+    uint32_t rest = mantissa & 0x1FFFu;
+    if (rest > 0x1000u || (rest == 0x1000u && (half & 1u))) {
+        half++; // carry into exponent is still correct rounding
+    }
+
+    return (uint16_t) half;
+}
+
+inline static int16_t encodeSnorm16(float value) {
+    float clamped = value < -1.f ? -1.f : (value > 1.f ? 1.f : value);
+
+    return (int16_t) lroundf(clamped * 32767.f);
+}
+
+inline static uint16_t encodeUnorm16(float value) {
+    float clamped = value < 0.f ? 0.f : (value > 1.f ? 1.f : value);
+
+    return (uint16_t) lroundf(clamped * 65535.f);
+}
+
+// Unit vector is projected onto octahedron |x| + |y| + |z| = 1 and its lower half is folded over the upper one,
+// which maps the whole sphere onto [-1, 1] square. Decoding in shader:
+//   vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y)); float t = max(-n.z, 0.0);
+//   n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t); n = normalize(n);
+inline static void encodeOctahedral(const float normal[3], int16_t encoded[2]) {
+    float sum = fabsf(normal[0]) + fabsf(normal[1]) + fabsf(normal[2]);
+    float x = sum > 0.f ? normal[0] / sum : 0.f;
+    float y = sum > 0.f ? normal[1] / sum : 0.f;
+    if (normal[2] < 0.f) {
+        float foldedX = (1.f - fabsf(y)) * (x >= 0.f ? 1.f : -1.f);
+        float foldedY = (1.f - fabsf(x)) * (y >= 0.f ? 1.f : -1.f);
+        x = foldedX;
+        y = foldedY;
+    }
+    encoded[0] = encodeSnorm16(x);
+    encoded[1] = encodeSnorm16(y);
+}
+
+// Encodes vertexCount source vertices (sourceFloats floats each) into destination, stride bytes apart.
+// Call fitVertexPositions() first when positions are snorm16.
+inline static void encodeVertices(const VertexFormat* format, const float* vertices, uint32_t vertexCount, uint32_t sourceFloats,
+    void* destination) {
+    memset(destination, 0, (size_t) vertexCount * format->stride);
+    for (uint32_t i = 0; i < vertexCount; i++) {
+        const float* vertex = &vertices[i * sourceFloats];
+        unsigned char* encoded = (unsigned char*) destination + (size_t) i * format->stride;
+
+        for (uint32_t a = 0; a < format->attributeCount; a++) {
+            const VertexAttribute* attribute = &format->attributes[a];
+            const float* source = &vertex[attribute->sourceOffset];
+            unsigned char* target = encoded + attribute->offset;
+
+            if (attribute->encoding == VERTEX_ENCODING_OCTAHEDRAL_SNORM16) {
+                int16_t octahedral[2];
+                encodeOctahedral(source, octahedral);
+                memcpy(target, octahedral, sizeof(octahedral));
+                continue;
+            }
+
+            for (uint32_t c = 0; c < attribute->components; c++) {
+                float value = source[c];
+                if (attribute->semantic == VERTEX_SEMANTIC_POSITION && c < 3) {
+                    value = (value - format->positionBias[c]) / format->positionScale[c];
+                }
+
+                if (attribute->encoding == VERTEX_ENCODING_FLOAT32) {
+                    memcpy(target + c * sizeof(float), &value, sizeof(float));
+                } else {
+                    uint16_t component = attribute->encoding == VERTEX_ENCODING_HALF_FLOAT ? encodeHalfFloat(value)
+                        : attribute->encoding == VERTEX_ENCODING_SNORM16 ? (uint16_t) encodeSnorm16(value)
+                        : encodeUnorm16(value);
+                    memcpy(target + c * sizeof(uint16_t), &component, sizeof(uint16_t));
+                }
+            }
+        }
+    }
+}
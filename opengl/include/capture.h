@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "glad/gl.h"
+#include "threading.h"
+
+#define CAPTURE_RING_SIZE 4 // pixel pack buffers in flight, each frame is mapped up to this many frames later
+#define CAPTURE_WRITE_QUEUE_SIZE 8 // frames copied out of GL and waiting for writer thread
+
+// Captures rendered frames as raw video (RGBA8, top row first, no header), e.g. for ffmpeg:
+//   ffmpeg -f rawvideo -pix_fmt rgba -s 1600x900 -r 60 -i capture.rgba capture.mp4
+// glReadPixels only queues a copy into pixel pack buffer; buffer is mapped once its fence signalled,
+// so neither readback nor disk writes (done on writer thread) block the render loop.
+typedef struct FrameCapture {
+    GLsizei width;
+    GLsizei height;
+    size_t frameSize;
+
+    // Readback ring, frames are collected in order from the oldest one
+    GLuint pbos[CAPTURE_RING_SIZE];
+    GLsync fences[CAPTURE_RING_SIZE];
+    unsigned int oldestPending;
+    unsigned int pendingCount;
+
+    // Writer thread and its queue of frames
+    Thread writer;
+    Mutex mutex;
+    CondVar frameQueued;
+    CondVar frameWritten;
+    unsigned char* frames[CAPTURE_WRITE_QUEUE_SIZE];
+    unsigned int queueHead;
+    unsigned int queueCount;
+    bool running;
+    FILE* output;
+
+    // Statistics
+    unsigned long long capturedFrames;
+    unsigned long long writtenFrames;
+    unsigned long long ringStalls; // readback ring was full, render thread waited for GPU
+    unsigned long long writerStalls; // write queue was full, render thread waited for writer
+} FrameCapture;
+
+FILE* openCaptureOutput(const char* path);
+
+void createFrameCapture(FrameCapture* capture, GLsizei width, GLsizei height, FILE* output);
+
+void captureFrame(FrameCapture* capture);
+
+void destroyFrameCapture(FrameCapture* capture);
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "glad/gl.h"
+#include "uniforms.h"
+
+#define COMMAND_ALIGNMENT 4 // every command (header and payload) starts at multiple of this
+
+typedef enum CommandType {
+    COMMAND_USE_PROGRAM,
+    COMMAND_BIND_TEXTURE,
+    COMMAND_BIND_VERTEX_ARRAY,
+    COMMAND_BIND_UNIFORMS, // range of uniform ring, data was written there while recording
+    COMMAND_DRAW_ARRAYS,
+    COMMAND_DRAW_ELEMENTS
+} CommandType;
+
+// Every command starts with header, size covers header, payload and padding - decoder just jumps over it
+typedef struct CommandHeader {
+    uint16_t type;
+    uint16_t size;
+} CommandHeader;
+
+typedef struct UseProgramCommand {
+    GLuint programId;
+} UseProgramCommand;
+
+typedef struct BindTextureCommand {
+    GLuint textureId; // always unit 0, GL_TEXTURE_2D
+} BindTextureCommand;
+
+typedef struct BindVertexArrayCommand {
+    GLuint vao;
+} BindVertexArrayCommand;
+
+typedef struct BindUniformsCommand {
+    GLuint binding;
+    uint32_t offset; // in uniform ring buffer (32 bits keep payload 4 byte aligned)
+    uint32_t size;
+} BindUniformsCommand;
+
+typedef struct DrawArraysCommand {
+    GLint firstVertex;
+    GLsizei vertexCount;
+    GLuint occlusionQuery; // drawn with conditional rendering when not 0
+} DrawArraysCommand;
+
+typedef struct DrawElementsCommand {
+    GLint firstIndex;
+    GLsizei indexCount;
+    GLenum indexType;
+    GLuint occlusionQuery; // drawn with conditional rendering when not 0
+} DrawElementsCommand;
+
+// GL calls recorded into memory. Recording doesn't touch GL at all, so any thread can record its own buffer;
+// only replay has to run on the thread owning GL context.
+typedef struct CommandBuffer {
+    unsigned char* data;
+    size_t size;
+    size_t capacity; // grows when needed, kept between frames
+    uint32_t commandCount;
+} CommandBuffer;
+
+void createCommandBuffer(CommandBuffer* commands, size_t capacity);
+
+void resetCommandBuffer(CommandBuffer* commands);
+
+void recordUseProgram(CommandBuffer* commands, GLuint programId);
+
+void recordBindTexture(CommandBuffer* commands, GLuint textureId);
+
+void recordBindVertexArray(CommandBuffer* commands, GLuint vao);
+
+void recordBindUniforms(CommandBuffer* commands, GLuint binding, GLintptr offset, GLsizeiptr size);
+
+void recordDrawArrays(CommandBuffer* commands, GLint firstVertex, GLsizei vertexCount, GLuint occlusionQuery);
+
+void recordDrawElements(CommandBuffer* commands, GLint firstIndex, GLsizei indexCount, GLenum indexType, GLuint occlusionQuery);
+
+void replayCommandBuffer(const CommandBuffer* commands, UniformRing* uniformRing);
+
+void destroyCommandBuffer(CommandBuffer* commands);
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "glad/gl.h"
+#include "instancing.h"
+#include "uniforms.h"
+
+#define CULLING_MODELS_BINDING 1
+#define CULLING_VISIBLE_MODELS_BINDING 2
+#define CULLING_COMMAND_BINDING 3
+#define CULLING_WORKGROUP_SIZE 64 // has to match local_size_x of culling compute shader
+
+// Layout defined by GL for glMultiDrawElementsIndirect()
+typedef struct DrawElementsIndirectCommand {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint baseVertex;
+    GLuint baseInstance;
+} DrawElementsIndirectCommand;
+
+// Frustum culling of instance batch done on GPU. Compute shader compacts model matrices of visible instances into
+// its own buffer and counts them straight into indirect draw command, so CPU issues the same calls each frame
+// no matter how many instances there are or how many are visible. Batch is drawn from the compacted buffer,
+// with either instance layout.
+typedef struct CullingPass {
+    GLuint programId;
+    GLuint visibleModelBuffer;
+    GLuint commandBuffer; // single DrawElementsIndirectCommand
+    DrawElementsIndirectCommand resetCommand; // uploaded before culling, so counting starts from zero
+
+    // Uniform locations, looked up once after linking
+    GLint frustumPlanesLocation;
+    GLint boundingRadiusLocation;
+    GLint instanceCountLocation;
+} CullingPass;
+
+void extractFrustumPlanes(float viewProjection[4][4], GLfloat planes[6][4]);
+
+bool isSphereInFrustum(GLfloat planes[6][4], const float center[3], float radius);
+
+void createCullingPass(CullingPass* pass, const InstanceBatch* batch, float boundingRadius);
+
+void cullInstanceBatch(CullingPass* pass, const InstanceBatch* batch, const FrameUniforms* frameUniforms);
+
+void drawCulledInstanceBatch(CullingPass* pass, const InstanceBatch* batch);
+
+void destroyCullingPass(CullingPass* pass);
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "glad/gl.h"
+
+#define FRAME_PACER_MAX_FRAMES_IN_FLIGHT 8
+#define FRAME_PACER_DEFAULT_FRAMES_IN_FLIGHT 2
+#define FRAME_PACER_REPORT_INTERVAL 2.f // seconds
+
+// Limits how many frames CPU can queue ahead of GPU (driver would otherwise decide on its own)
+// and measures how evenly frames are presented
+typedef struct FramePacer {
+    unsigned int maxFramesInFlight; // 0 means no limit
+    bool report; // log frame time statistics every FRAME_PACER_REPORT_INTERVAL
+    GLsync fences[FRAME_PACER_MAX_FRAMES_IN_FLIGHT];
+    unsigned int frame;
+
+    double lastFrameEndMs; // monotonicMilliseconds() timestamps
+    double reportStartMs;
+    double frameTimeTotalMs;
+    double frameTimeSquaresTotal;
+    double frameTimeMinMs;
+    double frameTimeMaxMs;
+    double waitTotalMs;
+    unsigned int frames;
+} FramePacer;
+
+void createFramePacer(FramePacer* pacer, unsigned int maxFramesInFlight, bool report);
+
+void waitForFrameSlot(FramePacer* pacer);
+
+void endFramePacerFrame(FramePacer* pacer);
+
+void destroyFramePacer(FramePacer* pacer);
@@ -5,6 +5,13 @@
 #include "glad/gl.h"
 #include "utils.h"
 
+// How GL entry points are resolved by GLAD (see GL_ON_DEMAND_LOADING option in CMakeLists.txt)
+#ifdef GLAD_OPTION_GL_ON_DEMAND
+#define GL_LOADING_MODE "on demand"
+#else
+#define GL_LOADING_MODE "all at startup"
+#endif
+
 static void glDebugCallbackFunction(GLenum source, GLenum type, GLuint id,
     GLenum severity, GLsizei length, const GLchar* message, const void* userParam) {
 
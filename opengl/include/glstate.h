@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "glad/gl.h"
+
+#define GL_STATE_MAX_TEXTURE_UNITS 16
+#define GL_STATE_MAX_BUFFER_INDICES 8 // cached indexed bindings (uniform and shader storage blocks)
+#define GL_STATE_MAX_CAPABILITIES 16
+#define GL_STATE_REPORT_INTERVAL 2.f // seconds
+
+// Shadow copy of GL binding state. GL has one state per context, so the cache is global as well.
+// Every bind goes through cached*() functions, which only call GL when the value actually changes.
+// Code which changes bindings directly (e.g. resource creation) has to call invalidateGLStateCache() afterwards.
+void createGLStateCache(bool report);
+
+void invalidateGLStateCache(void);
+
+// True when buffers and textures can be edited without binding them (GL 4.5 / ARB_direct_state_access)
+bool hasDirectStateAccess(void);
+
+void cachedUseProgram(GLuint program);
+
+void cachedBindVertexArray(GLuint vao);
+
+void cachedBindTexture(GLuint unit, GLenum target, GLuint texture);
+
+void cachedBindBuffer(GLenum target, GLuint buffer);
+
+void cachedBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+
+void cachedEnable(GLenum capability);
+
+void cachedDisable(GLenum capability);
+
+void endGLStateCacheFrame(void);
+
+void destroyGLStateCache(void);
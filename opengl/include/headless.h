@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "glad/gl.h"
+#include "glad/egl.h"
+
+// Rendering without display server (e.g. benchmarking on machines with Mesa llvmpipe only).
+// GL context is created through EGL and frames are rendered into offscreen framebuffer instead of window.
+typedef struct HeadlessContext {
+    EGLDisplay display;
+    EGLSurface surface; // pbuffer, EGL_NO_SURFACE when context is made current without surface
+    EGLContext context;
+    EGLSurface loaderSurface; // surface can't be current on two threads at once, so loader has its own
+    EGLContext loaderContext; // shares objects with context, used by asset loader thread
+
+    GLuint framebuffer;
+    GLuint colorRenderbuffer;
+    GLuint depthRenderbuffer;
+    int width;
+    int height;
+
+    // Frame time statistics
+    unsigned int frameCount; // number of frames to render
+    unsigned int frame;
+    double* frameTimesMs;
+    double startMs; // monotonicMilliseconds() timestamps
+    double lastFrameEndMs;
+} HeadlessContext;
+
+void createHeadlessContext(HeadlessContext* headless, int width, int height, unsigned int frameCount);
+
+bool endHeadlessFrame(HeadlessContext* headless);
+
+void makeHeadlessLoaderContextCurrent(void* headless);
+
+void releaseHeadlessLoaderContext(void* headless);
+
+void destroyHeadlessContext(HeadlessContext* headless);
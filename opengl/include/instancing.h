@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "glad/gl.h"
+
+#define INSTANCE_MODEL_ATTRIBUTE_LOCATION 2 // mat4 attribute takes 4 consecutive locations (2-5)
+#define INSTANCE_STORAGE_BINDING 0
+#define INSTANCE_GRID_SPACING 3.f
+
+// Where vertex shader takes per-instance model matrix from
+typedef enum InstanceLayout {
+    INSTANCE_LAYOUT_ATTRIBUTES, // instance VBO, attributes advanced once per instance (glVertexAttribDivisor)
+    INSTANCE_LAYOUT_STORAGE_BUFFER // SSBO indexed with gl_InstanceID
+} InstanceLayout;
+
+// Many copies of one indexed mesh drawn with single glDrawElementsInstanced() call
+typedef struct InstanceBatch {
+    InstanceLayout layout;
+    GLuint programId; // variant with instanceLayoutShaderFeatures(), 0 while it's still being built on loader thread
+    GLuint vao;
+    GLsizei indexCount;
+    GLenum indexType; // of mesh vertex array's element buffer
+    float meshDequantization[4][4]; // applied to every instance model (see getCubeDequantization())
+    GLuint buffer;
+    GLsizei count;
+    GLfloat* models; // CPU copy of model matrices (16 floats, column-major), uploaded every frame
+} InstanceBatch;
+
+InstanceLayout parseInstanceLayout(const char* name);
+
+const char* instanceLayoutName(InstanceLayout layout);
+
+uint32_t instanceLayoutShaderFeatures(InstanceLayout layout);
+
+void createInstanceBatch(InstanceBatch* batch, InstanceLayout layout, GLuint programId, GLsizei count, GLuint meshVao, GLsizei indexCount,
+    GLenum indexType, float meshDequantization[4][4]);
+
+int instanceGridSide(GLsizei count);
+
+void instanceGridModel(float model[4][4], GLsizei index, int side, float rotationAngle);
+
+void updateInstanceGrid(InstanceBatch* batch, float rotationAngle);
+
+void drawInstanceBatch(InstanceBatch* batch);
+
+void destroyInstanceBatch(InstanceBatch* batch);
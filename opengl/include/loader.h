@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "glad/gl.h"
+#include "threading.h"
+
+#define ASSET_LOADER_MAX_ASSETS 32
+
+// Makes loader's GL context current on the calling thread (or releases it). Loader context has to share objects
+// with render context and must not be current anywhere else; implemented by platform code (GLX, EGL).
+typedef void (*LoaderContextFunction)(void* userData);
+
+typedef enum AssetType {
+    ASSET_TEXTURE,
+    ASSET_CUBE_MESH, // vertex buffer only, VAO has to be created on render context (see attachCubeMeshBuffer())
+    ASSET_SHADER_VARIANT // linked program, owned by shader variant cache which lives on loader context
+} AssetType;
+
+typedef enum AssetState {
+    ASSET_QUEUED,
+    ASSET_LOADING,
+    ASSET_UPLOADED, // GL object exists, fence tells when GPU finished the upload
+    ASSET_READY // render context waited for the fence, object can be used freely
+} AssetState;
+
+typedef struct Asset {
+    AssetType type;
+    const char* path;
+    uint32_t features; // SHADER_FEATURE_* mask of shader variant
+    AssetState state;
+    GLuint object; // texture or buffer
+    GLsync fence;
+    float loadTimeMs;
+} Asset;
+
+// Loads assets on a separate thread with its own GL context, so render loop starts right away
+// and picks resources up when they become ready
+typedef struct AssetLoader {
+    Thread thread;
+    Mutex mutex;
+    CondVar assetQueued;
+    Asset assets[ASSET_LOADER_MAX_ASSETS];
+    unsigned int assetCount;
+    unsigned int nextQueuedAsset;
+    bool running;
+
+    LoaderContextFunction makeContextCurrent;
+    LoaderContextFunction releaseContext;
+    void* contextUserData;
+} AssetLoader;
+
+void createAssetLoader(AssetLoader* loader, LoaderContextFunction makeContextCurrent, LoaderContextFunction releaseContext,
+    void* contextUserData);
+
+unsigned int requestAsset(AssetLoader* loader, AssetType type, const char* path);
+
+unsigned int requestShaderVariantAsset(AssetLoader* loader, uint32_t features);
+
+bool acquireAsset(AssetLoader* loader, unsigned int assetId, GLuint* object);
+
+void destroyAssetLoader(AssetLoader* loader);
@@ -1,5 +1,30 @@
 #pragma once
 
 #include "glad/gl.h"
+#include "meshpool.h"
+#include "vertexformat.h"
 
-GLuint loadCubeMesh();
\ No newline at end of file
+#define CUBE_VERTEX_COUNT 36 // of expanded triangle list (CUBE_DATA)
+#define CUBE_VERTEX_STRIDE (5 * sizeof(float)) // position (xyz) + texture coords (uv), as in CUBE_DATA
+
+// Cube mesh buffer holds indices first and welded vertices after them. Index count doesn't change by welding,
+// so vertices start at a fixed offset, no matter how many of them are left.
+#define CUBE_INDEX_COUNT 36
+#define CUBE_INDEX_TYPE GL_UNSIGNED_SHORT // cube has far less than 65536 vertices
+#define CUBE_INDICES_SIZE (CUBE_INDEX_COUNT * sizeof(GLushort))
+
+void applyVertexFormat(const VertexFormat* format, GLintptr offset);
+
+void getCubeDequantization(float dequantization[4][4]);
+
+GLuint createCubeMeshBuffer();
+
+void attachCubeMeshBuffer(GLuint vao, GLuint vbo);
+
+void attachIndexedCubeMeshBuffer(GLuint vao, GLuint buffer);
+
+GLuint loadCubeMesh();
+
+PooledMesh addCubeToMeshPool(MeshPool* pool);
+
+void writeCubeVertices(float* vertices, float model[4][4]);
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "glad/gl.h"
+#include "vertexformat.h"
+
+#define MESH_POOL_MAX_VERTICES 65536 // indices are stored as 16 bit
+#define MESH_POOL_INPUT_FLOATS 5 // added vertices: position (xyz) + texture coords (uv), same layout as CUBE_DATA
+#define MESH_POOL_VERTEX_WORDS 3 // packed vertex: snorm16 x, y | snorm16 z, padding | unorm16 u, v
+#define MESH_POOL_VERTICES_BINDING 3
+#define MESH_POOL_INDICES_BINDING 4
+
+// Range of pool's index buffer belonging to one mesh, drawn with glDrawArrays(GL_TRIANGLES, firstIndex, indexCount)
+typedef struct PooledMesh {
+    GLint firstIndex;
+    GLsizei indexCount;
+} PooledMesh;
+
+// Vertices and indices of many meshes in two shader storage buffers, read by vertex shader with gl_VertexID
+// (SHADER_FEATURE_VERTEX_PULLING) instead of vertex attributes. Every mesh of the pool is drawn with the same
+// (empty) vertex array and buffer bindings, only the draw range differs.
+// Vertices are packed into 12 bytes (instead of 20 bytes of floats) by encodeVertices() with pool's vertex format:
+// positions as snorm16 scaled by pool's position scale and texture coords (which have to be in [0, 1]) as unorm16.
+typedef struct MeshPool {
+    GLuint vertexBuffer; // position scale (float) followed by packed vertices
+    GLuint indexBuffer; // two 16 bit indices in every 32 bit word
+    GLuint vao; // no attributes, but core profile doesn't draw without vertex array bound
+    float positionScale; // positions of all meshes have to be within [-positionScale, positionScale]
+    VertexFormat vertexFormat; // layout decoded by vertex pulling shader
+    uint32_t vertexCount;
+    uint32_t vertexCapacity;
+    uint32_t indexCount;
+    uint32_t indexCapacity;
+    uint32_t meshCount;
+} MeshPool;
+
+void createMeshPool(MeshPool* pool, uint32_t vertexCapacity, uint32_t indexCapacity, float positionScale);
+
+PooledMesh addPooledMesh(MeshPool* pool, const float* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount);
+
+PooledMesh addPooledTriangles(MeshPool* pool, const float* vertices, uint32_t vertexCount);
+
+void bindMeshPool(const MeshPool* pool);
+
+void destroyMeshPool(MeshPool* pool);
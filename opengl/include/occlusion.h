@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "glad/gl.h"
+#include "uniforms.h"
+
+#define OCCLUSION_MAX_OBJECTS 256
+#define OCCLUSION_VISIBLE_TEST_INTERVAL 4 // visible objects are retested every n-th frame, hidden ones every frame
+#define OCCLUSION_BOUNDS_SCALE 1.01f // box is slightly larger than object, so object's own depth doesn't hide it
+
+typedef struct OccludedObject {
+    GLuint query;
+    bool issued; // query was issued at least once, so it can drive conditional rendering
+    bool pending; // result of the last test hasn't been read back yet
+    bool visible; // last read result
+    float bounds[4][4]; // transformation of unit cube [-1, 1] enclosing the object
+} OccludedObject;
+
+// Bounding boxes are tested against depth buffer after opaque draws, with color and depth writes disabled.
+// Next frame draws objects conditionally on their last test, so hidden objects are skipped by GPU without
+// CPU ever waiting for query results.
+typedef struct OcclusionCuller {
+    GLuint programId; // depth only program drawing bounding boxes (untextured variant), 0 while it's still being built
+    GLuint boxVao; // indexed cube mesh, only positions are used
+    OccludedObject objects[OCCLUSION_MAX_OBJECTS];
+    unsigned int objectCount;
+    unsigned int frame;
+
+    // Statistics
+    unsigned long long testsIssued;
+    unsigned long long resultsRead;
+    unsigned long long hiddenResults;
+} OcclusionCuller;
+
+void createOcclusionCuller(OcclusionCuller* culler, GLuint programId, GLuint boxVao);
+
+unsigned int addOccludedObject(OcclusionCuller* culler);
+
+void updateOcclusionResults(OcclusionCuller* culler);
+
+void setOccludedObjectBounds(OcclusionCuller* culler, unsigned int objectId, float bounds[4][4]);
+
+GLuint getOcclusionQuery(OcclusionCuller* culler, unsigned int objectId);
+
+void issueOcclusionTests(OcclusionCuller* culler, UniformRing* uniformRing);
+
+void destroyOcclusionCuller(OcclusionCuller* culler);
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "glad/gl.h"
+
+#define GPU_PROFILER_MAX_SCOPES 8
+#define GPU_PROFILER_FRAMES 4 // query sets in flight, results are read this many frames later
+#define GPU_PROFILER_REPORT_INTERVAL 2.f // seconds
+
+// Named part of the frame, timed on CPU (submit cost) and GPU (GL_TIME_ELAPSED query)
+typedef struct GpuScope {
+    const char* name;
+    GLuint queries[GPU_PROFILER_FRAMES];
+    bool issued[GPU_PROFILER_FRAMES];
+    double cpuStartMs; // monotonicMilliseconds() timestamp
+
+    // Statistics of the current report interval
+    double cpuTotalMs;
+    double cpuMaxMs;
+    unsigned int cpuSamples;
+    double gpuTotalMs;
+    double gpuMaxMs;
+    unsigned int gpuSamples;
+} GpuScope;
+
+typedef struct GpuProfiler {
+    bool enabled;
+    GpuScope scopes[GPU_PROFILER_MAX_SCOPES];
+    unsigned int scopeCount;
+
+    // GL_TIMESTAMP queries written at the beginning and the end of every frame
+    GLuint frameQueries[GPU_PROFILER_FRAMES][2];
+    bool framePending[GPU_PROFILER_FRAMES];
+    GLint64 submitTimestamps[GPU_PROFILER_FRAMES]; // GPU clock read by CPU when frame started
+    unsigned int frame;
+    bool recording; // false when query set of this frame still wasn't available (frame is not profiled)
+
+    double frameStartMs; // monotonicMilliseconds() timestamps
+    double reportStartMs;
+    double cpuFrameTotalMs;
+    unsigned int cpuFrames;
+    double gpuFrameTotalMs;
+    double gpuFrameMaxMs;
+    double gpuBusyTotalMs; // sum of scope GL_TIME_ELAPSED results, unlike frame span it has no idle gaps
+    double gpuLatencyTotalMs;
+    unsigned int gpuFrames;
+    unsigned int skippedFrames;
+} GpuProfiler;
+
+void createGpuProfiler(GpuProfiler* profiler, bool enabled);
+
+unsigned int addGpuScope(GpuProfiler* profiler, const char* name);
+
+void beginGpuProfilerFrame(GpuProfiler* profiler);
+
+void beginGpuScope(GpuProfiler* profiler, unsigned int scope);
+
+void endGpuScope(GpuProfiler* profiler, unsigned int scope);
+
+void endGpuProfilerFrame(GpuProfiler* profiler);
+
+void destroyGpuProfiler(GpuProfiler* profiler);
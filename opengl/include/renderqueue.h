@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "glad/gl.h"
+#include "commandbuffer.h"
+#include "uniforms.h"
+
+// Sort key layout (most significant bits first). Draws are grouped by state and front-to-back within
+// the same state (early-z rejects hidden fragments). Pass bits order whole passes before anything else.
+//   pass (4) | program (12) | texture (12) | vao (12) | depth (24)
+#define RENDER_KEY_PASS_BITS 4
+#define RENDER_KEY_ID_BITS 12
+#define RENDER_KEY_DEPTH_BITS 24
+
+typedef enum RenderPass {
+    RENDER_PASS_OPAQUE
+} RenderPass;
+
+typedef struct DrawItem {
+    RenderPass pass;
+    GLuint programId;
+    GLuint textureId;
+    GLuint vao;
+    GLint first; // vertex, or index when indexType is set
+    GLsizei count;
+    GLenum indexType; // GL_UNSIGNED_SHORT / GL_UNSIGNED_INT draws with vertex array's element buffer (0 - non-indexed)
+    float depth; // view space distance from camera
+    GLuint occlusionQuery; // draw is skipped by GPU when this query found no samples (0 - always drawn)
+    ObjectUniforms objectUniforms;
+} DrawItem;
+
+typedef struct SortEntry {
+    uint64_t key;
+    uint32_t item;
+} SortEntry;
+
+// Draws gathered during a frame, submitted sorted by state key
+typedef struct RenderQueue {
+    DrawItem* items;
+    SortEntry* entries;
+    SortEntry* scratch; // radix sort ping-pong buffer
+    uint32_t capacity;
+    uint32_t count;
+    float farPlane; // depth range used for key quantization
+    CommandBuffer commands; // used by submitRenderQueue(), allocated on first submit
+} RenderQueue;
+
+void createRenderQueue(RenderQueue* queue, uint32_t capacity, float farPlane);
+
+void beginRenderQueue(RenderQueue* queue);
+
+DrawItem* addDrawItem(RenderQueue* queue, RenderPass pass, GLuint programId, GLuint textureId, GLuint vao,
+    GLint first, GLsizei count, float depth);
+
+void recordRenderQueue(RenderQueue* queue, CommandBuffer* commands, UniformRange* uniforms);
+
+void submitRenderQueue(RenderQueue* queue, UniformRing* uniformRing);
+
+void destroyRenderQueue(RenderQueue* queue);
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "glad/gl.h"
+#include "commandbuffer.h"
+#include "renderqueue.h"
+#include "threading.h"
+#include "uniforms.h"
+
+#define SCENE_RECORDER_MAX_THREADS 16
+#define SCENE_RECORDER_DEFAULT_THREADS 4
+
+struct SceneRecorder;
+
+// Contiguous range of scene objects, culled, sorted and recorded by a single worker
+typedef struct ScenePartition {
+    struct SceneRecorder* recorder;
+    Thread thread;
+    uint32_t firstObject;
+    uint32_t objectCount;
+    uint32_t visibleCount; // objects which passed frustum test in the last frame
+    RenderQueue queue;
+    CommandBuffer commands;
+    UniformRange uniforms; // reserved in uniform ring before recording, workers write object uniforms straight there
+} ScenePartition;
+
+// Draws grid of cubes as individual draw calls. Per-object work (model matrix, frustum test, sorting,
+// uniform packing) is split between worker threads, each recording its own command buffer.
+// Render thread only replays the buffers, so the part which has to be serialized is just the GL calls.
+typedef struct SceneRecorder {
+    ScenePartition partitions[SCENE_RECORDER_MAX_THREADS];
+    uint32_t partitionCount;
+    uint32_t objectCount;
+    bool threaded; // partitions are recorded on worker threads, otherwise on the calling thread
+
+    // Worker synchronization
+    Mutex mutex;
+    CondVar frameStarted;
+    CondVar partitionRecorded;
+    uint64_t frame; // incremented when workers should record next frame
+    uint32_t pendingPartitions;
+    bool running;
+
+    // Frame inputs, written before workers are woken up and only read by them during recording
+    GLuint programId;
+    GLuint textureId;
+    GLuint vao;
+    GLint first;
+    GLsizei count;
+    GLenum indexType; // of DrawItem
+    float meshDequantization[4][4]; // applied to every object model (see getCubeDequantization())
+    float rotationAngle;
+    float view[4][4];
+    GLfloat frustumPlanes[6][4];
+
+    // Statistics
+    uint64_t recordedFrames;
+    uint64_t recordedBytes;
+    uint64_t recordedCommands;
+} SceneRecorder;
+
+void createSceneRecorder(SceneRecorder* recorder, uint32_t objectCount, uint32_t threadCount, float farPlane);
+
+void recordScene(SceneRecorder* recorder, UniformRing* uniformRing, const FrameUniforms* frameUniforms, GLuint programId,
+    GLuint textureId, GLuint vao, GLint first, GLsizei count, GLenum indexType, float meshDequantization[4][4], float rotationAngle);
+
+void replayScene(SceneRecorder* recorder, UniformRing* uniformRing);
+
+void destroySceneRecorder(SceneRecorder* recorder);
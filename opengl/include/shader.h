@@ -1,43 +1,194 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include "glad/gl.h"
 
-static const char* GLSL_VERTEX_SHADER =
-"#version 430 core                                                      \n"     
+// Linked programs are cached in PROGRAM_CACHE_DIRECTORY next to the executable (main() sets it, "--program-cache <dir>"
+// overrides it), file name contains hash of sources and driver identification
+#define PROGRAM_CACHE_DIRECTORY "program_cache"
+#define PROGRAM_CACHE_PATH_FORMAT "%s/program_cache_%016llx.bin"
+#define PROGRAM_CACHE_PATH_MAX 512
+#define PROGRAM_CACHE_MAGIC 0x33444857 // "3DHW"
+
+typedef struct ProgramCacheHeader {
+    uint32_t magic;
+    uint64_t hash; // checked again after reading, in case file was copied from elsewhere
+    GLenum format;
+    GLint length;
+} ProgramCacheHeader;
+
+// Base sources of graphics programs, compiled in variants (see shadervariants.h). Variant's "#version" line
+// and feature defines are put in front of them:
+// TEXTURED - samples diffuse texture, without it only depth is written (e.g. occlusion tests with color writes off)
+// INSTANCED_ATTRIBUTES - model matrix is per-instance vertex attribute (advanced once per instance with glVertexAttribDivisor)
+// INSTANCED_STORAGE - model matrices are read from shader storage buffer indexed by gl_InstanceID
+// VERTEX_PULLING - vertices are fetched from mesh pool storage buffers by gl_VertexID and unpacked (see meshpool.h)
+// Without instancing define model matrix comes from ObjectUniforms block.
+// Vertex pulling functions are kept in separate source, put in front of base vertex shader only by variants that use them.
+static const char* GLSL_VERTEX_PULLING_SOURCE =
+"layout (std430) readonly buffer PulledVertices {                       \n"
+"    float position_scale;                                              \n"
+"    uint packed_vertices[]; // snorm16 x, y | snorm16 z | unorm16 u, v \n"
+"};                                                                     \n"
+"                                                                       \n"
+"layout (std430) readonly buffer PulledIndices {                        \n"
+"    uint packed_indices[]; // two 16 bit indices per word              \n"
+"};                                                                     \n"
+"                                                                       \n"
+"// Draw range is range of pool's index buffer, so gl_VertexID is position in it\n"
+"uint pulled_vertex(uint id) {                                          \n"
+"    return ((packed_indices[id >> 1u] >> ((id & 1u) * 16u)) & 0xFFFFu) * 3u;\n"
+"}                                                                      \n"
 "                                                                       \n"
+"vec3 pulled_position(uint vertex) {                                    \n"
+"    vec2 xy = unpackSnorm2x16(packed_vertices[vertex]);                \n"
+"    return vec3(xy, unpackSnorm2x16(packed_vertices[vertex + 1u]).x) * position_scale;\n"
+"}                                                                      \n"
+"                                                                       \n"
+"vec2 pulled_tex_coords(uint vertex) {                                  \n"
+"    return unpackUnorm2x16(packed_vertices[vertex + 2u]);              \n"
+"}                                                                      \n";
+
+static const char* GLSL_BASE_VERTEX_SHADER =
+"#ifndef VERTEX_PULLING                                                 \n"
 "layout (location = 0) in vec3 in_position;                             \n"
+"#ifdef TEXTURED                                                        \n"
 "layout (location = 1) in vec2 in_tex_coords;                           \n"
+"#endif                                                                 \n"
+"#endif                                                                 \n"
+"#ifdef INSTANCED_ATTRIBUTES                                            \n"
+"layout (location = 2) in mat4 in_instance_model; // locations 2-5      \n"
+"#endif                                                                 \n"
 "                                                                       \n"
 "out vec3 fragment_position;                                            \n"
+"#ifdef TEXTURED                                                        \n"
 "out vec2 tex_coords;                                                   \n"
+"#endif                                                                 \n"
 "                                                                       \n"
-"uniform mat4 model;                                                    \n"
-"uniform mat4 view;                                                     \n"
-"uniform mat4 projection;                                               \n"
+"layout (std140) uniform FrameUniforms {                                \n"
+"    mat4 projection;                                                   \n"
+"    mat4 view;                                                         \n"
+"};                                                                     \n"
+"                                                                       \n"
+"#if defined(INSTANCED_STORAGE)                                         \n"
+"layout (std430) readonly buffer InstanceModels {                       \n"
+"    mat4 instance_models[];                                            \n"
+"};                                                                     \n"
+"#elif !defined(INSTANCED_ATTRIBUTES)                                   \n"
+"layout (std140) uniform ObjectUniforms {                               \n"
+"    mat4 model;                                                        \n"
+"};                                                                     \n"
+"#endif                                                                 \n"
 "                                                                       \n"
 "void main() {                                                          \n"
-"    fragment_position = vec3(model * vec4(in_position, 1.0));          \n"
+"#if defined(INSTANCED_ATTRIBUTES)                                      \n"
+"    mat4 model = in_instance_model;                                    \n"
+"#elif defined(INSTANCED_STORAGE)                                       \n"
+"    mat4 model = instance_models[gl_InstanceID];                       \n"
+"#endif                                                                 \n"
+"                                                                       \n"
+"#ifdef VERTEX_PULLING                                                  \n"
+"    uint vertex = pulled_vertex(uint(gl_VertexID));                    \n"
+"    vec3 position = pulled_position(vertex);                           \n"
+"#else                                                                  \n"
+"    vec3 position = in_position;                                       \n"
+"#endif                                                                 \n"
+"    fragment_position = vec3(model * vec4(position, 1.0));             \n"
 "                                                                       \n"
+"#ifdef TEXTURED                                                        \n"
+"#ifdef VERTEX_PULLING                                                  \n"
+"    tex_coords = pulled_tex_coords(vertex);                            \n"
+"#else                                                                  \n"
 "    tex_coords = in_tex_coords;                                        \n"
-"                                                                       \n"    
+"#endif                                                                 \n"
+"#endif                                                                 \n"
+"                                                                       \n"
 "    gl_Position = projection * view * vec4(fragment_position, 1.0);    \n"
 "}                                                                      ";
 
-static const char* GLSL_FRAGMENT_SHADER = 
-"#version 430 core                                                      \n"
-"                                                                       \n"
+static const char* GLSL_BASE_FRAGMENT_SHADER =
+"#ifdef TEXTURED                                                        \n"
 "in vec2 tex_coords;                                                    \n"
 "                                                                       \n"
 "out vec4 color;                                                        \n"
 "                                                                       \n"
 "uniform sampler2D texture_diffuse1;                                    \n"
+"#endif                                                                 \n"
 "                                                                       \n"
 "void main() {                                                          \n"
+"#ifdef TEXTURED                                                        \n"
 "    color = vec4(vec3(texture(texture_diffuse1, tex_coords)), 1.0);    \n"
-"}                                                                      ";  
+"#endif                                                                 \n"
+"}                                                                      ";
+
+// Frustum culling of instances. Visible model matrices are compacted into CullingVisibleModels with an atomic counter,
+// which is instance count of the single DrawElementsIndirectCommand drawing them (reset to zero before dispatch).
+static const char* GLSL_CULLING_COMPUTE_SHADER =
+"#version 430 core                                                      \n"
+"                                                                       \n"
+"layout (local_size_x = 64) in;                                         \n"
+"                                                                       \n"
+"struct DrawElementsIndirectCommand {                                   \n"
+"    uint count;                                                        \n"
+"    uint instance_count;                                               \n"
+"    uint first_index;                                                  \n"
+"    int base_vertex;                                                   \n"
+"    uint base_instance;                                                \n"
+"};                                                                     \n"
+"                                                                       \n"
+"layout (std430) readonly buffer CullingModels {                        \n"
+"    mat4 models[];                                                     \n"
+"};                                                                     \n"
+"                                                                       \n"
+"layout (std430) writeonly buffer CullingVisibleModels {                \n"
+"    mat4 visible_models[];                                             \n"
+"};                                                                     \n"
+"                                                                       \n"
+"layout (std430) buffer CullingCommand {                                \n"
+"    DrawElementsIndirectCommand command;                               \n"
+"};                                                                     \n"
+"                                                                       \n"
+"uniform vec4 frustum_planes[6]; // world space, normals point inside   \n"
+"uniform float bounding_radius; // of the mesh in model space           \n"
+"uniform uint instance_count;                                           \n"
+"                                                                       \n"
+"void main() {                                                          \n"
+"    uint id = gl_GlobalInvocationID.x;                                 \n"
+"    if (id >= instance_count) {                                        \n"
+"        return;                                                        \n"
+"    }                                                                  \n"
+"                                                                       \n"
+"    // Bounding sphere moves with model translation and grows with its largest scale\n"
+"    mat4 model = models[id];                                           \n"
+"    vec3 center = model[3].xyz;                                        \n"
+"    float radius = bounding_radius * max(length(model[0].xyz), max(length(model[1].xyz), length(model[2].xyz)));\n"
+"                                                                       \n"
+"    bool visible = true;                                               \n"
+"    for (int i = 0; i < 6; i++) {                                      \n"
+"        visible = visible && dot(frustum_planes[i].xyz, center) + frustum_planes[i].w > -radius;\n"
+"    }                                                                  \n"
+"                                                                       \n"
+"    // Order of visible instances is arbitrary, which doesn't matter for opaque geometry\n"
+"    if (visible) {                                                     \n"
+"        visible_models[atomicAdd(command.instance_count, 1u)] = model; \n"
+"    }                                                                  \n"
+"}                                                                      ";
 
 bool handleShaderOperationResult(GLuint id, GLenum status);
 
-GLuint loadAndLinkShaderProgram();
\ No newline at end of file
+void bindShaderProgramInterface(GLuint programId);
+
+uint64_t hashProgram(const char* vertexShaderSource, const char* fragmentShaderSource);
+
+void setProgramCacheDirectory(const char* directory);
+
+void getProgramCachePath(char* cachePath, size_t cachePathSize, uint64_t hash);
+
+bool loadProgramBinary(GLuint programId, const char* cachePath, uint64_t hash);
+
+void saveProgramBinary(GLuint programId, const char* cachePath, uint64_t hash);
+
+GLuint loadAndLinkComputeProgramFromSource(const char* computeShaderSource);
\ No newline at end of file
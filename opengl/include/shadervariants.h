@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "glad/gl.h"
+
+// Features of graphics program variant, each one becomes a define in front of base shader sources (see shader.h)
+#define SHADER_FEATURE_TEXTURED (1u << 0)
+#define SHADER_FEATURE_INSTANCED_ATTRIBUTES (1u << 1)
+#define SHADER_FEATURE_INSTANCED_STORAGE (1u << 2)
+#define SHADER_FEATURE_VERTEX_PULLING (1u << 3)
+#define SHADER_FEATURE_COUNT 4
+
+#define SHADER_VARIANT_MAX 32
+
+// Linked programs for combinations of shader features, looked up by feature bitmask. Specialized program
+// has no dynamic branches on features, but there are many of them - variants are requested up front and with
+// GL_KHR_parallel_shader_compile driver compiles them on its own threads, while the program keeps going.
+// Programs belong to GL context, so (same as GL state cache) the cache is global and used from one thread only -
+// render thread on Windows, asset loader thread on Linux (see loader.c).
+void createShaderVariantCache(void);
+
+// Starts compiling variant (or restores it from program binary cache) and returns without waiting for the result
+void requestShaderVariant(uint32_t features);
+
+// Returns linked program of the variant, compiles it or waits for it first if needed. Program is owned by the cache.
+GLuint getShaderVariant(uint32_t features);
+
+void destroyShaderVariantCache(void);
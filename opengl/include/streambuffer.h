@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "glad/gl.h"
+
+// Number of frames whose streamed geometry can be in flight at once; each gets its own region of persistently mapped buffer
+#define STREAM_BUFFER_FRAMES 3
+
+// Buffer for geometry generated on CPU every frame (dynamic meshes, debug lines, particles).
+// Same buffer can be used as vertex and index source - it's bound to GL_ARRAY_BUFFER through vertex array
+// and to GL_ELEMENT_ARRAY_BUFFER for indexed draws, offsets returned by allocateStreamData() are buffer offsets.
+typedef struct StreamBuffer {
+    GLuint buffer;
+    GLsizeiptr frameSize; // size of single frame region (whole buffer when orphaned)
+    bool persistent; // persistently mapped (ARB_buffer_storage), otherwise orphaned every frame
+    unsigned char* mapped; // whole buffer mapping when persistent
+    unsigned char* shadow; // CPU copy of the frame region when not persistent, uploaded by flushStreamBuffer()
+    GLsync fences[STREAM_BUFFER_FRAMES];
+    unsigned int frame; // region written by the current frame (always 0 when orphaned)
+    GLsizeiptr head; // next free offset in the current frame region
+    GLsizeiptr flushed; // data in current frame region before this offset is already visible to GPU
+} StreamBuffer;
+
+void createStreamBuffer(StreamBuffer* stream, GLsizeiptr frameSize);
+
+void beginStreamBufferFrame(StreamBuffer* stream);
+
+void* allocateStreamData(StreamBuffer* stream, GLsizeiptr size, GLsizeiptr alignment, GLintptr* offset);
+
+void flushStreamBuffer(StreamBuffer* stream);
+
+void endStreamBufferFrame(StreamBuffer* stream);
+
+void destroyStreamBuffer(StreamBuffer* stream);
@@ -1,7 +1,61 @@
 #pragma once
 
+#include <stdbool.h>
+
 #include "glad/gl.h"
 
 static const char* TEXTURE_PATH = "assets/texture.jpg";
 
-GLuint loadTexture();
\ No newline at end of file
+#define TEXTURE_MAX_LEVELS 16
+#define TEXTURE_STREAM_REGIONS 3 // staging regions in flight, each guarded by its own fence
+#define TEXTURE_STREAM_FRAME_BUDGET (256 * 1024) // max bytes copied to GPU per frame (size of single region)
+#define TEXTURE_STREAM_MAX_UPLOADS 16
+#define TEXTURE_STREAM_MAX_COPIES 32 // glTexSubImage2D calls per frame
+
+// Texture waiting for its contents: all mip levels are prepared in memory (RGBA8),
+// they are uploaded from the smallest one, few rows per frame
+typedef struct TextureUpload {
+    GLuint textureId;
+    const char* path;
+    GLsizei width;
+    GLsizei height;
+    GLint levels;
+    unsigned char* mips[TEXTURE_MAX_LEVELS];
+    GLint level; // level being uploaded
+    GLsizei row; // next row of that level
+} TextureUpload;
+
+// Single part of a level copied to staging region, executed with glTexSubImage2D
+typedef struct TextureCopy {
+    GLuint textureId;
+    GLint level;
+    GLsizei width;
+    GLsizei row;
+    GLsizei rows;
+    GLintptr offset;
+    const void* pixels; // row too wide for staging region, copied from client memory (NULL - from staging at offset)
+    bool lastInLevel;
+} TextureCopy;
+
+typedef struct TextureStreamer {
+    GLuint pbo; // pixel unpack buffer split into TEXTURE_STREAM_REGIONS regions
+    bool persistent; // persistently mapped (ARB_buffer_storage), otherwise region is mapped every frame
+    bool stateCache; // binds go through state cache (render context), otherwise directly (loader context)
+    unsigned char* mapped;
+    GLsync fences[TEXTURE_STREAM_REGIONS];
+    unsigned int region;
+    TextureUpload uploads[TEXTURE_STREAM_MAX_UPLOADS];
+    unsigned int uploadCount;
+} TextureStreamer;
+
+GLuint createPlaceholderTexture();
+
+void createTextureStreamer(TextureStreamer* streamer, bool stateCache);
+
+GLuint streamTexture(TextureStreamer* streamer, const char* path);
+
+void updateTextureStreamer(TextureStreamer* streamer);
+
+void finishTextureStreamer(TextureStreamer* streamer);
+
+void destroyTextureStreamer(TextureStreamer* streamer);
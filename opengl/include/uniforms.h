@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "glad/gl.h"
+
+// Uniform block binding points, assigned to shader program blocks at link time (see shader.c)
+#define FRAME_UNIFORMS_BINDING 0
+#define OBJECT_UNIFORMS_BINDING 1
+
+// Number of frames whose uniforms can be in flight at once; each gets its own region of the ring
+#define UNIFORM_RING_FRAMES 3
+
+// Data of "FrameUniforms" block (std140 layout), shared by all draws in a frame
+typedef struct FrameUniforms {
+    float projection[4][4];
+    float view[4][4];
+} FrameUniforms;
+
+// Data of "ObjectUniforms" block (std140 layout), set for every draw
+typedef struct ObjectUniforms {
+    float model[4][4];
+} ObjectUniforms;
+
+typedef struct UniformRing {
+    GLuint buffer;
+    GLsizeiptr frameSize; // size of single frame region
+    GLint offsetAlignment; // GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+    bool persistent; // persistently mapped (ARB_buffer_storage), otherwise orphaned every frame
+    unsigned char* mapped; // whole buffer mapping when persistent
+    unsigned char* shadow; // CPU copy of the frame region when not persistent, reserved ranges are written there
+    GLsync fences[UNIFORM_RING_FRAMES];
+    unsigned int frame; // region written by the current frame
+    GLsizeiptr head; // next free offset in the current frame region
+} UniformRing;
+
+// Part of the current frame region reserved on render thread and then filled by any thread (e.g. one
+// recording worker each). Draws bind uniforms by offset into it, so no copy is made at replay.
+typedef struct UniformRange {
+    unsigned char* data; // where range is written to (mapped buffer or ring's CPU shadow copy)
+    GLintptr offset; // buffer offset of data
+    GLsizeiptr size;
+    GLsizeiptr head; // next free offset in the range
+    GLint offsetAlignment;
+} UniformRange;
+
+void createUniformRing(UniformRing* ring, GLsizeiptr frameSize);
+
+void beginUniformRingFrame(UniformRing* ring);
+
+GLintptr pushUniforms(UniformRing* ring, const void* data, GLsizeiptr size);
+
+GLsizeiptr alignUniformSize(const UniformRing* ring, GLsizeiptr size);
+
+void reserveUniforms(UniformRing* ring, GLsizeiptr size, UniformRange* range);
+
+void* allocateRangeUniforms(UniformRange* range, GLsizeiptr size, GLintptr* offset);
+
+void flushUniforms(UniformRing* ring, const UniformRange* range);
+
+void bindUniforms(UniformRing* ring, GLuint binding, GLintptr offset, GLsizeiptr size);
+
+void endUniformRingFrame(UniformRing* ring);
+
+void destroyUniformRing(UniformRing* ring);
@@ -4,9 +4,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 #include <time.h>
 #include <math.h>
-//#include <unistd.h> // for usleep()
+#include <unistd.h> // for readlink() (and usleep())
 
 // Third party libs
 #include "glad/gl.h"
@@ -16,8 +17,23 @@
 // Internal stuff
 #include "gldebug.h"
 #include "shader.h"
+#include "shadervariants.h"
 #include "mesh.h"
+#include "meshpool.h"
 #include "texture.h"
+#include "uniforms.h"
+#include "instancing.h"
+#include "profiler.h"
+#include "framepacing.h"
+#include "glstate.h"
+#include "renderqueue.h"
+#include "culling.h"
+#include "streambuffer.h"
+#include "occlusion.h"
+#include "scenerecorder.h"
+#include "headless.h"
+#include "loader.h"
+#include "capture.h"
 
 static const int WINDOW_WIDTH = 1600;
 static const int WINDOW_HEIGHT = 900;
@@ -29,6 +45,8 @@ typedef struct LinuxWindowInfo {
     Display* display;
     Window window;
     GLXContext glContext;
+    GLXContext loaderContext; // shares objects with glContext, current on asset loader thread
+    GLXPbuffer loaderPbuffer; // 1x1 drawable for loaderContext, which never draws anything
 } LinuxWindowInfo;
 
 LinuxWindowInfo createWindowAndGLContext() {
@@ -76,58 +94,315 @@ LinuxWindowInfo createWindowAndGLContext() {
     GLXContext glContext = glXCreateContext(display, visualInfo, NULL, GL_TRUE);
     glXMakeCurrent(display, window, glContext);
 
+    // Second context for asset loader thread, sharing textures and buffers with the first one.
+    // GLX needs a drawable to make a context current, so loader gets its own 1x1 pbuffer (GLX 1.3)
+    // instead of binding the window which is used by the render thread at the same time.
+    if (!GLAD_GLX_VERSION_1_3) {
+        LOG3DHW("[window-linux] GLX 1.3 is required for loader pbuffer!\n");
+        exit(-1);
+    }
+    GLint fbConfigAttributes[] = { GLX_DRAWABLE_TYPE, GLX_PBUFFER_BIT, GLX_RENDER_TYPE, GLX_RGBA_BIT, None };
+    int fbConfigCount = 0;
+    GLXFBConfig* fbConfigs = glXChooseFBConfig(display, 0, fbConfigAttributes, &fbConfigCount);
+    if (fbConfigs == NULL || fbConfigCount == 0) {
+        LOG3DHW("[window-linux] Failed choosing GLXFBConfig for loader pbuffer!\n");
+        exit(-1);
+    }
+    GLint pbufferAttributes[] = { GLX_PBUFFER_WIDTH, 1, GLX_PBUFFER_HEIGHT, 1, None };
+    GLXPbuffer loaderPbuffer = glXCreatePbuffer(display, fbConfigs[0], pbufferAttributes);
+    GLXContext loaderContext = glXCreateNewContext(display, fbConfigs[0], GLX_RGBA_TYPE, glContext, GL_TRUE);
+    XFree(fbConfigs);
+    if (loaderPbuffer == None || loaderContext == NULL) {
+        LOG3DHW("[window-linux] Failed creating loader GL context!\n");
+        exit(-1);
+    }
+
     // After creating context load GL functions from GLAD
+    double loadStartMs = monotonicMilliseconds();
     if (!gladLoaderLoadGL()) {
         LOG3DHW("[window-linux] Failed loading GL\n");
         exit(-1);
     }
+    LOG3DHW("[window-linux] Loaded GL functions in %.3f ms (%s)", monotonicMilliseconds() - loadStartMs, GL_LOADING_MODE);
 
     // Return window info struct on exit
     LinuxWindowInfo linuxWindowInfo;
     linuxWindowInfo.display = display;
     linuxWindowInfo.window = window;
     linuxWindowInfo.glContext = glContext;
+    linuxWindowInfo.loaderContext = loaderContext;
+    linuxWindowInfo.loaderPbuffer = loaderPbuffer;
 
     return linuxWindowInfo;
 }
 
+// Interval is number of vertical blanks between swaps: 0 disables vsync, 1 syncs every frame to display refresh.
+// Negative value enables adaptive vsync - frames which missed vblank are swapped right away (tearing)
+// instead of waiting for the next one, which would halve the frame rate.
+void setSwapInterval(LinuxWindowInfo* linuxWindowInfo, int interval) {
+    if (interval < 0 && !GLAD_GLX_EXT_swap_control_tear) {
+        LOG3DHW("[window-linux] Adaptive vsync (GLX_EXT_swap_control_tear) not supported, using regular vsync");
+        interval = -interval;
+    }
+
+    if (GLAD_GLX_EXT_swap_control) {
+        glXSwapIntervalEXT(linuxWindowInfo->display, linuxWindowInfo->window, interval);
+    } else if (GLAD_GLX_MESA_swap_control) {
+        glXSwapIntervalMESA((unsigned int) abs(interval));
+    } else {
+        LOG3DHW("[window-linux] Swap interval control not supported, driver default is used");
+        return;
+    }
+
+    LOG3DHW("[window-linux] Swap interval set to %d (%s)", interval, GLAD_GLX_EXT_swap_control ? "GLX_EXT_swap_control" : "GLX_MESA_swap_control");
+}
+
+// Loader context is made current on its own pbuffer, same as EGL path in headless mode
+static void makeGlxLoaderContextCurrent(void* userData) {
+    LinuxWindowInfo* linuxWindowInfo = (LinuxWindowInfo*) userData;
+    if (!glXMakeContextCurrent(linuxWindowInfo->display, linuxWindowInfo->loaderPbuffer, linuxWindowInfo->loaderPbuffer, 
+        linuxWindowInfo->loaderContext)) {
+        LOG3DHW("[window-linux] Failed making loader GL context current!");
+        exit(-1);
+    }
+}
+
+static void releaseGlxLoaderContext(void* userData) {
+    LinuxWindowInfo* linuxWindowInfo = (LinuxWindowInfo*) userData;
+    glXMakeContextCurrent(linuxWindowInfo->display, None, None, NULL);
+}
+
+// Program binaries are cached next to the executable by default, so they don't end up in whatever
+// directory the demo was started from
+static void setDefaultProgramCacheDirectory(void) {
+    char executablePath[PROGRAM_CACHE_PATH_MAX];
+    ssize_t length = readlink("/proc/self/exe", executablePath, sizeof(executablePath) - 1);
+    char* lastSlash = NULL;
+    if (length > 0) {
+        executablePath[length] = '\0';
+        lastSlash = strrchr(executablePath, '/');
+    }
+    if (lastSlash == NULL) {
+        setProgramCacheDirectory(PROGRAM_CACHE_DIRECTORY);
+        return;
+    }
+
+    char directory[PROGRAM_CACHE_PATH_MAX];
+    *lastSlash = '\0';
+    snprintf(directory, sizeof(directory), "%.*s/%s", (int) (sizeof(directory) - sizeof(PROGRAM_CACHE_DIRECTORY) - 1),
+        executablePath, PROGRAM_CACHE_DIRECTORY);
+    setProgramCacheDirectory(directory);
+}
+
 int main(int argc, char** argv) {
-    LinuxWindowInfo linuxWindowInfo = createWindowAndGLContext();
-    // In order to handle window quit event on X11, we have to create Atom "WM_DELETE_WINDOW"
-    Atom wmDeleteMessage = XInternAtom(linuxWindowInfo.display, "WM_DELETE_WINDOW", False);
-    XSetWMProtocols(linuxWindowInfo.display, linuxWindowInfo.window, &wmDeleteMessage, 1);
+    // "--instances <count> [attributes|ssbo]" draws given number of cubes with single instanced draw call,
+    // "--gpu-culling" frustum culls instances in compute shader and draws visible ones with single glDrawElementsIndirect,
+    // "--dynamic-cubes <count>" draws cubes whose vertices are generated on CPU every frame (streamed geometry),
+    // "--objects <count>" draws cubes with individual draw calls, recorded on "--record-threads <n>" threads (0 - render thread),
+    // "--occlusion <count>" draws cubes hidden behind the big one, skipped on GPU based on occlusion queries,
+    // "--vertex-pulling" draws cube from packed mesh pool storage buffers instead of vertex attributes,
+    // "--capture <path>" writes every frame as raw RGBA video to file ("-" for stdout) without stalling rendering,
+    // "--profile" periodically reports CPU and GPU time of frame parts and frame time jitter,
+    // "--swap-interval <n>" sets vsync (0 off, 1 on, -1 adaptive), "--frames-in-flight <n>" limits queued frames (0 no limit),
+    // "--headless <frames>" renders given number of frames offscreen through EGL (no X server needed) and prints timings,
+    // "--program-cache <dir>" stores linked program binaries in given directory instead of next to the executable
+    GLsizei instanceCount = 0;
+    bool profile = false;
+    bool gpuCulling = false;
+    unsigned int dynamicCubeCount = 0;
+    unsigned int occludedCubeCount = 0;
+    unsigned int sceneObjectCount = 0;
+    unsigned int recordThreadCount = SCENE_RECORDER_DEFAULT_THREADS;
+    int swapInterval = 1;
+    unsigned int framesInFlight = FRAME_PACER_DEFAULT_FRAMES_IN_FLIGHT;
+    unsigned int headlessFrames = 0;
+    bool vertexPulling = false;
+    const char* capturePath = NULL;
+    const char* programCacheDirectory = NULL;
+    InstanceLayout instanceLayout = INSTANCE_LAYOUT_ATTRIBUTES;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--instances") == 0 && i + 1 < argc) {
+            instanceCount = atoi(argv[++i]);
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                instanceLayout = parseInstanceLayout(argv[++i]);
+            }
+        } else if (strcmp(argv[i], "--gpu-culling") == 0) {
+            gpuCulling = true;
+        } else if (strcmp(argv[i], "--dynamic-cubes") == 0 && i + 1 < argc) {
+            dynamicCubeCount = (unsigned int) atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--objects") == 0 && i + 1 < argc) {
+            sceneObjectCount = (unsigned int) atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--record-threads") == 0 && i + 1 < argc) {
+            recordThreadCount = (unsigned int) atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--occlusion") == 0 && i + 1 < argc) {
+            occludedCubeCount = (unsigned int) atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--vertex-pulling") == 0) {
+            vertexPulling = true;
+        } else if (strcmp(argv[i], "--capture") == 0 && i + 1 < argc) {
+            capturePath = argv[++i];
+        } else if (strcmp(argv[i], "--profile") == 0) {
+            profile = true;
+        } else if (strcmp(argv[i], "--swap-interval") == 0 && i + 1 < argc) {
+            swapInterval = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--frames-in-flight") == 0 && i + 1 < argc) {
+            framesInFlight = (unsigned int) atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--program-cache") == 0 && i + 1 < argc) {
+            programCacheDirectory = argv[++i];
+        } else if (strcmp(argv[i], "--headless") == 0 && i + 1 < argc) {
+            headlessFrames = (unsigned int) atoi(argv[++i]);
+            if (headlessFrames == 0) {
+                LOG3DHW("[main] Number of headless frames has to be greater than 0!");
+                exit(-1);
+            }
+        }
+    }
+
+    // Opened right away, so no log output gets into video written to stdout
+    FILE* captureOutput = capturePath != NULL ? openCaptureOutput(capturePath) : NULL;
+
+    // Xlib is used from asset loader thread too (through GLX)
+    XInitThreads();
+
+    const bool headless = headlessFrames > 0;
+    LinuxWindowInfo linuxWindowInfo = { 0 };
+    HeadlessContext headlessContext = { 0 };
+    Atom wmDeleteMessage = None;
+    if (headless) {
+        // Offscreen framebuffer is bound for the whole run, so render loop below doesn't need to know about it
+        createHeadlessContext(&headlessContext, WINDOW_WIDTH, WINDOW_HEIGHT, headlessFrames);
+    } else {
+        linuxWindowInfo = createWindowAndGLContext();
+        // In order to handle window quit event on X11, we have to create Atom "WM_DELETE_WINDOW"
+        wmDeleteMessage = XInternAtom(linuxWindowInfo.display, "WM_DELETE_WINDOW", False);
+        XSetWMProtocols(linuxWindowInfo.display, linuxWindowInfo.window, &wmDeleteMessage, 1);
+
+        setSwapInterval(&linuxWindowInfo, swapInterval);
+    }
         
     // Enable OpenGL debug and map the output to callback in gldebug.h
     glEnable(GL_DEBUG_OUTPUT);
     glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
     glDebugMessageCallback(glDebugCallbackFunction, NULL);
 
+    // Per-frame binds go through state cache, so unchanged state doesn't reach the driver
+    createGLStateCache(profile);
+
     // Enable backface culling
     glEnable(GL_CULL_FACE);
     glCullFace(GL_BACK);
 
-    // Load and compile shader program
-    GLuint shaderProgramId = loadAndLinkShaderProgram();
+    // Enable depth testing (occlusion tests are made against the depth buffer too)
+    glEnable(GL_DEPTH_TEST);
+
+    if (programCacheDirectory != NULL) {
+        setProgramCacheDirectory(programCacheDirectory);
+    } else {
+        setDefaultProgramCacheDirectory();
+    }
+
+    // Shader variants, mesh and texture are built, decoded and uploaded on loader thread, so the first frame doesn't
+    // wait for them. Until they are ready cube isn't drawn and white placeholder texture is bound.
+    // All shader variants this run draws with are requested together, so with parallel shader compile
+    // driver compiles them side by side.
+    AssetLoader assetLoader;
+    if (headless) {
+        createAssetLoader(&assetLoader, makeHeadlessLoaderContextCurrent, releaseHeadlessLoaderContext, &headlessContext);
+    } else {
+        createAssetLoader(&assetLoader, makeGlxLoaderContextCurrent, releaseGlxLoaderContext, &linuxWindowInfo);
+    }
+    uint32_t cubeShaderFeatures = SHADER_FEATURE_TEXTURED | (vertexPulling ? SHADER_FEATURE_VERTEX_PULLING : 0);
+    unsigned int cubeProgramAsset = requestShaderVariantAsset(&assetLoader, cubeShaderFeatures);
+    unsigned int streamProgramAsset = 0;
+    if (dynamicCubeCount > 0) {
+        streamProgramAsset = requestShaderVariantAsset(&assetLoader, SHADER_FEATURE_TEXTURED);
+    }
+    unsigned int instanceProgramAsset = 0;
+    if (instanceCount > 0) {
+        instanceProgramAsset = requestShaderVariantAsset(&assetLoader, instanceLayoutShaderFeatures(instanceLayout));
+    }
+    unsigned int occlusionProgramAsset = 0;
+    if (occludedCubeCount > 0) {
+        occlusionProgramAsset = requestShaderVariantAsset(&assetLoader, 0);
+    }
+    GLuint shaderProgramId = 0;
+    bool programsReady = false;
+    unsigned int meshAsset = requestAsset(&assetLoader, ASSET_CUBE_MESH, NULL);
+    unsigned int textureAsset = requestAsset(&assetLoader, ASSET_TEXTURE, TEXTURE_PATH);
+
+    // Vertex array can't be shared, so it's created here and gets loaded buffer attached later
+    GLuint meshVao = 0;
+    glGenVertexArrays(1, &meshVao);
+    bool meshReady = false;
+
+    // With vertex pulling cube is drawn from mesh pool, any other mesh added there would share its buffers and vertex array
+    MeshPool meshPool = { 0 };
+    GLuint cubeVao = meshVao;
+    GLint cubeFirstIndex = 0;
+    GLsizei cubeIndexCount = CUBE_INDEX_COUNT;
+    GLenum cubeIndexType = CUBE_INDEX_TYPE;
+    mat4x4 cubeDequantization; // cube mesh buffer stores quantized positions, this turns them back into cube's ones
+    getCubeDequantization(cubeDequantization);
+    if (vertexPulling) {
+        createMeshPool(&meshPool, 1024, 4096, 1.f);
+        PooledMesh cubeMesh = addCubeToMeshPool(&meshPool);
+        cubeVao = meshPool.vao;
+        cubeFirstIndex = cubeMesh.firstIndex;
+        cubeIndexCount = cubeMesh.indexCount;
+        cubeIndexType = 0; // pool's indices are read by vertex shader, draw itself isn't indexed
+        mat4x4_identity(cubeDequantization); // pool unpacks positions with its own scale
+    }
+
+    GLuint placeholderTextureId = createPlaceholderTexture();
+    GLuint textureId = placeholderTextureId;
 
-    // Load cube vertices data to GPU
-    GLuint meshVao = loadCubeMesh();
+    // Create ring buffer for per-frame and per-object uniform data
+    UniformRing uniformRing;
+    // (every object and occluded cube push model matrix for its draw, occluded one for bounding box test too, 256 is the largest offset alignment)
+    createUniformRing(&uniformRing, sizeof(FrameUniforms) + sizeof(ObjectUniforms) + 1024 + (occludedCubeCount * 2 + sceneObjectCount) * 256);
 
-    // Load texture
-    GLuint textureId = loadTexture();
+    // Optional instanced path, used to stress test the backend with many objects
+    InstanceBatch instanceBatch = { 0 };
+    if (instanceCount > 0) {
+        createInstanceBatch(&instanceBatch, instanceLayout, 0, instanceCount, meshVao, CUBE_INDEX_COUNT, CUBE_INDEX_TYPE,
+            cubeDequantization);
+    }
+
+    // Instances outside of view frustum are dropped by compute shader, cube bounding sphere radius is sqrt(3)
+    CullingPass cullingPass = { 0 };
+    if (instanceCount > 0 && gpuCulling) {
+        createCullingPass(&cullingPass, &instanceBatch, sqrtf(3.f));
+    }
+
+    // Resource creation above binds objects directly
+    invalidateGLStateCache();
     
     // This struct will be used to store window size (we'll update it on window resize event)
-    XWindowAttributes windowAttributes;
-    XGetWindowAttributes(linuxWindowInfo.display, linuxWindowInfo.window, &windowAttributes);
+    XWindowAttributes windowAttributes = { 0 };
+    if (headless) {
+        windowAttributes.width = headlessContext.width;
+        windowAttributes.height = headlessContext.height;
+    } else {
+        XGetWindowAttributes(linuxWindowInfo.display, linuxWindowInfo.window, &windowAttributes);
+    }
     glViewport(0, 0, windowAttributes.width, windowAttributes.height); // set initial viewport size
     
+    // GPU timers for main parts of the frame
+    GpuProfiler gpuProfiler;
+    createGpuProfiler(&gpuProfiler, profile);
+    unsigned int clearScope = addGpuScope(&gpuProfiler, "clear");
+    unsigned int drawScope = addGpuScope(&gpuProfiler, "draw");
+    unsigned int swapScope = addGpuScope(&gpuProfiler, "swap");
+
+    // Caps number of frames queued ahead of GPU
+    FramePacer framePacer;
+    createFramePacer(&framePacer, framesInFlight, profile);
+
     // Cube rotation vars
     float rotationAngle = 0.f;
     const float rotationSpeedRadians = (45.f * (M_PI / 180.f)); // rotate by 45 degree / s
 
-    // GL matrices setup
-    float modelMat[4][4] = {{0.f}};
-    float perspectiveMat[4][4] = {{0.f}};
-    float viewMat[4][4] = {{0.f}};
+    // GL matrices setup (uploaded as std140 uniform blocks)
+    FrameUniforms frameUniforms = { 0 };
 
     // Camera vectors setup
     const float cameraPos[] = {0.f, 0.f, 0.f}; // we position our camera at [0, 0, 0] in world space
@@ -137,6 +412,44 @@ int main(int argc, char** argv) {
     const float zNear = 0.01f; // near plane
     const float zFar = 1000.f; // far plane
 
+    // Regular (non-instanced) draws are gathered every frame and submitted sorted by state and depth
+    RenderQueue renderQueue;
+    createRenderQueue(&renderQueue, 16 + occludedCubeCount, zFar);
+
+    // Geometry generated every frame is written to stream buffer, its vertex array uses the same layout as cube mesh
+    StreamBuffer streamBuffer = { 0 };
+    GLuint streamVao = 0;
+    GLuint streamProgramId = 0; // streamed vertices are always read through vertex attributes
+    if (dynamicCubeCount > 0) {
+        createStreamBuffer(&streamBuffer, dynamicCubeCount * CUBE_VERTEX_COUNT * CUBE_VERTEX_STRIDE);
+        glGenVertexArrays(1, &streamVao);
+        attachCubeMeshBuffer(streamVao, streamBuffer.buffer);
+        invalidateGLStateCache();
+    }
+
+    // Optional scene of cubes drawn one by one, culled, sorted and recorded into command buffers on worker threads
+    SceneRecorder sceneRecorder;
+    if (sceneObjectCount > 0) {
+        createSceneRecorder(&sceneRecorder, sceneObjectCount, recordThreadCount, zFar);
+    }
+
+    // Bounding boxes of occluded cubes are tested against depth buffer after opaque draws, next frame uses the results
+    OcclusionCuller occlusionCuller;
+    if (occludedCubeCount > 0) {
+        createOcclusionCuller(&occlusionCuller, 0, meshVao);
+        for (unsigned int i = 0; i < occludedCubeCount; i++) {
+            addOccludedObject(&occlusionCuller);
+        }
+        invalidateGLStateCache();
+    }
+
+    // Frames are read back into pixel pack buffers and written to capture output on writer thread
+    // (capture keeps initial size, resized window is cropped or padded)
+    FrameCapture frameCapture;
+    if (captureOutput != NULL) {
+        createFrameCapture(&frameCapture, windowAttributes.width, windowAttributes.height, captureOutput);
+    }
+
     // Delta time between consecutive renders, used as "smoothing" value for rotation
     // Normally it would be applied to all movement on screen. 
     // Even better solution would be to use fixed timestep (especially if there is any physics 
@@ -157,7 +470,7 @@ int main(int argc, char** argv) {
         deltaTime = (float) timeDiffVal / 1.0e9f; // nanoseconds -> seconds
 
         // Handle X events first
-        while (XPending(linuxWindowInfo.display)) {
+        while (!headless && XPending(linuxWindowInfo.display)) {
             XNextEvent(linuxWindowInfo.display, &xEvent);
 
             // ConfigureNotify event is dispatched on window resize event (and other times too),
@@ -175,12 +488,6 @@ int main(int argc, char** argv) {
             } else if (xEvent.type == ClientMessage) {      
                 if ((unsigned long) xEvent.xclient.data.l[0] == wmDeleteMessage) {
                     LOG3DHW("[main] Received exit event, quitting...");
-
-                    glXMakeCurrent(linuxWindowInfo.display, None, NULL);
-                    glXDestroyContext(linuxWindowInfo.display, linuxWindowInfo.glContext);
-                    XDestroyWindow(linuxWindowInfo.display, linuxWindowInfo.window);
-                    XCloseDisplay(linuxWindowInfo.display);
-
                     running = false;
 
                     // We break here becasue we don't want to handle any more X events at this point.
@@ -192,45 +499,205 @@ int main(int argc, char** argv) {
 
         // Drawing begins here
         if (running) {
+            waitForFrameSlot(&framePacer);
+            beginGpuProfilerFrame(&gpuProfiler);
+
+            beginGpuScope(&gpuProfiler, clearScope);
             // Clear screen
             glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
             glClearColor((99.f / 255.f), (139.f / 255.f), (235.f / 255.f), 1.f);
+            endGpuScope(&gpuProfiler, clearScope);
 
-            // Preparing model matrix
-            mat4x4_identity(modelMat); // model matrix have to be identity matrix initially
-            mat4x4_translate(modelMat, 0.f, 0.f, -5.f); // apply translation to model matrix; move cube to the back, to be in front of camera
-            mat4x4_rotate(modelMat, modelMat, 0.7f, 0.2f, -0.8f, rotationAngle); // apply in-place rotation to model matrix
-            rotationAngle += (rotationSpeedRadians * deltaTime);
+            beginGpuScope(&gpuProfiler, drawScope);
 
             // Preparing perspective matrix
-            mat4x4_perspective(perspectiveMat, fov, ((float) windowAttributes.width / (float) windowAttributes.height), zNear, zFar);
+            mat4x4_perspective(frameUniforms.projection, fov, ((float) windowAttributes.width / (float) windowAttributes.height), zNear, zFar);
 
             // Preparing view (world-to-camera) matrix
-            mat4x4_look_at(viewMat, cameraPos, front, up);
+            mat4x4_look_at(frameUniforms.view, cameraPos, front, up);
+
+            // Pick up assets finished by loader thread (GPU waits for their upload fence once)
+            GLuint meshBuffer;
+            if (!meshReady && acquireAsset(&assetLoader, meshAsset, &meshBuffer)) {
+                attachIndexedCubeMeshBuffer(meshVao, meshBuffer);
+                invalidateGLStateCache();
+                meshReady = true;
+            }
+            if (textureId == placeholderTextureId) {
+                acquireAsset(&assetLoader, textureAsset, &textureId);
+            }
+            if (!programsReady) {
+                programsReady = acquireAsset(&assetLoader, cubeProgramAsset, &shaderProgramId);
+                if (dynamicCubeCount > 0) {
+                    programsReady &= acquireAsset(&assetLoader, streamProgramAsset, &streamProgramId);
+                }
+                if (instanceCount > 0) {
+                    programsReady &= acquireAsset(&assetLoader, instanceProgramAsset, &instanceBatch.programId);
+                }
+                if (occludedCubeCount > 0) {
+                    programsReady &= acquireAsset(&assetLoader, occlusionProgramAsset, &occlusionCuller.programId);
+                }
+            }
+
+            // Uniforms are written to this frame's region of the ring and bound by range, block bindings
+            // and sampler unit were already set when program was linked
+            beginUniformRingFrame(&uniformRing);
+            GLintptr frameUniformsOffset = pushUniforms(&uniformRing, &frameUniforms, sizeof(FrameUniforms));
+            bindUniforms(&uniformRing, FRAME_UNIFORMS_BINDING, frameUniformsOffset, sizeof(FrameUniforms));
+            if (vertexPulling) {
+                bindMeshPool(&meshPool);
+            }
+
+            cachedBindTexture(0, GL_TEXTURE_2D, textureId);
+
+            if (!meshReady || !programsReady) {
+                // Nothing to draw yet, frame just shows clear color
+            } else if (instanceCount > 0) {
+                // Drawing all cubes with single instanced draw call, model matrices are taken from instance buffer
+                updateInstanceGrid(&instanceBatch, rotationAngle);
+                if (gpuCulling) {
+                    cullInstanceBatch(&cullingPass, &instanceBatch, &frameUniforms);
+                    drawCulledInstanceBatch(&cullingPass, &instanceBatch);
+                } else {
+                    drawInstanceBatch(&instanceBatch);
+                }
+            } else if (sceneObjectCount > 0) {
+                // Only replay of already recorded commands runs on this thread
+                recordScene(&sceneRecorder, &uniformRing, &frameUniforms, shaderProgramId, textureId, cubeVao, cubeFirstIndex,
+                    cubeIndexCount, cubeIndexType, cubeDequantization, rotationAngle);
+                replayScene(&sceneRecorder, &uniformRing);
+            } else {
+                beginRenderQueue(&renderQueue);
+                if (occludedCubeCount > 0) {
+                    updateOcclusionResults(&occlusionCuller);
+                }
+                if (dynamicCubeCount > 0) {
+                    beginStreamBufferFrame(&streamBuffer);
+                }
+
+                // Cube is 5 units in front of camera, our cube have 36 indices -> 12 triangles
+                DrawItem* cube = addDrawItem(&renderQueue, RENDER_PASS_OPAQUE, shaderProgramId, textureId, cubeVao, cubeFirstIndex, cubeIndexCount, 5.f);
+                cube->indexType = cubeIndexType;
+
+                // Preparing model matrix
+                mat4x4_identity(cube->objectUniforms.model); // model matrix have to be identity matrix initially
+                mat4x4_translate(cube->objectUniforms.model, 0.f, 0.f, -5.f); // apply translation to model matrix; move cube to the back, to be in front of camera
+                mat4x4_rotate(cube->objectUniforms.model, (const float (*)[4]) cube->objectUniforms.model, 0.7f, 0.2f, -0.8f, rotationAngle); // apply in-place rotation to model matrix
+                mat4x4_mul(cube->objectUniforms.model, (const float (*)[4]) cube->objectUniforms.model, (const float (*)[4]) cubeDequantization);
+
+                // Small cubes orbiting the big one, regenerated on CPU every frame and written straight to stream buffer
+                if (dynamicCubeCount > 0) {
+                    GLintptr streamOffset;
+                    float* vertices = (float*) allocateStreamData(&streamBuffer, dynamicCubeCount * CUBE_VERTEX_COUNT * CUBE_VERTEX_STRIDE,
+                        CUBE_VERTEX_STRIDE, &streamOffset);
+                    for (unsigned int i = 0; i < dynamicCubeCount; i++) {
+                        float orbitAngle = rotationAngle + (float) i * 2.f * (float) M_PI / (float) dynamicCubeCount;
+                        mat4x4 model;
+                        mat4x4_translate(model, cosf(orbitAngle) * 3.f, sinf(orbitAngle) * 3.f, -5.f);
+                        mat4x4_rotate(model, (const float (*)[4]) model, 0.7f, 0.2f, -0.8f, -2.f * rotationAngle);
+                        mat4x4_scale_aniso(model, (const float (*)[4]) model, 0.2f, 0.2f, 0.2f);
+                        writeCubeVertices(vertices + i * CUBE_VERTEX_COUNT * (CUBE_VERTEX_STRIDE / sizeof(float)), model);
+                    }
+                    flushStreamBuffer(&streamBuffer);
+
+                    // Vertices are already in world space, so the whole ring is a single draw with identity model matrix
+                    DrawItem* dynamicCubes = addDrawItem(&renderQueue, RENDER_PASS_OPAQUE, streamProgramId, textureId, streamVao,
+                        (GLint) (streamOffset / CUBE_VERTEX_STRIDE), dynamicCubeCount * CUBE_VERTEX_COUNT, 5.f);
+                    mat4x4_identity(dynamicCubes->objectUniforms.model);
+                }
 
-            // Setting uniforms in shader program (we have to only pass pointer to first element of matrix)
-            glUseProgram(shaderProgramId);
-            glUniformMatrix4fv(glGetUniformLocation(shaderProgramId, "projection"), 1, false, &perspectiveMat[0][0]); 
-            glUniformMatrix4fv(glGetUniformLocation(shaderProgramId, "view"), 1, false, &viewMat[0][0]);
-            glUniformMatrix4fv(glGetUniformLocation(shaderProgramId, "model"), 1, false, &modelMat[0][0]);
+                // Layers of 4x4 smaller cubes behind the big one - mostly hidden, each is drawn conditionally on its last test
+                for (unsigned int i = 0; i < occludedCubeCount; i++) {
+                    float z = -12.f - 3.f * (float) (i / 16);
+                    DrawItem* occludedCube = addDrawItem(&renderQueue, RENDER_PASS_OPAQUE, shaderProgramId, textureId, cubeVao, cubeFirstIndex, cubeIndexCount, -z);
+                    occludedCube->indexType = cubeIndexType;
+                    mat4x4_translate(occludedCube->objectUniforms.model, ((float) (i % 4) - 1.5f) * 1.2f, ((float) (i / 4 % 4) - 1.5f) * 1.2f, z);
+                    mat4x4_scale_aniso(occludedCube->objectUniforms.model, (const float (*)[4]) occludedCube->objectUniforms.model, 0.5f, 0.5f, 0.5f);
+                    mat4x4_mul(occludedCube->objectUniforms.model, (const float (*)[4]) occludedCube->objectUniforms.model, (const float (*)[4]) cubeDequantization);
+                    setOccludedObjectBounds(&occlusionCuller, i, occludedCube->objectUniforms.model);
+                    occludedCube->occlusionQuery = getOcclusionQuery(&occlusionCuller, i);
+                }
 
-            glActiveTexture(GL_TEXTURE0);
-            glUniform1i(glGetUniformLocation(shaderProgramId, "texture_diffuse1"), 0);
-            glBindTexture(GL_TEXTURE_2D, textureId);
+                // Drawing cube (state stays bound, next frame binds the same one)
+                submitRenderQueue(&renderQueue, &uniformRing);
+                if (occludedCubeCount > 0) {
+                    issueOcclusionTests(&occlusionCuller, &uniformRing);
+                }
+                if (dynamicCubeCount > 0) {
+                    endStreamBufferFrame(&streamBuffer);
+                }
+            }
+            rotationAngle += (rotationSpeedRadians * deltaTime);
 
-            // Drawing cube
-            glBindVertexArray(meshVao);
-            glDrawArrays(GL_TRIANGLES, 0, 36); // our cube have 108 vertices -> 36 triangles
-            glBindVertexArray(0);
+            endUniformRingFrame(&uniformRing);
 
-            // Buffer swap at the end of render loop
-            glXSwapBuffers(linuxWindowInfo.display, linuxWindowInfo.window);
+            // Back buffer (or offscreen framebuffer) still holds the frame before swap
+            if (captureOutput != NULL) {
+                captureFrame(&frameCapture);
+            }
+            endGpuScope(&gpuProfiler, drawScope);
 
-            // Uncomment this (and unistd.h header) to see deltaTime in action - consistent cube rotation regardless of FPS.
+            // Buffer swap at the end of render loop
+            // (headless run has nothing to present, it just submits the frame and stops after the last one)
+            beginGpuScope(&gpuProfiler, swapScope);
+            if (headless) {
+                running = endHeadlessFrame(&headlessContext);
+            } else {
+                glXSwapBuffers(linuxWindowInfo.display, linuxWindowInfo.window);
+            }
+            endGpuScope(&gpuProfiler, swapScope);
+            endFramePacerFrame(&framePacer);
+
+            endGpuProfilerFrame(&gpuProfiler);
+            endGLStateCacheFrame();
+
+            // Uncomment this to see deltaTime in action - consistent cube rotation regardless of FPS.
             // This simulates frame time of ~100ms (10FPS) 
             // usleep(100000);
         }
     }  
 
+    if (instanceCount > 0) {
+        if (gpuCulling) {
+            destroyCullingPass(&cullingPass);
+        }
+        destroyInstanceBatch(&instanceBatch);
+    }
+    destroyUniformRing(&uniformRing);
+    destroyAssetLoader(&assetLoader);
+    glDeleteTextures(1, &placeholderTextureId);
+    glDeleteVertexArrays(1, &meshVao);
+    destroyGpuProfiler(&gpuProfiler);
+    destroyFramePacer(&framePacer);
+    destroyRenderQueue(&renderQueue);
+    if (dynamicCubeCount > 0) {
+        glDeleteVertexArrays(1, &streamVao);
+        destroyStreamBuffer(&streamBuffer);
+    }
+    if (occludedCubeCount > 0) {
+        destroyOcclusionCuller(&occlusionCuller);
+    }
+    if (vertexPulling) {
+        destroyMeshPool(&meshPool);
+    }
+    if (sceneObjectCount > 0) {
+        destroySceneRecorder(&sceneRecorder);
+    }
+    if (captureOutput != NULL) {
+        destroyFrameCapture(&frameCapture);
+    }
+    destroyGLStateCache();
+
+    if (headless) {
+        destroyHeadlessContext(&headlessContext);
+    } else {
+        glXMakeCurrent(linuxWindowInfo.display, None, NULL);
+        glXDestroyContext(linuxWindowInfo.display, linuxWindowInfo.loaderContext);
+        glXDestroyPbuffer(linuxWindowInfo.display, linuxWindowInfo.loaderPbuffer);
+        glXDestroyContext(linuxWindowInfo.display, linuxWindowInfo.glContext);
+        XDestroyWindow(linuxWindowInfo.display, linuxWindowInfo.window);
+        XCloseDisplay(linuxWindowInfo.display);
+    }
+
     return EXIT_SUCCESS;
 }
\ No newline at end of file
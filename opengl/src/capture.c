@@ -0,0 +1,209 @@
+// Use IEEE Standard 1003.1-2008 POSIX extensions (dup(), fdopen())
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "capture.h"
+#include "glstate.h"
+#include "glad/gl.h"
+#include "utils.h"
+
+// "-" writes video to stdout. Log output goes to stdout on Linux too, so it's moved to stderr -
+// has to be called before anything is logged, otherwise the log ends up in the video.
+FILE* openCaptureOutput(const char* path) {
+    FILE* output = NULL;
+    if (strcmp(path, "-") != 0) {
+        output = fopen(path, "wb");
+    } else {
+#ifdef _WIN32
+        _setmode(_fileno(stdout), _O_BINARY);
+        output = stdout;
+#else
+        fflush(stdout);
+        int videoFd = dup(STDOUT_FILENO);
+        dup2(STDERR_FILENO, STDOUT_FILENO);
+        output = fdopen(videoFd, "wb");
+#endif
+    }
+
+    if (output == NULL) {
+        LOG3DHW("[capture] Failed opening capture output %s!", path);
+        exit(-1);
+    }
+
+    return output;
+}
+
+static void captureWriter(void* userData) {
+    FrameCapture* capture = (FrameCapture*) userData;
+    size_t rowSize = (size_t) capture->width * 4;
+
+    lockMutex(&capture->mutex);
+    while (true) {
+        while (capture->running && capture->queueCount == 0) {
+            waitCondVar(&capture->frameQueued, &capture->mutex);
+        }
+
+        // Queue is drained before exiting, so no captured frame is lost
+        if (capture->queueCount == 0) {
+            break;
+        }
+        unsigned char* frame = capture->frames[capture->queueHead];
+        unlockMutex(&capture->mutex);
+
+        // GL rows start at the bottom, video rows at the top
+        for (GLsizei row = capture->height - 1; row >= 0; row--) {
+            fwrite(frame + (size_t) row * rowSize, 1, rowSize, capture->output);
+        }
+
+        lockMutex(&capture->mutex);
+        capture->queueHead = (capture->queueHead + 1) % CAPTURE_WRITE_QUEUE_SIZE;
+        capture->queueCount--;
+        capture->writtenFrames++;
+        signalCondVar(&capture->frameWritten);
+    }
+    unlockMutex(&capture->mutex);
+
+    fflush(capture->output);
+}
+
+void createFrameCapture(FrameCapture* capture, GLsizei width, GLsizei height, FILE* output) {
+    memset(capture, 0, sizeof(FrameCapture));
+    capture->width = width;
+    capture->height = height;
+    capture->frameSize = (size_t) width * (size_t) height * 4;
+    capture->output = output;
+
+    glGenBuffers(CAPTURE_RING_SIZE, capture->pbos);
+    for (unsigned int i = 0; i < CAPTURE_RING_SIZE; i++) {
+        cachedBindBuffer(GL_PIXEL_PACK_BUFFER, capture->pbos[i]);
+        glBufferData(GL_PIXEL_PACK_BUFFER, capture->frameSize, NULL, GL_STREAM_READ);
+    }
+    cachedBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    for (unsigned int i = 0; i < CAPTURE_WRITE_QUEUE_SIZE; i++) {
+        capture->frames[i] = (unsigned char*) malloc(capture->frameSize);
+    }
+
+    capture->running = true;
+    initMutex(&capture->mutex);
+    initCondVar(&capture->frameQueued);
+    initCondVar(&capture->frameWritten);
+    if (!createThread(&capture->writer, captureWriter, capture)) {
+        LOG3DHW("[capture] Failed creating capture writer thread!");
+        exit(-1);
+    }
+
+    LOG3DHW("[capture] Capturing %dx%d RGBA frames (%d pixel pack buffers)", width, height, CAPTURE_RING_SIZE);
+}
+
+// Maps the oldest pending buffer if GPU has finished copying into it (or waits up to timeout for it)
+// and hands its pixels over to writer thread
+static bool collectOldestFrame(FrameCapture* capture, GLuint64 timeout) {
+    unsigned int slot = capture->oldestPending;
+    GLenum result = glClientWaitSync(capture->fences[slot], timeout > 0 ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, timeout);
+    if (result == GL_TIMEOUT_EXPIRED) {
+        return false;
+    }
+    if (result == GL_WAIT_FAILED) {
+        LOG3DHW("[capture] Failed waiting for readback fence!");
+        exit(-1);
+    }
+    glDeleteSync(capture->fences[slot]);
+    capture->fences[slot] = NULL;
+
+    lockMutex(&capture->mutex);
+    while (capture->queueCount == CAPTURE_WRITE_QUEUE_SIZE) {
+        capture->writerStalls++;
+        waitCondVar(&capture->frameWritten, &capture->mutex);
+    }
+    unsigned char* frame = capture->frames[(capture->queueHead + capture->queueCount) % CAPTURE_WRITE_QUEUE_SIZE];
+    unlockMutex(&capture->mutex);
+
+    // Buffer is already filled, so mapping doesn't wait for GPU
+    cachedBindBuffer(GL_PIXEL_PACK_BUFFER, capture->pbos[slot]);
+    const void* pixels = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, capture->frameSize, GL_MAP_READ_BIT);
+    if (pixels == NULL) {
+        LOG3DHW("[capture] Failed mapping pixel pack buffer!");
+        exit(-1);
+    }
+    memcpy(frame, pixels, capture->frameSize);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+    lockMutex(&capture->mutex);
+    capture->queueCount++;
+    signalCondVar(&capture->frameQueued);
+    unlockMutex(&capture->mutex);
+
+    capture->oldestPending = (capture->oldestPending + 1) % CAPTURE_RING_SIZE;
+    capture->pendingCount--;
+
+    return true;
+}
+
+// Has to be called after the frame is rendered and before buffer swap (reads from the current read framebuffer)
+void captureFrame(FrameCapture* capture) {
+    // Collect everything GPU has finished so far, without waiting
+    while (capture->pendingCount > 0 && collectOldestFrame(capture, 0)) {
+    }
+
+    // All buffers still in flight - only happens when GPU is CAPTURE_RING_SIZE frames behind.
+    // Slot has to be freed before it's reused (and video can't skip frames), so this waits as long as it takes.
+    if (capture->pendingCount == CAPTURE_RING_SIZE) {
+        capture->ringStalls++;
+        while (!collectOldestFrame(capture, 1000000000)) { // 1 s
+            LOG3DHW("[capture] Readback of frame still not finished after 1 s, waiting more");
+        }
+    }
+
+    // With pack buffer bound, glReadPixels only queues the copy and returns right away
+    unsigned int slot = (capture->oldestPending + capture->pendingCount) % CAPTURE_RING_SIZE;
+    cachedBindBuffer(GL_PIXEL_PACK_BUFFER, capture->pbos[slot]);
+    glReadPixels(0, 0, capture->width, capture->height, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    capture->fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    capture->pendingCount++;
+    capture->capturedFrames++;
+
+    // Pack buffer binding would turn any other pixel read into buffer copy
+    cachedBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+// Collects frames still in flight and waits for writer thread to write all of them
+void destroyFrameCapture(FrameCapture* capture) {
+    while (capture->pendingCount > 0) {
+        if (!collectOldestFrame(capture, 1000000000)) { // 1 s
+            LOG3DHW("[capture] Readback of frame still not finished after 1 s, waiting more");
+        }
+    }
+    cachedBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    lockMutex(&capture->mutex);
+    capture->running = false;
+    broadcastCondVar(&capture->frameQueued);
+    unlockMutex(&capture->mutex);
+    joinThread(capture->writer);
+
+    destroyCondVar(&capture->frameWritten);
+    destroyCondVar(&capture->frameQueued);
+    destroyMutex(&capture->mutex);
+
+    for (unsigned int i = 0; i < CAPTURE_WRITE_QUEUE_SIZE; i++) {
+        free(capture->frames[i]);
+    }
+    glDeleteBuffers(CAPTURE_RING_SIZE, capture->pbos);
+
+    if (capture->output != stdout) {
+        fclose(capture->output);
+    }
+
+    LOG3DHW("[capture] Captured %llu frames, %llu written (readback ring stalls: %llu, writer stalls: %llu)",
+        capture->capturedFrames, capture->writtenFrames, capture->ringStalls, capture->writerStalls);
+}
@@ -0,0 +1,151 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "commandbuffer.h"
+#include "glstate.h"
+#include "glad/gl.h"
+#include "utils.h"
+
+void createCommandBuffer(CommandBuffer* commands, size_t capacity) {
+    commands->data = (unsigned char*) malloc(capacity);
+    commands->size = 0;
+    commands->capacity = capacity;
+    commands->commandCount = 0;
+}
+
+void resetCommandBuffer(CommandBuffer* commands) {
+    commands->size = 0;
+    commands->commandCount = 0;
+}
+
+// Reserves command with given payload size and returns pointer to the payload
+static void* appendCommand(CommandBuffer* commands, CommandType type, size_t payloadSize) {
+    size_t size = (sizeof(CommandHeader) + payloadSize + COMMAND_ALIGNMENT - 1) / COMMAND_ALIGNMENT * COMMAND_ALIGNMENT;
+    if (size > UINT16_MAX) {
+        LOG3DHW("[commandbuffer] Command too large (%zu bytes)!", size);
+        exit(-1);
+    }
+
+    // Buffer only grows, after first few frames it has the size needed and recording doesn't allocate anymore
+    if (commands->size + size > commands->capacity) {
+        size_t capacity = commands->capacity * 2 > commands->size + size ? commands->capacity * 2 : commands->size + size;
+        commands->data = (unsigned char*) realloc(commands->data, capacity);
+        if (commands->data == NULL) {
+            LOG3DHW("[commandbuffer] Failed growing command buffer to %zu bytes!", capacity);
+            exit(-1);
+        }
+        commands->capacity = capacity;
+    }
+
+    CommandHeader* header = (CommandHeader*) (commands->data + commands->size);
+    header->type = (uint16_t) type;
+    header->size = (uint16_t) size;
+    commands->size += size;
+    commands->commandCount++;
+
+    return header + 1;
+}
+
+void recordUseProgram(CommandBuffer* commands, GLuint programId) {
+    UseProgramCommand* command = (UseProgramCommand*) appendCommand(commands, COMMAND_USE_PROGRAM, sizeof(UseProgramCommand));
+    command->programId = programId;
+}
+
+void recordBindTexture(CommandBuffer* commands, GLuint textureId) {
+    BindTextureCommand* command = (BindTextureCommand*) appendCommand(commands, COMMAND_BIND_TEXTURE, sizeof(BindTextureCommand));
+    command->textureId = textureId;
+}
+
+void recordBindVertexArray(CommandBuffer* commands, GLuint vao) {
+    BindVertexArrayCommand* command = (BindVertexArrayCommand*) appendCommand(commands, COMMAND_BIND_VERTEX_ARRAY,
+        sizeof(BindVertexArrayCommand));
+    command->vao = vao;
+}
+
+// Uniform data is already in uniform ring (see reserveUniforms()), replay only binds it
+void recordBindUniforms(CommandBuffer* commands, GLuint binding, GLintptr offset, GLsizeiptr size) {
+    BindUniformsCommand* command = (BindUniformsCommand*) appendCommand(commands, COMMAND_BIND_UNIFORMS, sizeof(BindUniformsCommand));
+    command->binding = binding;
+    command->offset = (uint32_t) offset;
+    command->size = (uint32_t) size;
+}
+
+void recordDrawArrays(CommandBuffer* commands, GLint firstVertex, GLsizei vertexCount, GLuint occlusionQuery) {
+    DrawArraysCommand* command = (DrawArraysCommand*) appendCommand(commands, COMMAND_DRAW_ARRAYS, sizeof(DrawArraysCommand));
+    command->firstVertex = firstVertex;
+    command->vertexCount = vertexCount;
+    command->occlusionQuery = occlusionQuery;
+}
+
+// Indices are read from element buffer of the vertex array bound at replay
+void recordDrawElements(CommandBuffer* commands, GLint firstIndex, GLsizei indexCount, GLenum indexType, GLuint occlusionQuery) {
+    DrawElementsCommand* command = (DrawElementsCommand*) appendCommand(commands, COMMAND_DRAW_ELEMENTS, sizeof(DrawElementsCommand));
+    command->firstIndex = firstIndex;
+    command->indexCount = indexCount;
+    command->indexType = indexType;
+    command->occlusionQuery = occlusionQuery;
+}
+
+// Has to be called on render thread, inside uniform ring frame. Binds go through state cache,
+// so state recorded again at the start of every buffer doesn't reach the driver when it's already set.
+void replayCommandBuffer(const CommandBuffer* commands, UniformRing* uniformRing) {
+    const unsigned char* position = commands->data;
+    const unsigned char* end = commands->data + commands->size;
+    while (position < end) {
+        const CommandHeader* header = (const CommandHeader*) position;
+        const void* payload = header + 1;
+
+        switch (header->type) {
+            case COMMAND_USE_PROGRAM:
+                cachedUseProgram(((const UseProgramCommand*) payload)->programId);
+                break;
+            case COMMAND_BIND_TEXTURE:
+                cachedBindTexture(0, GL_TEXTURE_2D, ((const BindTextureCommand*) payload)->textureId);
+                break;
+            case COMMAND_BIND_VERTEX_ARRAY:
+                cachedBindVertexArray(((const BindVertexArrayCommand*) payload)->vao);
+                break;
+            case COMMAND_BIND_UNIFORMS: {
+                const BindUniformsCommand* command = (const BindUniformsCommand*) payload;
+                bindUniforms(uniformRing, command->binding, command->offset, command->size);
+                break;
+            }
+            case COMMAND_DRAW_ARRAYS: {
+                const DrawArraysCommand* command = (const DrawArraysCommand*) payload;
+                if (command->occlusionQuery != 0) {
+                    // No wait - if test result isn't available yet, object is drawn
+                    glBeginConditionalRender(command->occlusionQuery, GL_QUERY_NO_WAIT);
+                    glDrawArrays(GL_TRIANGLES, command->firstVertex, command->vertexCount);
+                    glEndConditionalRender();
+                } else {
+                    glDrawArrays(GL_TRIANGLES, command->firstVertex, command->vertexCount);
+                }
+                break;
+            }
+            case COMMAND_DRAW_ELEMENTS: {
+                const DrawElementsCommand* command = (const DrawElementsCommand*) payload;
+                const void* indices = (const void*) ((size_t) command->firstIndex
+                    * (command->indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint)));
+                if (command->occlusionQuery != 0) {
+                    glBeginConditionalRender(command->occlusionQuery, GL_QUERY_NO_WAIT);
+                    glDrawElements(GL_TRIANGLES, command->indexCount, command->indexType, indices);
+                    glEndConditionalRender();
+                } else {
+                    glDrawElements(GL_TRIANGLES, command->indexCount, command->indexType, indices);
+                }
+                break;
+            }
+            default:
+                LOG3DHW("[commandbuffer] Unknown command type %d!", header->type);
+                exit(-1);
+        }
+
+        position += header->size;
+    }
+}
+
+void destroyCommandBuffer(CommandBuffer* commands) {
+    free(commands->data);
+    commands->data = NULL;
+    commands->size = commands->capacity = 0;
+}
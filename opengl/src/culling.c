@@ -0,0 +1,134 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "glad/gl.h"
+#include "linmath.h"
+
+#include "culling.h"
+#include "glstate.h"
+#include "shader.h"
+#include "utils.h"
+
+// Gribb-Hartmann: planes are sums/differences of rows of view-projection matrix (linmath is column-major, M[column][row]).
+// Normalized so plane distance is in world units and can be compared with bounding sphere radius.
+void extractFrustumPlanes(float viewProjection[4][4], GLfloat planes[6][4]) {
+    for (int i = 0; i < 3; i++) {
+        for (int column = 0; column < 4; column++) {
+            planes[i * 2][column] = viewProjection[column][3] + viewProjection[column][i];
+            planes[i * 2 + 1][column] = viewProjection[column][3] - viewProjection[column][i];
+        }
+    }
+
+    for (int i = 0; i < 6; i++) {
+        float length = sqrtf(planes[i][0] * planes[i][0] + planes[i][1] * planes[i][1] + planes[i][2] * planes[i][2]);
+        for (int column = 0; column < 4; column++) {
+            planes[i][column] /= length;
+        }
+    }
+}
+
+// Same test as culling compute shader does for each instance
+bool isSphereInFrustum(GLfloat planes[6][4], const float center[3], float radius) {
+    for (int i = 0; i < 6; i++) {
+        if (planes[i][0] * center[0] + planes[i][1] * center[1] + planes[i][2] * center[2] + planes[i][3] <= -radius) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void createCullingPass(CullingPass* pass, const InstanceBatch* batch, float boundingRadius) {
+    memset(pass, 0, sizeof(CullingPass));
+    pass->resetCommand.count = (GLuint) batch->indexCount;
+
+    pass->programId = loadAndLinkComputeProgramFromSource(GLSL_CULLING_COMPUTE_SHADER);
+    glShaderStorageBlockBinding(pass->programId,
+        glGetProgramResourceIndex(pass->programId, GL_SHADER_STORAGE_BLOCK, "CullingModels"), CULLING_MODELS_BINDING);
+    glShaderStorageBlockBinding(pass->programId,
+        glGetProgramResourceIndex(pass->programId, GL_SHADER_STORAGE_BLOCK, "CullingVisibleModels"), CULLING_VISIBLE_MODELS_BINDING);
+    glShaderStorageBlockBinding(pass->programId,
+        glGetProgramResourceIndex(pass->programId, GL_SHADER_STORAGE_BLOCK, "CullingCommand"), CULLING_COMMAND_BINDING);
+    pass->frustumPlanesLocation = glGetUniformLocation(pass->programId, "frustum_planes");
+    pass->boundingRadiusLocation = glGetUniformLocation(pass->programId, "bounding_radius");
+    pass->instanceCountLocation = glGetUniformLocation(pass->programId, "instance_count");
+
+    // These never change, only frustum planes are set every frame
+    cachedUseProgram(pass->programId);
+    glUniform1f(pass->boundingRadiusLocation, boundingRadius);
+    glUniform1ui(pass->instanceCountLocation, (GLuint) batch->count);
+
+    // Written by GPU only, read back by GPU only; room for all instances in case all of them are visible
+    glGenBuffers(1, &pass->visibleModelBuffer);
+    cachedBindBuffer(GL_SHADER_STORAGE_BUFFER, pass->visibleModelBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(mat4x4) * batch->count, NULL, GL_DYNAMIC_COPY);
+
+    glGenBuffers(1, &pass->commandBuffer);
+    cachedBindBuffer(GL_DRAW_INDIRECT_BUFFER, pass->commandBuffer);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER, sizeof(DrawElementsIndirectCommand), &pass->resetCommand, GL_DYNAMIC_DRAW);
+
+    // Instance attributes take model matrices from compacted buffer from now on, batch buffer is only read by culling
+    if (batch->layout == INSTANCE_LAYOUT_ATTRIBUTES) {
+        cachedBindVertexArray(batch->vao);
+        cachedBindBuffer(GL_ARRAY_BUFFER, pass->visibleModelBuffer);
+        for (GLuint column = 0; column < 4; column++) {
+            glVertexAttribPointer(INSTANCE_MODEL_ATTRIBUTE_LOCATION + column, 4, GL_FLOAT, GL_FALSE, sizeof(mat4x4),
+                (void*) (column * sizeof(vec4)));
+        }
+        cachedBindVertexArray(0);
+    }
+
+    LOG3DHW("[culling] Created GPU culling pass (programId=%d, visibleModelBuffer=%d, commandBuffer=%d, %d instances, layout=%s)",
+        pass->programId, pass->visibleModelBuffer, pass->commandBuffer, batch->count, instanceLayoutName(batch->layout));
+}
+
+// Has to be called after instance models for the frame were uploaded and before drawCulledInstanceBatch()
+void cullInstanceBatch(CullingPass* pass, const InstanceBatch* batch, const FrameUniforms* frameUniforms) {
+    mat4x4 projection, view, viewProjection;
+    memcpy(projection, frameUniforms->projection, sizeof(mat4x4));
+    memcpy(view, frameUniforms->view, sizeof(mat4x4));
+    mat4x4_mul(viewProjection, (const float (*)[4]) projection, (const float (*)[4]) view);
+
+    GLfloat planes[6][4];
+    extractFrustumPlanes(viewProjection, planes);
+
+    // Visible instance counter starts from zero every frame
+    if (hasDirectStateAccess()) {
+        glNamedBufferSubData(pass->commandBuffer, 0, sizeof(DrawElementsIndirectCommand), &pass->resetCommand);
+    } else {
+        cachedBindBuffer(GL_DRAW_INDIRECT_BUFFER, pass->commandBuffer);
+        glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, sizeof(DrawElementsIndirectCommand), &pass->resetCommand);
+    }
+
+    cachedUseProgram(pass->programId);
+    glUniform4fv(pass->frustumPlanesLocation, 6, &planes[0][0]);
+    cachedBindBufferRange(GL_SHADER_STORAGE_BUFFER, CULLING_MODELS_BINDING, batch->buffer, 0, sizeof(mat4x4) * batch->count);
+    cachedBindBufferRange(GL_SHADER_STORAGE_BUFFER, CULLING_VISIBLE_MODELS_BINDING, pass->visibleModelBuffer, 0,
+        sizeof(mat4x4) * batch->count);
+    cachedBindBufferRange(GL_SHADER_STORAGE_BUFFER, CULLING_COMMAND_BINDING, pass->commandBuffer, 0, sizeof(DrawElementsIndirectCommand));
+    glDispatchCompute((batch->count + CULLING_WORKGROUP_SIZE - 1) / CULLING_WORKGROUP_SIZE, 1, 1);
+
+    // Indirect draw reads command through a different path than shader storage writes, and compacted models
+    // are read either as instance attributes or from shader storage
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+}
+
+// Whole batch is a single instanced draw of visible instances, culled ones are not in compacted buffer at all
+void drawCulledInstanceBatch(CullingPass* pass, const InstanceBatch* batch) {
+    cachedUseProgram(batch->programId);
+    if (batch->layout == INSTANCE_LAYOUT_STORAGE_BUFFER) {
+        cachedBindBufferRange(GL_SHADER_STORAGE_BUFFER, INSTANCE_STORAGE_BINDING, pass->visibleModelBuffer, 0,
+            sizeof(mat4x4) * batch->count);
+    }
+
+    cachedBindVertexArray(batch->vao);
+    cachedBindBuffer(GL_DRAW_INDIRECT_BUFFER, pass->commandBuffer);
+    glDrawElementsIndirect(GL_TRIANGLES, batch->indexType, NULL);
+}
+
+void destroyCullingPass(CullingPass* pass) {
+    glDeleteBuffers(1, &pass->commandBuffer);
+    glDeleteBuffers(1, &pass->visibleModelBuffer);
+    glDeleteProgram(pass->programId);
+}
@@ -0,0 +1,93 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "framepacing.h"
+#include "glad/gl.h"
+#include "utils.h"
+
+// Fence is inserted after every buffer swap. Before CPU starts recording a new frame, it waits for fence of frame
+// which was submitted maxFramesInFlight frames ago, so no more than maxFramesInFlight frames are ever queued.
+// Less queued frames means lower input latency, more of them gives GPU room when CPU frame times vary.
+void createFramePacer(FramePacer* pacer, unsigned int maxFramesInFlight, bool report) {
+    memset(pacer, 0, sizeof(FramePacer));
+    if (maxFramesInFlight > FRAME_PACER_MAX_FRAMES_IN_FLIGHT) {
+        LOG3DHW("[framepacing] Frames in flight limited to %d (requested: %d)", FRAME_PACER_MAX_FRAMES_IN_FLIGHT, maxFramesInFlight);
+        maxFramesInFlight = FRAME_PACER_MAX_FRAMES_IN_FLIGHT;
+    }
+    pacer->maxFramesInFlight = maxFramesInFlight;
+    pacer->report = report;
+    pacer->frameTimeMinMs = INFINITY;
+
+    pacer->reportStartMs = monotonicMilliseconds();
+    pacer->lastFrameEndMs = pacer->reportStartMs;
+
+    if (maxFramesInFlight > 0) {
+        LOG3DHW("[framepacing] Created frame pacer (max frames in flight: %d)", maxFramesInFlight);
+    } else {
+        LOG3DHW("[framepacing] Created frame pacer (frames in flight not limited)");
+    }
+}
+
+void waitForFrameSlot(FramePacer* pacer) {
+    if (pacer->maxFramesInFlight == 0) {
+        return;
+    }
+
+    GLsync fence = pacer->fences[pacer->frame];
+    if (fence == NULL) {
+        return;
+    }
+
+    double waitStartMs = monotonicMilliseconds();
+
+    GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000); // 1 s
+    if (result == GL_WAIT_FAILED || result == GL_TIMEOUT_EXPIRED) {
+        LOG3DHW("[framepacing] Failed waiting for frame fence (result: 0x%x)!", result);
+    }
+    glDeleteSync(fence);
+    pacer->fences[pacer->frame] = NULL;
+
+    pacer->waitTotalMs += monotonicMilliseconds() - waitStartMs;
+}
+
+// Has to be called right after buffer swap
+void endFramePacerFrame(FramePacer* pacer) {
+    if (pacer->maxFramesInFlight > 0) {
+        pacer->fences[pacer->frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        pacer->frame = (pacer->frame + 1) % pacer->maxFramesInFlight;
+    }
+
+    // Jitter is standard deviation of frame-to-frame time, with vsync it should be close to zero
+    double nowMs = monotonicMilliseconds();
+    double frameTimeMs = nowMs - pacer->lastFrameEndMs;
+    pacer->lastFrameEndMs = nowMs;
+
+    pacer->frameTimeTotalMs += frameTimeMs;
+    pacer->frameTimeSquaresTotal += frameTimeMs * frameTimeMs;
+    pacer->frameTimeMinMs = frameTimeMs < pacer->frameTimeMinMs ? frameTimeMs : pacer->frameTimeMinMs;
+    pacer->frameTimeMaxMs = frameTimeMs > pacer->frameTimeMaxMs ? frameTimeMs : pacer->frameTimeMaxMs;
+    pacer->frames++;
+
+    if (pacer->report && nowMs - pacer->reportStartMs >= FRAME_PACER_REPORT_INTERVAL * 1000.f) {
+        double meanMs = pacer->frameTimeTotalMs / pacer->frames;
+        double variance = pacer->frameTimeSquaresTotal / pacer->frames - meanMs * meanMs;
+        double jitterMs = variance > 0.0 ? sqrt(variance) : 0.0;
+
+        LOG3DHW("[framepacing] %.1f FPS, frame time %.3f ms (min %.3f ms, max %.3f ms), jitter %.3f ms, fence wait %.3f ms/frame",
+            1000.0 / meanMs, meanMs, pacer->frameTimeMinMs, pacer->frameTimeMaxMs, jitterMs, pacer->waitTotalMs / pacer->frames);
+
+        pacer->frameTimeTotalMs = pacer->frameTimeSquaresTotal = pacer->frameTimeMaxMs = pacer->waitTotalMs = 0.0;
+        pacer->frameTimeMinMs = INFINITY;
+        pacer->frames = 0;
+        pacer->reportStartMs = nowMs;
+    }
+}
+
+void destroyFramePacer(FramePacer* pacer) {
+    for (unsigned int i = 0; i < FRAME_PACER_MAX_FRAMES_IN_FLIGHT; i++) {
+        if (pacer->fences[i] != NULL) {
+            glDeleteSync(pacer->fences[i]);
+        }
+    }
+}
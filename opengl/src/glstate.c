@@ -0,0 +1,255 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "glstate.h"
+#include "glad/gl.h"
+#include "utils.h"
+
+#define GL_STATE_UNKNOWN 0xFFFFFFFFu
+
+// Generic buffer binding points which are shadowed, others are always passed through
+static const GLenum BUFFER_TARGETS[] = {
+    GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_UNIFORM_BUFFER, GL_SHADER_STORAGE_BUFFER, GL_PIXEL_PACK_BUFFER,
+    GL_PIXEL_UNPACK_BUFFER, GL_DRAW_INDIRECT_BUFFER, GL_DISPATCH_INDIRECT_BUFFER, GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER
+};
+#define BUFFER_TARGET_COUNT (sizeof(BUFFER_TARGETS) / sizeof(BUFFER_TARGETS[0]))
+
+typedef struct BufferRange {
+    GLuint buffer;
+    GLintptr offset;
+    GLsizeiptr size;
+} BufferRange;
+
+typedef struct GLStateCache {
+    bool directStateAccess;
+    bool report;
+
+    GLuint program;
+    GLuint vao;
+    GLuint activeTextureUnit;
+    GLenum textureTargets[GL_STATE_MAX_TEXTURE_UNITS];
+    GLuint textures[GL_STATE_MAX_TEXTURE_UNITS];
+    GLuint buffers[BUFFER_TARGET_COUNT];
+    BufferRange uniformRanges[GL_STATE_MAX_BUFFER_INDICES];
+    BufferRange storageRanges[GL_STATE_MAX_BUFFER_INDICES];
+    GLenum capabilities[GL_STATE_MAX_CAPABILITIES];
+    GLuint capabilityStates[GL_STATE_MAX_CAPABILITIES]; // GL_TRUE, GL_FALSE or GL_STATE_UNKNOWN
+    unsigned int capabilityCount;
+
+    // Statistics
+    unsigned long long issuedTotal;
+    unsigned long long skippedTotal;
+    unsigned long issued;
+    unsigned long skipped;
+    unsigned int frames;
+    double reportStartMs;
+} GLStateCache;
+
+static GLStateCache cache;
+
+// Returns true when GL has to be called, otherwise call is counted as skipped
+static bool changeState(GLuint* current, GLuint value) {
+    if (*current == value) {
+        cache.skipped++;
+        return false;
+    }
+
+    *current = value;
+    cache.issued++;
+    return true;
+}
+
+static GLuint* findBufferBinding(GLenum target) {
+    for (unsigned int i = 0; i < BUFFER_TARGET_COUNT; i++) {
+        if (BUFFER_TARGETS[i] == target) {
+            return &cache.buffers[i];
+        }
+    }
+
+    return NULL;
+}
+
+static GLuint* findCapabilityState(GLenum capability) {
+    for (unsigned int i = 0; i < cache.capabilityCount; i++) {
+        if (cache.capabilities[i] == capability) {
+            return &cache.capabilityStates[i];
+        }
+    }
+
+    if (cache.capabilityCount >= GL_STATE_MAX_CAPABILITIES) {
+        return NULL;
+    }
+
+    cache.capabilities[cache.capabilityCount] = capability;
+    cache.capabilityStates[cache.capabilityCount] = GL_STATE_UNKNOWN;
+    return &cache.capabilityStates[cache.capabilityCount++];
+}
+
+void createGLStateCache(bool report) {
+    memset(&cache, 0, sizeof(GLStateCache));
+    cache.directStateAccess = GLAD_GL_ARB_direct_state_access;
+    cache.report = report;
+    invalidateGLStateCache();
+    cache.reportStartMs = monotonicMilliseconds();
+
+    LOG3DHW("[glstate] Created GL state cache (direct state access: %s)", cache.directStateAccess ? "yes" : "no");
+}
+
+// Next call of every cached*() function will reach GL, no matter what value is set
+void invalidateGLStateCache(void) {
+    cache.program = GL_STATE_UNKNOWN;
+    cache.vao = GL_STATE_UNKNOWN;
+    cache.activeTextureUnit = GL_STATE_UNKNOWN;
+    for (unsigned int i = 0; i < GL_STATE_MAX_TEXTURE_UNITS; i++) {
+        cache.textures[i] = GL_STATE_UNKNOWN;
+    }
+    for (unsigned int i = 0; i < BUFFER_TARGET_COUNT; i++) {
+        cache.buffers[i] = GL_STATE_UNKNOWN;
+    }
+    for (unsigned int i = 0; i < GL_STATE_MAX_BUFFER_INDICES; i++) {
+        cache.uniformRanges[i].buffer = GL_STATE_UNKNOWN;
+        cache.storageRanges[i].buffer = GL_STATE_UNKNOWN;
+    }
+    for (unsigned int i = 0; i < cache.capabilityCount; i++) {
+        cache.capabilityStates[i] = GL_STATE_UNKNOWN;
+    }
+}
+
+bool hasDirectStateAccess(void) {
+    return cache.directStateAccess;
+}
+
+void cachedUseProgram(GLuint program) {
+    if (changeState(&cache.program, program)) {
+        glUseProgram(program);
+    }
+}
+
+void cachedBindVertexArray(GLuint vao) {
+    if (changeState(&cache.vao, vao)) {
+        glBindVertexArray(vao);
+
+        // Element array binding is part of VAO state
+        *findBufferBinding(GL_ELEMENT_ARRAY_BUFFER) = GL_STATE_UNKNOWN;
+    }
+}
+
+// With DSA texture is bound straight to the unit, otherwise active unit has to be switched first
+// (which is a state change on its own, so it's cached too)
+void cachedBindTexture(GLuint unit, GLenum target, GLuint texture) {
+    if (unit >= GL_STATE_MAX_TEXTURE_UNITS) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(target, texture);
+        cache.activeTextureUnit = unit;
+        cache.issued += 2;
+        return;
+    }
+
+    // Binding to a different target of the same unit doesn't replace the previous texture
+    if (cache.textureTargets[unit] != target) {
+        cache.textureTargets[unit] = target;
+        cache.textures[unit] = GL_STATE_UNKNOWN;
+    }
+    if (!changeState(&cache.textures[unit], texture)) {
+        return;
+    }
+
+    // Unbinding needs target, which glBindTextureUnit() takes from texture object
+    if (cache.directStateAccess && texture != 0) {
+        glBindTextureUnit(unit, texture);
+    } else {
+        if (changeState(&cache.activeTextureUnit, unit)) {
+            glActiveTexture(GL_TEXTURE0 + unit);
+        }
+        glBindTexture(target, texture);
+    }
+}
+
+void cachedBindBuffer(GLenum target, GLuint buffer) {
+    GLuint* binding = findBufferBinding(target);
+    if (binding == NULL) {
+        glBindBuffer(target, buffer);
+        cache.issued++;
+    } else if (changeState(binding, buffer)) {
+        glBindBuffer(target, buffer);
+    }
+}
+
+// Indexed binding also replaces generic binding of the target
+void cachedBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    BufferRange* range = NULL;
+    if (index < GL_STATE_MAX_BUFFER_INDICES) {
+        if (target == GL_UNIFORM_BUFFER) {
+            range = &cache.uniformRanges[index];
+        } else if (target == GL_SHADER_STORAGE_BUFFER) {
+            range = &cache.storageRanges[index];
+        }
+    }
+
+    GLuint* binding = findBufferBinding(target);
+    if (range != NULL && range->buffer == buffer && range->offset == offset && range->size == size) {
+        cache.skipped++;
+        return;
+    }
+
+    glBindBufferRange(target, index, buffer, offset, size);
+    cache.issued++;
+    if (range != NULL) {
+        range->buffer = buffer;
+        range->offset = offset;
+        range->size = size;
+    }
+    if (binding != NULL) {
+        *binding = buffer;
+    }
+}
+
+void cachedEnable(GLenum capability) {
+    GLuint* state = findCapabilityState(capability);
+    if (state == NULL) {
+        glEnable(capability);
+        cache.issued++;
+    } else if (changeState(state, GL_TRUE)) {
+        glEnable(capability);
+    }
+}
+
+void cachedDisable(GLenum capability) {
+    GLuint* state = findCapabilityState(capability);
+    if (state == NULL) {
+        glDisable(capability);
+        cache.issued++;
+    } else if (changeState(state, GL_FALSE)) {
+        glDisable(capability);
+    }
+}
+
+void endGLStateCacheFrame(void) {
+    cache.frames++;
+    if (!cache.report) {
+        return;
+    }
+
+    double nowMs = monotonicMilliseconds();
+    if (nowMs - cache.reportStartMs < GL_STATE_REPORT_INTERVAL * 1000.0) {
+        return;
+    }
+
+    LOG3DHW("[glstate] %.1f state calls issued, %.1f skipped per frame", (double) cache.issued / cache.frames,
+        (double) cache.skipped / cache.frames);
+
+    cache.issuedTotal += cache.issued;
+    cache.skippedTotal += cache.skipped;
+    cache.issued = cache.skipped = 0;
+    cache.frames = 0;
+    cache.reportStartMs = nowMs;
+}
+
+void destroyGLStateCache(void) {
+    cache.issuedTotal += cache.issued;
+    cache.skippedTotal += cache.skipped;
+    unsigned long long total = cache.issuedTotal + cache.skippedTotal;
+
+    LOG3DHW("[glstate] Destroyed GL state cache (%llu state calls issued, %llu skipped - %.1f%%)",
+        cache.issuedTotal, cache.skippedTotal, total > 0 ? 100.0 * cache.skippedTotal / total : 0.0);
+}
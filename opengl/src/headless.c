@@ -0,0 +1,207 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "headless.h"
+#include "gldebug.h"
+#include "glad/gl.h"
+#include "glad/egl.h"
+#include "utils.h"
+
+static int compareDoubles(const void* a, const void* b) {
+    double first = *(const double*) a;
+    double second = *(const double*) b;
+    return (first > second) - (first < second);
+}
+
+// Prefers surfaceless platform (no display server or GPU device needed at all), falls back to default display
+static EGLDisplay getHeadlessDisplay(bool* surfaceless) {
+    *surfaceless = false;
+    if (GLAD_EGL_EXT_platform_base && GLAD_EGL_MESA_platform_surfaceless) {
+        EGLDisplay display = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+        if (display != EGL_NO_DISPLAY) {
+            *surfaceless = true;
+            return display;
+        }
+    }
+
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+void createHeadlessContext(HeadlessContext* headless, int width, int height, unsigned int frameCount) {
+    memset(headless, 0, sizeof(HeadlessContext));
+    headless->width = width;
+    headless->height = height;
+    headless->frameCount = frameCount;
+    headless->surface = EGL_NO_SURFACE;
+    headless->loaderSurface = EGL_NO_SURFACE;
+
+    // First load only gives us client functions and extensions, display specific ones are loaded after initialization
+    if (!gladLoaderLoadEGL(EGL_NO_DISPLAY)) {
+        LOG3DHW("[headless] Failed loading EGL!");
+        exit(-1);
+    }
+
+    bool surfaceless;
+    headless->display = getHeadlessDisplay(&surfaceless);
+    EGLint major, minor;
+    if (headless->display == EGL_NO_DISPLAY || !eglInitialize(headless->display, &major, &minor)) {
+        LOG3DHW("[headless] Failed initializing EGL display (error: 0x%x)!", eglGetError());
+        exit(-1);
+    }
+
+    if (!gladLoaderLoadEGL(headless->display)) {
+        LOG3DHW("[headless] Failed loading EGL for display!");
+        exit(-1);
+    }
+
+    // Surfaceless context needs no surface bits in config; pbuffer is only created when extension is missing
+    bool needsSurface = !GLAD_EGL_KHR_surfaceless_context;
+    EGLint configAttributes[] = {
+        EGL_SURFACE_TYPE, needsSurface ? EGL_PBUFFER_BIT : 0,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_NONE
+    };
+    EGLConfig config;
+    EGLint configCount = 0;
+    if (!eglChooseConfig(headless->display, configAttributes, &config, 1, &configCount) || configCount == 0) {
+        LOG3DHW("[headless] Failed choosing EGL config (error: 0x%x)!", eglGetError());
+        exit(-1);
+    }
+
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        LOG3DHW("[headless] Desktop OpenGL is not supported by EGL implementation!");
+        exit(-1);
+    }
+
+    EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 4,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    headless->context = eglCreateContext(headless->display, config, EGL_NO_CONTEXT, contextAttributes);
+    if (headless->context == EGL_NO_CONTEXT) {
+        LOG3DHW("[headless] Failed creating GL context (error: 0x%x)!", eglGetError());
+        exit(-1);
+    }
+
+    headless->loaderContext = eglCreateContext(headless->display, config, headless->context, contextAttributes);
+    if (headless->loaderContext == EGL_NO_CONTEXT) {
+        LOG3DHW("[headless] Failed creating loader GL context (error: 0x%x)!", eglGetError());
+        exit(-1);
+    }
+
+    if (needsSurface) {
+        EGLint pbufferAttributes[] = { EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE };
+        headless->surface = eglCreatePbufferSurface(headless->display, config, pbufferAttributes);
+        EGLint loaderPbufferAttributes[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+        headless->loaderSurface = eglCreatePbufferSurface(headless->display, config, loaderPbufferAttributes);
+        if (headless->surface == EGL_NO_SURFACE || headless->loaderSurface == EGL_NO_SURFACE) {
+            LOG3DHW("[headless] Failed creating pbuffer surface (error: 0x%x)!", eglGetError());
+            exit(-1);
+        }
+    }
+
+    if (!eglMakeCurrent(headless->display, headless->surface, headless->surface, headless->context)) {
+        LOG3DHW("[headless] Failed making GL context current (error: 0x%x)!", eglGetError());
+        exit(-1);
+    }
+
+    double loadStartMs = monotonicMilliseconds();
+    if (!gladLoadGL((GLADloadfunc) eglGetProcAddress)) {
+        LOG3DHW("[headless] Failed loading GL!");
+        exit(-1);
+    }
+    LOG3DHW("[headless] Loaded GL functions in %.3f ms (%s)", monotonicMilliseconds() - loadStartMs, GL_LOADING_MODE);
+
+    // Everything is rendered to this framebuffer instead of window's default one
+    glGenRenderbuffers(1, &headless->colorRenderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, headless->colorRenderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glGenRenderbuffers(1, &headless->depthRenderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, headless->depthRenderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &headless->framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, headless->framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, headless->colorRenderbuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, headless->depthRenderbuffer);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        LOG3DHW("[headless] Offscreen framebuffer is not complete!");
+        exit(-1);
+    }
+
+    headless->frameTimesMs = (double*) malloc(sizeof(double) * (frameCount > 0 ? frameCount : 1));
+    headless->startMs = monotonicMilliseconds();
+    headless->lastFrameEndMs = headless->startMs;
+
+    LOG3DHW("[headless] Created EGL %d.%d context (%s, %s, %dx%d), rendering %d frames", major, minor,
+        surfaceless ? "surfaceless platform" : "default display", needsSurface ? "pbuffer" : "no surface",
+        width, height, frameCount);
+    LOG3DHW("[headless] GL renderer: %s", glGetString(GL_RENDERER));
+}
+
+// Called in place of buffer swap. Frame time is measured at submission, like with a window without vsync,
+// total time includes waiting for GPU to finish all frames. Returns false after last frame.
+bool endHeadlessFrame(HeadlessContext* headless) {
+    glFlush();
+
+    double nowMs = monotonicMilliseconds();
+    headless->frameTimesMs[headless->frame] = nowMs - headless->lastFrameEndMs;
+    headless->lastFrameEndMs = nowMs;
+
+    if (++headless->frame < headless->frameCount) {
+        return true;
+    }
+
+    glFinish();
+    double totalMs = monotonicMilliseconds() - headless->startMs;
+
+    double frameTimeTotalMs = 0.0;
+    for (unsigned int i = 0; i < headless->frame; i++) {
+        frameTimeTotalMs += headless->frameTimesMs[i];
+    }
+    qsort(headless->frameTimesMs, headless->frame, sizeof(double), compareDoubles);
+
+    LOG3DHW("[headless] %d frames in %.3f ms (%.1f FPS)", headless->frame, totalMs, headless->frame * 1000.0 / totalMs);
+    LOG3DHW("[headless] Frame time avg %.3f ms, min %.3f ms, p50 %.3f ms, p99 %.3f ms, max %.3f ms",
+        frameTimeTotalMs / headless->frame, headless->frameTimesMs[0],
+        headless->frameTimesMs[headless->frame / 2], headless->frameTimesMs[(headless->frame * 99) / 100],
+        headless->frameTimesMs[headless->frame - 1]);
+
+    return false;
+}
+
+void makeHeadlessLoaderContextCurrent(void* headless) {
+    HeadlessContext* context = (HeadlessContext*) headless;
+    if (!eglMakeCurrent(context->display, context->loaderSurface, context->loaderSurface, context->loaderContext)) {
+        LOG3DHW("[headless] Failed making loader GL context current (error: 0x%x)!", eglGetError());
+        exit(-1);
+    }
+}
+
+void releaseHeadlessLoaderContext(void* headless) {
+    HeadlessContext* context = (HeadlessContext*) headless;
+    eglMakeCurrent(context->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+void destroyHeadlessContext(HeadlessContext* headless) {
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteFramebuffers(1, &headless->framebuffer);
+    glDeleteRenderbuffers(1, &headless->colorRenderbuffer);
+    glDeleteRenderbuffers(1, &headless->depthRenderbuffer);
+    free(headless->frameTimesMs);
+
+    eglMakeCurrent(headless->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(headless->display, headless->loaderContext);
+    eglDestroyContext(headless->display, headless->context);
+    if (headless->surface != EGL_NO_SURFACE) {
+        eglDestroySurface(headless->display, headless->surface);
+        eglDestroySurface(headless->display, headless->loaderSurface);
+    }
+    eglTerminate(headless->display);
+    gladLoaderUnloadEGL();
+
+    LOG3DHW("[headless] Destroyed headless context");
+}
@@ -0,0 +1,141 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "glad/gl.h"
+#include "linmath.h"
+
+#include "instancing.h"
+#include "glstate.h"
+#include "shadervariants.h"
+#include "utils.h"
+
+InstanceLayout parseInstanceLayout(const char* name) {
+    if (strcmp(name, "attributes") == 0) {
+        return INSTANCE_LAYOUT_ATTRIBUTES;
+    } else if (strcmp(name, "ssbo") == 0) {
+        return INSTANCE_LAYOUT_STORAGE_BUFFER;
+    }
+
+    LOG3DHW("[instancing] Unknown instance layout: %s (expected attributes or ssbo)!", name);
+    exit(-1);
+}
+
+const char* instanceLayoutName(InstanceLayout layout) {
+    return layout == INSTANCE_LAYOUT_ATTRIBUTES ? "attributes" : "ssbo";
+}
+
+// Shader variant drawing the batch, so it can be requested before the batch is created
+uint32_t instanceLayoutShaderFeatures(InstanceLayout layout) {
+    return SHADER_FEATURE_TEXTURED
+        | (layout == INSTANCE_LAYOUT_ATTRIBUTES ? SHADER_FEATURE_INSTANCED_ATTRIBUTES : SHADER_FEATURE_INSTANCED_STORAGE);
+}
+
+void createInstanceBatch(InstanceBatch* batch, InstanceLayout layout, GLuint programId, GLsizei count, GLuint meshVao, GLsizei indexCount,
+    GLenum indexType, float meshDequantization[4][4]) {
+    batch->layout = layout;
+    batch->programId = programId;
+    batch->vao = meshVao;
+    batch->indexCount = indexCount;
+    batch->indexType = indexType;
+    memcpy(batch->meshDequantization, meshDequantization, sizeof(mat4x4));
+    batch->count = count;
+    batch->models = (GLfloat*) malloc(sizeof(mat4x4) * count);
+    if (batch->models == NULL) {
+        LOG3DHW("[instancing] Failed allocating %d model matrices!", count);
+        exit(-1);
+    }
+
+    // Both layouts use the same data (tightly packed column-major mat4, 64 bytes each, which matches std430 array stride),
+    // only the binding differs
+    glGenBuffers(1, &batch->buffer);
+
+    if (layout == INSTANCE_LAYOUT_ATTRIBUTES) {
+
+        // Instance attributes are stored in mesh VAO next to per-vertex ones. Matrix attribute is set up as 4 vec4 columns,
+        // divisor 1 makes each of them advance once per instance instead of once per vertex.
+        glBindVertexArray(meshVao);
+        glBindBuffer(GL_ARRAY_BUFFER, batch->buffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(mat4x4) * count, NULL, GL_STREAM_DRAW);
+        for (GLuint column = 0; column < 4; column++) {
+            GLuint location = INSTANCE_MODEL_ATTRIBUTE_LOCATION + column;
+            glEnableVertexAttribArray(location);
+            glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, sizeof(mat4x4), (void*) (column * sizeof(vec4)));
+            glVertexAttribDivisor(location, 1);
+        }
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    } else {
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, batch->buffer);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(mat4x4) * count, NULL, GL_STREAM_DRAW);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    }
+
+    LOG3DHW("[instancing] Created instance batch (instances=%d, layout=%s, buffer=%d, %.2f MB per frame)",
+        count, instanceLayoutName(layout), batch->buffer, (float) (sizeof(mat4x4) * count) / (1024.f * 1024.f));
+}
+
+// Number of cubes along each side of the grid which fits given count
+int instanceGridSide(GLsizei count) {
+    int side = (int) ceilf(cbrtf((float) count));
+    while (side * side * side < count) {
+        side++; // cbrtf() may round below exact cube root
+    }
+
+    return side;
+}
+
+// Model matrix of index-th cube in the grid (also used by non-instanced paths drawing the same scene).
+// Places instances in a cube shaped grid in front of camera, each one rotated with a small phase offset.
+// With single instance it's the same cube as in non-instanced path.
+void instanceGridModel(float model[4][4], GLsizei index, int side, float rotationAngle) {
+    const float halfExtent = (float) (side - 1) * 0.5f;
+    const float firstLayerZ = -5.f - (float) (side - 1) * INSTANCE_GRID_SPACING; // push grid back so it fits in view
+    int x = index % side;
+    int y = (index / side) % side;
+    int z = index / (side * side);
+
+    mat4x4_translate(model,
+        ((float) x - halfExtent) * INSTANCE_GRID_SPACING,
+        ((float) y - halfExtent) * INSTANCE_GRID_SPACING,
+        firstLayerZ - (float) z * INSTANCE_GRID_SPACING);
+    mat4x4_rotate(model, (const float (*)[4]) model, 0.7f, 0.2f, -0.8f, rotationAngle + (float) index * 0.1f);
+}
+
+void updateInstanceGrid(InstanceBatch* batch, float rotationAngle) {
+    int side = instanceGridSide(batch->count);
+    mat4x4* models = (mat4x4*) batch->models;
+    for (GLsizei i = 0; i < batch->count; i++) {
+        instanceGridModel(models[i], i, side, rotationAngle);
+        mat4x4_mul(models[i], (const float (*)[4]) models[i], (const float (*)[4]) batch->meshDequantization);
+    }
+
+    // Previous contents are orphaned, so driver can hand out new storage instead of waiting for GPU
+    // to finish reading matrices of the previous frame
+    if (hasDirectStateAccess()) {
+        glNamedBufferData(batch->buffer, sizeof(mat4x4) * batch->count, NULL, GL_STREAM_DRAW);
+        glNamedBufferSubData(batch->buffer, 0, sizeof(mat4x4) * batch->count, batch->models);
+    } else {
+        GLenum target = batch->layout == INSTANCE_LAYOUT_ATTRIBUTES ? GL_ARRAY_BUFFER : GL_SHADER_STORAGE_BUFFER;
+        cachedBindBuffer(target, batch->buffer);
+        glBufferData(target, sizeof(mat4x4) * batch->count, NULL, GL_STREAM_DRAW);
+        glBufferSubData(target, 0, sizeof(mat4x4) * batch->count, batch->models);
+    }
+}
+
+void drawInstanceBatch(InstanceBatch* batch) {
+    cachedUseProgram(batch->programId);
+    if (batch->layout == INSTANCE_LAYOUT_STORAGE_BUFFER) {
+        cachedBindBufferRange(GL_SHADER_STORAGE_BUFFER, INSTANCE_STORAGE_BINDING, batch->buffer, 0, sizeof(mat4x4) * batch->count);
+    }
+
+    cachedBindVertexArray(batch->vao);
+    glDrawElementsInstanced(GL_TRIANGLES, batch->indexCount, batch->indexType, NULL, batch->count);
+}
+
+void destroyInstanceBatch(InstanceBatch* batch) {
+    glDeleteBuffers(1, &batch->buffer);
+    free(batch->models);
+
+    LOG3DHW("[instancing] Destroyed instance batch");
+}
@@ -0,0 +1,208 @@
+#include <stdlib.h>
+
+#include "loader.h"
+#include "glad/gl.h"
+#include "mesh.h"
+#include "shadervariants.h"
+#include "texture.h"
+#include "threading.h"
+#include "utils.h"
+
+// Textures go through the same PBO staging ring as on render context, just without spreading the upload over frames.
+// Shader variants are compiled (or restored from program binary cache) here too, so render thread never waits for compiler.
+static GLuint loadAsset(TextureStreamer* textureStreamer, AssetType type, const char* path, uint32_t features) {
+    if (type == ASSET_TEXTURE) {
+        GLuint textureId = streamTexture(textureStreamer, path);
+        finishTextureStreamer(textureStreamer);
+
+        return textureId;
+    }
+    if (type == ASSET_SHADER_VARIANT) {
+        return getShaderVariant(features);
+    }
+
+    return createCubeMeshBuffer();
+}
+
+static const char* assetName(const Asset* asset) {
+    switch (asset->type) {
+        case ASSET_TEXTURE: return asset->path;
+        case ASSET_CUBE_MESH: return "cube mesh";
+        default: return "shader variant";
+    }
+}
+
+static void assetLoaderWorker(void* userData) {
+    AssetLoader* loader = (AssetLoader*) userData;
+    loader->makeContextCurrent(loader->contextUserData);
+
+    TextureStreamer textureStreamer;
+    createTextureStreamer(&textureStreamer, false);
+    createShaderVariantCache();
+
+    lockMutex(&loader->mutex);
+    while (true) {
+        while (loader->running && loader->nextQueuedAsset == loader->assetCount) {
+            waitCondVar(&loader->assetQueued, &loader->mutex);
+        }
+
+        if (!loader->running) {
+            break;
+        }
+
+        Asset* asset = &loader->assets[loader->nextQueuedAsset++];
+        AssetType type = asset->type;
+        const char* path = asset->path;
+        uint32_t features = asset->features;
+        asset->state = ASSET_LOADING;
+
+        // Every shader variant waiting in the queue is requested before the first one is finished,
+        // so with parallel shader compile driver builds them side by side
+        uint32_t queuedVariants[ASSET_LOADER_MAX_ASSETS];
+        unsigned int queuedVariantCount = 0;
+        if (type == ASSET_SHADER_VARIANT) {
+            for (unsigned int i = loader->nextQueuedAsset; i < loader->assetCount; i++) {
+                if (loader->assets[i].type == ASSET_SHADER_VARIANT) {
+                    queuedVariants[queuedVariantCount++] = loader->assets[i].features;
+                }
+            }
+        }
+
+        // Decoding, compiling and upload happen without holding the lock, so render loop is never blocked by them
+        unlockMutex(&loader->mutex);
+
+        double startTimeMs = monotonicMilliseconds();
+
+        for (unsigned int i = 0; i < queuedVariantCount; i++) {
+            requestShaderVariant(queuedVariants[i]);
+        }
+        GLuint object = loadAsset(&textureStreamer, type, path, features);
+
+        // Upload commands are only queued on loader context. Fence marks their end and flush makes sure
+        // it actually reaches GPU - render context could otherwise wait for a fence which is never submitted.
+        GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+
+        float loadTimeMs = (float) (monotonicMilliseconds() - startTimeMs);
+
+        lockMutex(&loader->mutex);
+        asset->object = object;
+        asset->fence = fence;
+        asset->loadTimeMs = loadTimeMs;
+        asset->state = ASSET_UPLOADED;
+    }
+    unlockMutex(&loader->mutex);
+
+    destroyShaderVariantCache();
+    destroyTextureStreamer(&textureStreamer);
+    loader->releaseContext(loader->contextUserData);
+}
+
+void createAssetLoader(AssetLoader* loader, LoaderContextFunction makeContextCurrent, LoaderContextFunction releaseContext,
+    void* contextUserData) {
+    loader->assetCount = 0;
+    loader->nextQueuedAsset = 0;
+    loader->running = true;
+    loader->makeContextCurrent = makeContextCurrent;
+    loader->releaseContext = releaseContext;
+    loader->contextUserData = contextUserData;
+
+    initMutex(&loader->mutex);
+    initCondVar(&loader->assetQueued);
+
+    if (!createThread(&loader->thread, assetLoaderWorker, loader)) {
+        LOG3DHW("[loader] Failed creating loader thread!");
+        exit(-1);
+    }
+
+    LOG3DHW("[loader] Started asset loader thread");
+}
+
+static unsigned int queueAsset(AssetLoader* loader, AssetType type, const char* path, uint32_t features) {
+    lockMutex(&loader->mutex);
+
+    if (loader->assetCount >= ASSET_LOADER_MAX_ASSETS) {
+        LOG3DHW("[loader] Too many asset requests (max: %d)!", ASSET_LOADER_MAX_ASSETS);
+        exit(-1);
+    }
+
+    unsigned int assetId = loader->assetCount++;
+    Asset* asset = &loader->assets[assetId];
+    asset->type = type;
+    asset->path = path;
+    asset->features = features;
+    asset->state = ASSET_QUEUED;
+    asset->object = 0;
+    asset->fence = NULL;
+    asset->loadTimeMs = 0.f;
+
+    signalCondVar(&loader->assetQueued);
+    unlockMutex(&loader->mutex);
+
+    return assetId;
+}
+
+unsigned int requestAsset(AssetLoader* loader, AssetType type, const char* path) {
+    return queueAsset(loader, type, path, 0);
+}
+
+// Program of the variant is used from render context the same way as any other shared object, once acquired
+unsigned int requestShaderVariantAsset(AssetLoader* loader, uint32_t features) {
+    return queueAsset(loader, ASSET_SHADER_VARIANT, NULL, features);
+}
+
+// Called from render thread, returns false (and leaves object untouched) while asset is still loading. First successful call makes
+// render context wait for the upload on GPU (glWaitSync doesn't block CPU), after that object is used as any other.
+bool acquireAsset(AssetLoader* loader, unsigned int assetId, GLuint* object) {
+    lockMutex(&loader->mutex);
+    Asset* asset = &loader->assets[assetId];
+    AssetState state = asset->state;
+    GLsync fence = asset->fence;
+    if (state >= ASSET_UPLOADED) {
+        *object = asset->object;
+    }
+    if (state == ASSET_UPLOADED) {
+        asset->state = ASSET_READY;
+        asset->fence = NULL;
+    }
+    unlockMutex(&loader->mutex);
+
+    if (state == ASSET_UPLOADED) {
+        glWaitSync(fence, 0, GL_TIMEOUT_IGNORED);
+        glDeleteSync(fence);
+
+        LOG3DHW("[loader] Asset %d (%s) ready (object=%d, loaded in %.2f ms)", assetId, assetName(asset), *object,
+            asset->loadTimeMs);
+    }
+
+    return state >= ASSET_UPLOADED;
+}
+
+// Waits for asset in progress and deletes all loaded objects (shared objects can be deleted by any context).
+// Shader variant programs were already deleted with the variant cache on loader thread.
+void destroyAssetLoader(AssetLoader* loader) {
+    lockMutex(&loader->mutex);
+    loader->running = false;
+    broadcastCondVar(&loader->assetQueued);
+    unlockMutex(&loader->mutex);
+
+    joinThread(loader->thread);
+
+    for (unsigned int i = 0; i < loader->assetCount; i++) {
+        Asset* asset = &loader->assets[i];
+        if (asset->fence != NULL) {
+            glDeleteSync(asset->fence);
+        }
+
+        if (asset->type == ASSET_TEXTURE) {
+            glDeleteTextures(1, &asset->object);
+        } else if (asset->type == ASSET_CUBE_MESH) {
+            glDeleteBuffers(1, &asset->object);
+        }
+    }
+
+    destroyCondVar(&loader->assetQueued);
+    destroyMutex(&loader->mutex);
+
+    LOG3DHW("[loader] Destroyed asset loader");
+}
@@ -1,34 +1,124 @@
+#include <stdlib.h>
+
 #include "glad/gl.h"
 
 #include "mesh.h"
 #include "cube.h"
+#include "indexedmesh.h"
 #include "utils.h"
 
-GLuint loadCubeMesh() {
-    GLuint vao = -1;
-    GLuint vbo = -1;
+// Sets vertex attribute pointers of the bound vertex array for vertices in format, starting at offset of the bound buffer
+void applyVertexFormat(const VertexFormat* format, GLintptr offset) {
+    for (uint32_t i = 0; i < format->attributeCount; i++) {
+        const VertexAttribute* attribute = &format->attributes[i];
+        GLenum type = attribute->encoding == VERTEX_ENCODING_FLOAT32 ? GL_FLOAT
+            : attribute->encoding == VERTEX_ENCODING_HALF_FLOAT ? GL_HALF_FLOAT
+            : attribute->encoding == VERTEX_ENCODING_UNORM16 ? GL_UNSIGNED_SHORT
+            : GL_SHORT;
+        // Integer encodings are normalized to [-1, 1] / [0, 1] by vertex fetch, shader gets floats either way
+        GLboolean normalized = type == GL_SHORT || type == GL_UNSIGNED_SHORT ? GL_TRUE : GL_FALSE;
 
-    // Generate vertex array and buffer
-    glGenVertexArrays(1, &vao);
-    glGenBuffers(1, &vbo);
+        glEnableVertexAttribArray(attribute->location);
+        glVertexAttribPointer(attribute->location, (GLint) vertexAttributeStoredComponents(attribute), type, normalized,
+            (GLsizei) format->stride, (void*) (offset + attribute->offset));
+    }
+}
+
+// Encoded positions multiplied by this are cube's positions, it has to be applied to model matrix of every cube drawn
+// from cube mesh buffer
+void getCubeDequantization(float dequantization[4][4]) {
+    VertexFormat format;
+    initCubeVertexFormat(&format);
+    getVertexDequantization(&format, dequantization);
+}
+
+// Buffers are shared between contexts, so this can run on loader thread too.
+// Cube's triangle list is welded and reordered for vertex cache first, then drawn with 16 bit indices.
+// Vertices are quantized (see initCubeVertexFormat()).
+GLuint createCubeMeshBuffer() {
+    GLuint buffer = -1;
 
-    // Bind vertex array and buffer, copy vertices data to buffer
+    IndexedMesh mesh;
+    buildIndexedMesh(&mesh, CUBE_DATA, CUBE_VERTEX_COUNT, VERTEX_OFFSET);
+    VertexFormat format;
+    initCubeVertexFormat(&format);
+    GLsizeiptr verticesSize = (GLsizeiptr) mesh.vertexCount * format.stride;
+    unsigned char* data = (unsigned char*) malloc(CUBE_INDICES_SIZE + verticesSize);
+    writeIndexedMeshIndices(&mesh, data);
+    encodeVertices(&format, mesh.vertices, mesh.vertexCount, VERTEX_OFFSET, data + CUBE_INDICES_SIZE);
+
+    // Generate buffer and copy indices and vertices data to it
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, CUBE_INDICES_SIZE + verticesSize, data, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    free(data);
+    destroyIndexedMesh(&mesh);
+
+    return buffer;
+}
+
+// Vertex arrays are container objects, which are never shared between contexts - they have to be set up
+// on the context which draws with them. Used for buffers of expanded cube vertices (e.g. streamed ones).
+void attachCubeMeshBuffer(GLuint vao, GLuint vbo) {
+    // Bind vertex array and buffer
     glBindVertexArray(vao);
     glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(CUBE_DATA), &CUBE_DATA[0], GL_STATIC_DRAW);
 
-    // Set pointer to vertices in buffer
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*) 0);
+    // Set pointers to vertices and texture coords in buffer
+    VertexFormat format;
+    initCubeSourceVertexFormat(&format);
+    applyVertexFormat(&format, 0);
 
-    // Set pointer to texture coords in buffer
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void *) (3 * sizeof(float)));
-    
     // Unbind vertex array
     glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// Attaches buffer made by createCubeMeshBuffer() - the same buffer is vertex array's element buffer
+// and (past the indices) its vertex source
+void attachIndexedCubeMeshBuffer(GLuint vao, GLuint buffer) {
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer); // element buffer binding is part of vertex array state
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    VertexFormat format;
+    initCubeVertexFormat(&format);
+    applyVertexFormat(&format, CUBE_INDICES_SIZE);
+
+    // Element buffer stays attached, vertex array has to be unbound first
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+GLuint loadCubeMesh() {
+    GLuint vao = -1;
+
+    // Generate vertex array, fill buffer and set it as vertex array's source
+    glGenVertexArrays(1, &vao);
+    GLuint vbo = createCubeMeshBuffer();
+    attachIndexedCubeMeshBuffer(vao, vbo);
 
     LOG3DHW("[mesh] Loaded cube data to buffer (vao=%d, vbo=%d)", vao, vbo); 
 
     return vao;
+}
+
+// Cube positions are within [-1, 1], so pool's position scale of 1 stores them without loss
+PooledMesh addCubeToMeshPool(MeshPool* pool) {
+    return addPooledTriangles(pool, CUBE_DATA, CUBE_VERTEX_COUNT);
+}
+
+// Writes cube vertices transformed by model matrix (CUBE_VERTEX_COUNT vertices, CUBE_VERTEX_STRIDE apart).
+// Used for geometry generated every frame, which is drawn without per-object model matrix.
+void writeCubeVertices(float* vertices, float model[4][4]) {
+    for (int i = 0; i < CUBE_VERTEX_COUNT; i++) {
+        const float* source = &CUBE_DATA[i * VERTEX_OFFSET];
+        float* destination = &vertices[i * VERTEX_OFFSET];
+        for (int j = 0; j < 3; j++) {
+            destination[j] = model[0][j] * source[0] + model[1][j] * source[1] + model[2][j] * source[2] + model[3][j];
+        }
+        destination[TEX_COORDS_OFFSET] = source[TEX_COORDS_OFFSET];
+        destination[TEX_COORDS_OFFSET + 1] = source[TEX_COORDS_OFFSET + 1];
+    }
 }
\ No newline at end of file
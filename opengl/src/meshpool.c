@@ -0,0 +1,123 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "meshpool.h"
+#include "glstate.h"
+#include "indexedmesh.h"
+#include "glad/gl.h"
+#include "utils.h"
+
+// Vertex data starts after position scale, which is the first member of PulledVertices block
+#define MESH_POOL_VERTEX_DATA_OFFSET sizeof(float)
+
+void createMeshPool(MeshPool* pool, uint32_t vertexCapacity, uint32_t indexCapacity, float positionScale) {
+    memset(pool, 0, sizeof(MeshPool));
+    if (vertexCapacity > MESH_POOL_MAX_VERTICES) {
+        LOG3DHW("[meshpool] Too many vertices for 16 bit indices (max: %d)!", MESH_POOL_MAX_VERTICES);
+        exit(-1);
+    }
+    pool->vertexCapacity = vertexCapacity;
+    pool->indexCapacity = (indexCapacity + 1) & ~1u;
+    pool->positionScale = positionScale;
+
+    // Same encodings as quantized vertex buffers, with fixed position scale instead of one fitted to single mesh
+    initVertexFormat(&pool->vertexFormat);
+    addVertexAttribute(&pool->vertexFormat, 0, VERTEX_SEMANTIC_POSITION, VERTEX_ENCODING_SNORM16, 3, 0);
+    addVertexAttribute(&pool->vertexFormat, 1, VERTEX_SEMANTIC_TEX_COORDS, VERTEX_ENCODING_UNORM16, 2, 3);
+    for (int i = 0; i < 3; i++) {
+        pool->vertexFormat.positionScale[i] = positionScale;
+    }
+    if (pool->vertexFormat.stride != MESH_POOL_VERTEX_WORDS * sizeof(uint32_t)) {
+        LOG3DHW("[meshpool] Pool vertex format has %d bytes, vertex pulling shader decodes %d!", pool->vertexFormat.stride,
+            (int) (MESH_POOL_VERTEX_WORDS * sizeof(uint32_t)));
+        exit(-1);
+    }
+
+    glGenBuffers(1, &pool->vertexBuffer);
+    cachedBindBuffer(GL_SHADER_STORAGE_BUFFER, pool->vertexBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, MESH_POOL_VERTEX_DATA_OFFSET + (GLsizeiptr) vertexCapacity * MESH_POOL_VERTEX_WORDS * sizeof(uint32_t),
+        NULL, GL_STATIC_DRAW);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(float), &pool->positionScale);
+
+    glGenBuffers(1, &pool->indexBuffer);
+    cachedBindBuffer(GL_SHADER_STORAGE_BUFFER, pool->indexBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, (GLsizeiptr) pool->indexCapacity / 2 * sizeof(uint32_t), NULL, GL_STATIC_DRAW);
+    cachedBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    glGenVertexArrays(1, &pool->vao);
+
+    LOG3DHW("[meshpool] Created mesh pool (%d vertices, %d indices, %.2f KB)", vertexCapacity, pool->indexCapacity,
+        (float) (vertexCapacity * MESH_POOL_VERTEX_WORDS * sizeof(uint32_t) + pool->indexCapacity * sizeof(uint16_t)) / 1024.f);
+}
+
+// Indices are relative to the mesh's own vertices. Mesh starts at even index, so its indices never share a word
+// with previous mesh and the whole range is written with single upload.
+PooledMesh addPooledMesh(MeshPool* pool, const float* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount) {
+    uint32_t firstIndex = (pool->indexCount + 1) & ~1u;
+    if (pool->vertexCount + vertexCount > pool->vertexCapacity || firstIndex + indexCount > pool->indexCapacity) {
+        LOG3DHW("[meshpool] Mesh pool is full (%d vertices, %d indices)!", pool->vertexCapacity, pool->indexCapacity);
+        exit(-1);
+    }
+
+    uint32_t* packedVertices = (uint32_t*) malloc(vertexCount * MESH_POOL_VERTEX_WORDS * sizeof(uint32_t));
+    encodeVertices(&pool->vertexFormat, vertices, vertexCount, MESH_POOL_INPUT_FLOATS, packedVertices);
+
+    // Pool indices are absolute, so draws don't need base vertex
+    uint32_t wordCount = (indexCount + 1) / 2;
+    uint32_t* packedIndices = (uint32_t*) calloc(wordCount, sizeof(uint32_t));
+    for (uint32_t i = 0; i < indexCount; i++) {
+        if (indices[i] >= vertexCount) {
+            LOG3DHW("[meshpool] Index %d out of mesh vertices (%d)!", indices[i], vertexCount);
+            exit(-1);
+        }
+        packedIndices[i / 2] |= (pool->vertexCount + indices[i]) << ((i & 1) * 16);
+    }
+
+    cachedBindBuffer(GL_SHADER_STORAGE_BUFFER, pool->vertexBuffer);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, MESH_POOL_VERTEX_DATA_OFFSET + (GLintptr) pool->vertexCount * MESH_POOL_VERTEX_WORDS * sizeof(uint32_t),
+        (GLsizeiptr) vertexCount * MESH_POOL_VERTEX_WORDS * sizeof(uint32_t), packedVertices);
+    cachedBindBuffer(GL_SHADER_STORAGE_BUFFER, pool->indexBuffer);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, (GLintptr) firstIndex / 2 * sizeof(uint32_t), (GLsizeiptr) wordCount * sizeof(uint32_t),
+        packedIndices);
+    cachedBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    free(packedVertices);
+    free(packedIndices);
+
+    PooledMesh mesh = { 0 };
+    mesh.firstIndex = (GLint) firstIndex;
+    mesh.indexCount = (GLsizei) indexCount;
+    pool->vertexCount += vertexCount;
+    pool->indexCount = firstIndex + indexCount;
+    pool->meshCount++;
+
+    LOG3DHW("[meshpool] Added mesh %d (%d vertices, %d indices)", pool->meshCount - 1, vertexCount, indexCount);
+
+    return mesh;
+}
+
+// Adds non-indexed triangle list (like CUBE_DATA), vertices shared by triangles are stored once
+// and triangles are reordered for vertex cache (see indexedmesh.h)
+PooledMesh addPooledTriangles(MeshPool* pool, const float* vertices, uint32_t vertexCount) {
+    IndexedMesh indexed;
+    buildIndexedMesh(&indexed, vertices, vertexCount, MESH_POOL_INPUT_FLOATS);
+    PooledMesh mesh = addPooledMesh(pool, indexed.vertices, indexed.vertexCount, indexed.indices, indexed.indexCount);
+    destroyIndexedMesh(&indexed);
+
+    return mesh;
+}
+
+// Storage bindings of the pool aren't used by anything else, binding them every frame is skipped by state cache
+void bindMeshPool(const MeshPool* pool) {
+    cachedBindBufferRange(GL_SHADER_STORAGE_BUFFER, MESH_POOL_VERTICES_BINDING, pool->vertexBuffer, 0,
+        MESH_POOL_VERTEX_DATA_OFFSET + (GLsizeiptr) pool->vertexCapacity * MESH_POOL_VERTEX_WORDS * sizeof(uint32_t));
+    cachedBindBufferRange(GL_SHADER_STORAGE_BUFFER, MESH_POOL_INDICES_BINDING, pool->indexBuffer, 0,
+        (GLsizeiptr) pool->indexCapacity / 2 * sizeof(uint32_t));
+}
+
+void destroyMeshPool(MeshPool* pool) {
+    glDeleteVertexArrays(1, &pool->vao);
+    glDeleteBuffers(1, &pool->indexBuffer);
+    glDeleteBuffers(1, &pool->vertexBuffer);
+
+    LOG3DHW("[meshpool] Destroyed mesh pool (%d meshes, %d vertices, %d indices)", pool->meshCount, pool->vertexCount, pool->indexCount);
+}
@@ -0,0 +1,128 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "occlusion.h"
+#include "mesh.h"
+#include "glstate.h"
+#include "glad/gl.h"
+#include "utils.h"
+
+// Program is untextured variant - model matrix in ObjectUniforms block, fragments only write depth (if anything)
+void createOcclusionCuller(OcclusionCuller* culler, GLuint programId, GLuint boxVao) {
+    memset(culler, 0, sizeof(OcclusionCuller));
+    culler->programId = programId;
+    culler->boxVao = boxVao;
+
+    LOG3DHW("[occlusion] Created occlusion culler");
+}
+
+unsigned int addOccludedObject(OcclusionCuller* culler) {
+    if (culler->objectCount >= OCCLUSION_MAX_OBJECTS) {
+        LOG3DHW("[occlusion] Too many occluded objects (max: %d)!", OCCLUSION_MAX_OBJECTS);
+        exit(-1);
+    }
+
+    OccludedObject* object = &culler->objects[culler->objectCount];
+    glGenQueries(1, &object->query);
+
+    return culler->objectCount++;
+}
+
+// Called at the beginning of the frame. Results are read only when they are already available,
+// test which is still in flight keeps its query (and conditional rendering) until next frame.
+void updateOcclusionResults(OcclusionCuller* culler) {
+    culler->frame++;
+
+    for (unsigned int i = 0; i < culler->objectCount; i++) {
+        OccludedObject* object = &culler->objects[i];
+        if (!object->pending) {
+            continue;
+        }
+
+        GLuint available = GL_FALSE;
+        glGetQueryObjectuiv(object->query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available) {
+            GLuint anySamplesPassed = GL_FALSE;
+            glGetQueryObjectuiv(object->query, GL_QUERY_RESULT, &anySamplesPassed);
+            object->visible = anySamplesPassed;
+            object->pending = false;
+
+            culler->resultsRead++;
+            culler->hiddenResults += anySamplesPassed ? 0 : 1;
+        }
+    }
+}
+
+void setOccludedObjectBounds(OcclusionCuller* culler, unsigned int objectId, float bounds[4][4]) {
+    memcpy(culler->objects[objectId].bounds, bounds, sizeof(culler->objects[objectId].bounds));
+}
+
+// Query for glBeginConditionalRender(), 0 until object is tested for the first time (draw it unconditionally)
+GLuint getOcclusionQuery(OcclusionCuller* culler, unsigned int objectId) {
+    OccludedObject* object = &culler->objects[objectId];
+
+    return object->issued ? object->query : 0;
+}
+
+// Visible objects tend to stay visible, so they are retested only every OCCLUSION_VISIBLE_TEST_INTERVAL frames
+// (spread over frames by object index) and keep their last query meanwhile. Hidden ones are retested every frame,
+// so they show up one frame after becoming visible.
+static bool isOcclusionTestDue(const OcclusionCuller* culler, unsigned int objectId) {
+    const OccludedObject* object = &culler->objects[objectId];
+
+    return !object->pending && (!object->visible || (culler->frame + objectId) % OCCLUSION_VISIBLE_TEST_INTERVAL == 0);
+}
+
+// Has to be called after opaque draws (depth buffer is filled) and inside uniform ring frame
+void issueOcclusionTests(OcclusionCuller* culler, UniformRing* uniformRing) {
+    cachedUseProgram(culler->programId);
+    cachedBindVertexArray(culler->boxVao);
+
+    // Back faces count too - camera can be inside of the box
+    cachedDisable(GL_CULL_FACE);
+    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    glDepthMask(GL_FALSE);
+    glDepthFunc(GL_LEQUAL);
+
+    ObjectUniforms boxUniforms;
+    for (unsigned int i = 0; i < culler->objectCount; i++) {
+        if (!isOcclusionTestDue(culler, i)) {
+            continue;
+        }
+
+        OccludedObject* object = &culler->objects[i];
+        memcpy(boxUniforms.model, object->bounds, sizeof(boxUniforms.model));
+        for (int column = 0; column < 3; column++) {
+            for (int row = 0; row < 3; row++) {
+                boxUniforms.model[column][row] *= OCCLUSION_BOUNDS_SCALE;
+            }
+        }
+
+        GLintptr offset = pushUniforms(uniformRing, &boxUniforms, sizeof(ObjectUniforms));
+        bindUniforms(uniformRing, OBJECT_UNIFORMS_BINDING, offset, sizeof(ObjectUniforms));
+
+        // Conservative variant lets GPU answer early (e.g. from hierarchical depth), false positives just draw the object
+        glBeginQuery(GL_ANY_SAMPLES_PASSED_CONSERVATIVE, object->query);
+        glDrawElements(GL_TRIANGLES, CUBE_INDEX_COUNT, CUBE_INDEX_TYPE, NULL);
+        glEndQuery(GL_ANY_SAMPLES_PASSED_CONSERVATIVE);
+
+        object->issued = true;
+        object->pending = true;
+        culler->testsIssued++;
+    }
+
+    glDepthFunc(GL_LESS);
+    glDepthMask(GL_TRUE);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    cachedEnable(GL_CULL_FACE);
+}
+
+void destroyOcclusionCuller(OcclusionCuller* culler) {
+    for (unsigned int i = 0; i < culler->objectCount; i++) {
+        glDeleteQueries(1, &culler->objects[i].query);
+    }
+
+    LOG3DHW("[occlusion] Destroyed occlusion culler (%llu tests issued, %llu hidden of %llu results - %.1f%%)",
+        culler->testsIssued, culler->hiddenResults, culler->resultsRead,
+        culler->resultsRead > 0 ? 100.0 * culler->hiddenResults / culler->resultsRead : 0.0);
+}
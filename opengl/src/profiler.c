@@ -0,0 +1,206 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "profiler.h"
+#include "glad/gl.h"
+#include "utils.h"
+
+// GPU runs behind CPU, so query results are only read GPU_PROFILER_FRAMES frames after they were issued.
+// Before reusing query set of a frame, we check GL_QUERY_RESULT_AVAILABLE - asking for result which isn't
+// ready would block until GPU catches up, which is exactly what profiler must never do.
+void createGpuProfiler(GpuProfiler* profiler, bool enabled) {
+    memset(profiler, 0, sizeof(GpuProfiler));
+    profiler->enabled = enabled;
+    if (!enabled) {
+        return;
+    }
+
+    glGenQueries(GPU_PROFILER_FRAMES * 2, &profiler->frameQueries[0][0]);
+    profiler->reportStartMs = monotonicMilliseconds();
+    profiler->frameStartMs = profiler->reportStartMs;
+
+    LOG3DHW("[profiler] Created GPU profiler (%d frames in flight, report every %.1f s)", GPU_PROFILER_FRAMES, GPU_PROFILER_REPORT_INTERVAL);
+}
+
+unsigned int addGpuScope(GpuProfiler* profiler, const char* name) {
+    if (profiler->scopeCount >= GPU_PROFILER_MAX_SCOPES) {
+        LOG3DHW("[profiler] Too many GPU scopes (max: %d)!", GPU_PROFILER_MAX_SCOPES);
+        exit(-1);
+    }
+
+    GpuScope* scope = &profiler->scopes[profiler->scopeCount];
+    memset(scope, 0, sizeof(GpuScope));
+    scope->name = name;
+    if (profiler->enabled) {
+        glGenQueries(GPU_PROFILER_FRAMES, scope->queries);
+    }
+
+    return profiler->scopeCount++;
+}
+
+static bool queryAvailable(GLuint query) {
+    GLuint available = GL_FALSE;
+    glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+
+    return available == GL_TRUE;
+}
+
+// Collects results of frame which used the current query set. Returns false if GPU hasn't finished it yet.
+static bool collectFrameResults(GpuProfiler* profiler) {
+    unsigned int frame = profiler->frame;
+    if (!profiler->framePending[frame]) {
+        return true;
+    }
+
+    // End timestamp is the last query of the frame, if it's available, all of them are
+    if (!queryAvailable(profiler->frameQueries[frame][1])) {
+        return false;
+    }
+
+    GLuint64 frameBegin = 0;
+    GLuint64 frameEnd = 0;
+    glGetQueryObjectui64v(profiler->frameQueries[frame][0], GL_QUERY_RESULT, &frameBegin);
+    glGetQueryObjectui64v(profiler->frameQueries[frame][1], GL_QUERY_RESULT, &frameEnd);
+
+    double busyMs = 0.0;
+    for (unsigned int i = 0; i < profiler->scopeCount; i++) {
+        GpuScope* scope = &profiler->scopes[i];
+        if (scope->issued[frame]) {
+            GLuint64 elapsed = 0;
+            glGetQueryObjectui64v(scope->queries[frame], GL_QUERY_RESULT, &elapsed);
+
+            // Scope lies between frame timestamps, longer result is bogus (seen on llvmpipe for the first query of a run)
+            double elapsedMs = (double) elapsed / 1.0e6;
+            if (elapsed <= frameEnd - frameBegin) {
+                busyMs += elapsedMs;
+                scope->gpuTotalMs += elapsedMs;
+                scope->gpuMaxMs = elapsedMs > scope->gpuMaxMs ? elapsedMs : scope->gpuMaxMs;
+                scope->gpuSamples++;
+            }
+            scope->issued[frame] = false;
+        }
+    }
+
+    // Frame GPU time is from the first to the last command of the frame (including idle gaps between them),
+    // latency is how long it took GPU to start the frame after CPU submitted it
+    double frameMs = (double) (frameEnd - frameBegin) / 1.0e6;
+    profiler->gpuFrameTotalMs += frameMs;
+    profiler->gpuFrameMaxMs = frameMs > profiler->gpuFrameMaxMs ? frameMs : profiler->gpuFrameMaxMs;
+    profiler->gpuBusyTotalMs += busyMs;
+    profiler->gpuLatencyTotalMs += (double) ((GLint64) frameBegin - profiler->submitTimestamps[frame]) / 1.0e6;
+    profiler->gpuFrames++;
+    profiler->framePending[frame] = false;
+
+    return true;
+}
+
+static void reportGpuProfilerStatistics(GpuProfiler* profiler) {
+    double cpuFrameMs = profiler->cpuFrames > 0 ? profiler->cpuFrameTotalMs / profiler->cpuFrames : 0.0;
+    double gpuFrameMs = profiler->gpuFrames > 0 ? profiler->gpuFrameTotalMs / profiler->gpuFrames : 0.0;
+    double gpuBusyMs = profiler->gpuFrames > 0 ? profiler->gpuBusyTotalMs / profiler->gpuFrames : 0.0;
+    double gpuLatencyMs = profiler->gpuFrames > 0 ? profiler->gpuLatencyTotalMs / profiler->gpuFrames : 0.0;
+
+    LOG3DHW("[profiler] Frame: cpu %.3f ms, gpu %.3f ms (max %.3f ms), gpu latency %.3f ms, %d frames, %d not profiled",
+        cpuFrameMs, gpuFrameMs, profiler->gpuFrameMaxMs, gpuLatencyMs, profiler->cpuFrames, profiler->skippedFrames);
+
+    for (unsigned int i = 0; i < profiler->scopeCount; i++) {
+        GpuScope* scope = &profiler->scopes[i];
+        LOG3DHW("[profiler]   %-8s cpu %.3f ms (max %.3f ms), gpu %.3f ms (max %.3f ms)", scope->name,
+            scope->cpuSamples > 0 ? scope->cpuTotalMs / scope->cpuSamples : 0.0, scope->cpuMaxMs,
+            scope->gpuSamples > 0 ? scope->gpuTotalMs / scope->gpuSamples : 0.0, scope->gpuMaxMs);
+
+        scope->cpuTotalMs = scope->cpuMaxMs = scope->gpuTotalMs = scope->gpuMaxMs = 0.0;
+        scope->cpuSamples = scope->gpuSamples = 0;
+    }
+
+    // Frame span above can't tell the two apart - GPU runs behind CPU, so its frames are as long as CPU's either way.
+    // Busy time (GPU actually working on scopes) is what shows it: when GPU works (almost) whole frame, CPU ends up
+    // waiting for it (usually inside buffer swap), otherwise GPU is idle part of the frame, waiting for CPU to submit more.
+    double busyPercent = cpuFrameMs > 0.0 ? gpuBusyMs / cpuFrameMs * 100.0 : 0.0;
+    if (gpuBusyMs >= cpuFrameMs * 0.9) {
+        LOG3DHW("[profiler]   GPU bound (gpu busy %.3f ms, %.0f%% of frame)", gpuBusyMs, busyPercent);
+    } else {
+        LOG3DHW("[profiler]   CPU bound (gpu busy %.3f ms, %.0f%% of frame)", gpuBusyMs, busyPercent);
+    }
+
+    profiler->cpuFrameTotalMs = profiler->gpuFrameTotalMs = profiler->gpuFrameMaxMs = profiler->gpuBusyTotalMs = 0.0;
+    profiler->gpuLatencyTotalMs = 0.0;
+    profiler->cpuFrames = profiler->gpuFrames = profiler->skippedFrames = 0;
+}
+
+void beginGpuProfilerFrame(GpuProfiler* profiler) {
+    if (!profiler->enabled) {
+        return;
+    }
+
+    double nowMs = monotonicMilliseconds();
+    profiler->cpuFrameTotalMs += nowMs - profiler->frameStartMs;
+    profiler->cpuFrames++;
+    profiler->frameStartMs = nowMs;
+
+    if (nowMs - profiler->reportStartMs >= GPU_PROFILER_REPORT_INTERVAL * 1000.f) {
+        reportGpuProfilerStatistics(profiler);
+        profiler->reportStartMs = nowMs;
+    }
+
+    // Query set is still used by GPU - frame is not profiled, rather than stalling
+    profiler->recording = collectFrameResults(profiler);
+    if (!profiler->recording) {
+        profiler->skippedFrames++;
+        return;
+    }
+
+    glGetInteger64v(GL_TIMESTAMP, &profiler->submitTimestamps[profiler->frame]);
+    glQueryCounter(profiler->frameQueries[profiler->frame][0], GL_TIMESTAMP);
+}
+
+// GL_TIME_ELAPSED queries can't be nested, so scopes have to follow each other
+void beginGpuScope(GpuProfiler* profiler, unsigned int scope) {
+    if (!profiler->enabled) {
+        return;
+    }
+
+    profiler->scopes[scope].cpuStartMs = monotonicMilliseconds();
+    if (profiler->recording) {
+        glBeginQuery(GL_TIME_ELAPSED, profiler->scopes[scope].queries[profiler->frame]);
+    }
+}
+
+void endGpuScope(GpuProfiler* profiler, unsigned int scope) {
+    if (!profiler->enabled) {
+        return;
+    }
+
+    GpuScope* gpuScope = &profiler->scopes[scope];
+    if (profiler->recording) {
+        glEndQuery(GL_TIME_ELAPSED);
+        gpuScope->issued[profiler->frame] = true;
+    }
+
+    double elapsedMs = monotonicMilliseconds() - gpuScope->cpuStartMs;
+    gpuScope->cpuTotalMs += elapsedMs;
+    gpuScope->cpuMaxMs = elapsedMs > gpuScope->cpuMaxMs ? elapsedMs : gpuScope->cpuMaxMs;
+    gpuScope->cpuSamples++;
+}
+
+void endGpuProfilerFrame(GpuProfiler* profiler) {
+    if (!profiler->enabled || !profiler->recording) {
+        return;
+    }
+
+    glQueryCounter(profiler->frameQueries[profiler->frame][1], GL_TIMESTAMP);
+    profiler->framePending[profiler->frame] = true;
+    profiler->frame = (profiler->frame + 1) % GPU_PROFILER_FRAMES;
+}
+
+void destroyGpuProfiler(GpuProfiler* profiler) {
+    if (!profiler->enabled) {
+        return;
+    }
+
+    for (unsigned int i = 0; i < profiler->scopeCount; i++) {
+        glDeleteQueries(GPU_PROFILER_FRAMES, profiler->scopes[i].queries);
+    }
+    glDeleteQueries(GPU_PROFILER_FRAMES * 2, &profiler->frameQueries[0][0]);
+}
@@ -0,0 +1,166 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "renderqueue.h"
+#include "commandbuffer.h"
+#include "glad/gl.h"
+#include "uniforms.h"
+#include "utils.h"
+
+#define RENDER_KEY_ID_MASK ((1u << RENDER_KEY_ID_BITS) - 1)
+#define RENDER_KEY_DEPTH_MAX ((1u << RENDER_KEY_DEPTH_BITS) - 1)
+
+static uint64_t quantizeDepth(const RenderQueue* queue, float depth) {
+    float normalized = depth / queue->farPlane;
+    normalized = normalized < 0.f ? 0.f : (normalized > 1.f ? 1.f : normalized);
+
+    return (uint64_t) (normalized * (float) RENDER_KEY_DEPTH_MAX);
+}
+
+// GL object names are small sequential integers, so their low bits are enough to group draws.
+// Two objects sharing low bits only make grouping less than perfect, every draw still binds its own state.
+static uint64_t buildSortKey(const RenderQueue* queue, const DrawItem* item) {
+    uint64_t state = ((uint64_t) (item->programId & RENDER_KEY_ID_MASK) << (2 * RENDER_KEY_ID_BITS))
+        | ((uint64_t) (item->textureId & RENDER_KEY_ID_MASK) << RENDER_KEY_ID_BITS)
+        | (uint64_t) (item->vao & RENDER_KEY_ID_MASK);
+    uint64_t depth = quantizeDepth(queue, item->depth);
+    uint64_t pass = (uint64_t) item->pass << (64 - RENDER_KEY_PASS_BITS);
+
+    return pass | (state << RENDER_KEY_DEPTH_BITS) | depth;
+}
+
+// LSD radix sort, 8 bits per pass. Passes where all keys have the same byte are skipped,
+// which is common as state bits of scenes with few materials are mostly zero.
+static SortEntry* radixSort(SortEntry* entries, SortEntry* scratch, uint32_t count) {
+    for (unsigned int shift = 0; shift < 64; shift += 8) {
+        uint32_t histogram[256] = { 0 };
+        for (uint32_t i = 0; i < count; i++) {
+            histogram[(entries[i].key >> shift) & 0xFF]++;
+        }
+        if (histogram[(entries[0].key >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (unsigned int bucket = 0; bucket < 256; bucket++) {
+            uint32_t bucketCount = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucketCount;
+        }
+
+        for (uint32_t i = 0; i < count; i++) {
+            scratch[histogram[(entries[i].key >> shift) & 0xFF]++] = entries[i];
+        }
+
+        SortEntry* tmp = entries;
+        entries = scratch;
+        scratch = tmp;
+    }
+
+    return entries;
+}
+
+void createRenderQueue(RenderQueue* queue, uint32_t capacity, float farPlane) {
+    memset(queue, 0, sizeof(RenderQueue));
+    queue->capacity = capacity;
+    queue->farPlane = farPlane;
+    queue->items = (DrawItem*) malloc(sizeof(DrawItem) * capacity);
+    queue->entries = (SortEntry*) malloc(sizeof(SortEntry) * capacity);
+    queue->scratch = (SortEntry*) malloc(sizeof(SortEntry) * capacity);
+    if (queue->items == NULL || queue->entries == NULL || queue->scratch == NULL) {
+        LOG3DHW("[renderqueue] Failed allocating render queue for %d draw items!", capacity);
+        exit(-1);
+    }
+    // Command buffer stays empty (memset above) until first submitRenderQueue() grows it - queues recorded
+    // into other command buffers (scene recorder partitions) never allocate it
+
+    LOG3DHW("[renderqueue] Created render queue (capacity: %d draw items)", capacity);
+}
+
+void beginRenderQueue(RenderQueue* queue) {
+    queue->count = 0;
+}
+
+// Returned item stays valid until submit, caller fills its object uniforms (and index type of indexed draws)
+DrawItem* addDrawItem(RenderQueue* queue, RenderPass pass, GLuint programId, GLuint textureId, GLuint vao,
+    GLint first, GLsizei count, float depth) {
+    if (queue->count >= queue->capacity) {
+        LOG3DHW("[renderqueue] Render queue overflow (capacity: %d draw items)!", queue->capacity);
+        exit(-1);
+    }
+
+    DrawItem* item = &queue->items[queue->count++];
+    item->pass = pass;
+    item->programId = programId;
+    item->textureId = textureId;
+    item->vao = vao;
+    item->first = first;
+    item->count = count;
+    item->indexType = 0;
+    item->depth = depth;
+    item->occlusionQuery = 0;
+
+    return item;
+}
+
+// Sorts gathered items and records their state changes, uniforms and draws. Object uniforms are written straight
+// to reserved range of uniform ring (one ObjectUniforms per item), commands only refer to them by offset.
+// Touches no GL state, so worker threads can record their own queues in parallel (replayed later with replayCommandBuffer()).
+void recordRenderQueue(RenderQueue* queue, CommandBuffer* commands, UniformRange* uniforms) {
+    if (queue->count == 0) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < queue->count; i++) {
+        queue->entries[i].key = buildSortKey(queue, &queue->items[i]);
+        queue->entries[i].item = i;
+    }
+    SortEntry* sorted = radixSort(queue->entries, queue->scratch, queue->count);
+
+    GLuint programId = 0, textureId = 0, vao = 0;
+    for (uint32_t i = 0; i < queue->count; i++) {
+        DrawItem* item = &queue->items[sorted[i].item];
+
+        if (i == 0 || item->programId != programId) {
+            recordUseProgram(commands, item->programId);
+            programId = item->programId;
+        }
+        if (i == 0 || item->textureId != textureId) {
+            recordBindTexture(commands, item->textureId);
+            textureId = item->textureId;
+        }
+        if (i == 0 || item->vao != vao) {
+            recordBindVertexArray(commands, item->vao);
+            vao = item->vao;
+        }
+
+        GLintptr uniformsOffset;
+        memcpy(allocateRangeUniforms(uniforms, sizeof(ObjectUniforms), &uniformsOffset), &item->objectUniforms, sizeof(ObjectUniforms));
+        recordBindUniforms(commands, OBJECT_UNIFORMS_BINDING, uniformsOffset, sizeof(ObjectUniforms));
+        if (item->indexType != 0) {
+            recordDrawElements(commands, item->first, item->count, item->indexType, item->occlusionQuery);
+        } else {
+            recordDrawArrays(commands, item->first, item->count, item->occlusionQuery);
+        }
+    }
+}
+
+// Sorts gathered items and draws them right away. Uniforms have to be pushed between beginUniformRingFrame()
+// and endUniformRingFrame(), so this has to be called inside that range.
+void submitRenderQueue(RenderQueue* queue, UniformRing* uniformRing) {
+    UniformRange uniforms;
+    reserveUniforms(uniformRing, queue->count * alignUniformSize(uniformRing, sizeof(ObjectUniforms)), &uniforms);
+
+    resetCommandBuffer(&queue->commands);
+    recordRenderQueue(queue, &queue->commands, &uniforms);
+    flushUniforms(uniformRing, &uniforms);
+    replayCommandBuffer(&queue->commands, uniformRing);
+}
+
+void destroyRenderQueue(RenderQueue* queue) {
+    free(queue->items);
+    free(queue->entries);
+    free(queue->scratch);
+    destroyCommandBuffer(&queue->commands);
+}
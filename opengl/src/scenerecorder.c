@@ -0,0 +1,181 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad/gl.h"
+#include "linmath.h"
+
+#include "scenerecorder.h"
+#include "culling.h"
+#include "instancing.h"
+#include "utils.h"
+
+// Everything here runs without GL context - objects of the partition go to its render queue,
+// which is sorted and recorded into partition's command buffer
+static void recordScenePartition(ScenePartition* partition) {
+    SceneRecorder* recorder = partition->recorder;
+    int side = instanceGridSide((GLsizei) recorder->objectCount);
+    const float boundingRadius = 1.7320508f; // cube with half extent 1
+
+    beginRenderQueue(&partition->queue);
+    partition->visibleCount = 0;
+    for (uint32_t i = partition->firstObject; i < partition->firstObject + partition->objectCount; i++) {
+        mat4x4 model;
+        instanceGridModel(model, (GLsizei) i, side, recorder->rotationAngle);
+        if (!isSphereInFrustum(recorder->frustumPlanes, model[3], boundingRadius)) {
+            continue;
+        }
+
+        // View space depth of the center, for front-to-back sorting
+        float depth = -(recorder->view[0][2] * model[3][0] + recorder->view[1][2] * model[3][1]
+            + recorder->view[2][2] * model[3][2] + recorder->view[3][2]);
+        DrawItem* item = addDrawItem(&partition->queue, RENDER_PASS_OPAQUE, recorder->programId, recorder->textureId,
+            recorder->vao, recorder->first, recorder->count, depth);
+        item->indexType = recorder->indexType;
+        mat4x4_mul(item->objectUniforms.model, (const float (*)[4]) model, (const float (*)[4]) recorder->meshDequantization);
+        partition->visibleCount++;
+    }
+
+    resetCommandBuffer(&partition->commands);
+    recordRenderQueue(&partition->queue, &partition->commands, &partition->uniforms);
+}
+
+static void scenePartitionWorker(void* userData) {
+    ScenePartition* partition = (ScenePartition*) userData;
+    SceneRecorder* recorder = partition->recorder;
+    uint64_t recordedFrame = 0;
+
+    lockMutex(&recorder->mutex);
+    while (true) {
+        while (recorder->running && recorder->frame == recordedFrame) {
+            waitCondVar(&recorder->frameStarted, &recorder->mutex);
+        }
+
+        if (!recorder->running) {
+            break;
+        }
+        recordedFrame = recorder->frame;
+
+        unlockMutex(&recorder->mutex);
+        recordScenePartition(partition);
+        lockMutex(&recorder->mutex);
+
+        if (--recorder->pendingPartitions == 0) {
+            signalCondVar(&recorder->partitionRecorded);
+        }
+    }
+    unlockMutex(&recorder->mutex);
+}
+
+// Thread count 0 records the whole scene on the calling thread (same commands, just serialized)
+void createSceneRecorder(SceneRecorder* recorder, uint32_t objectCount, uint32_t threadCount, float farPlane) {
+    memset(recorder, 0, sizeof(SceneRecorder));
+    if (threadCount > SCENE_RECORDER_MAX_THREADS) {
+        LOG3DHW("[scenerecorder] Too many recording threads (max: %d)!", SCENE_RECORDER_MAX_THREADS);
+        exit(-1);
+    }
+
+    recorder->objectCount = objectCount;
+    recorder->threaded = threadCount > 0;
+    recorder->partitionCount = threadCount > 0 ? threadCount : 1;
+    recorder->running = true;
+    initMutex(&recorder->mutex);
+    initCondVar(&recorder->frameStarted);
+    initCondVar(&recorder->partitionRecorded);
+
+    for (uint32_t i = 0; i < recorder->partitionCount; i++) {
+        ScenePartition* partition = &recorder->partitions[i];
+        partition->recorder = recorder;
+        partition->firstObject = (uint32_t) ((uint64_t) objectCount * i / recorder->partitionCount);
+        partition->objectCount = (uint32_t) ((uint64_t) objectCount * (i + 1) / recorder->partitionCount) - partition->firstObject;
+        createRenderQueue(&partition->queue, partition->objectCount > 0 ? partition->objectCount : 1, farPlane);
+        createCommandBuffer(&partition->commands, 4096);
+
+        if (recorder->threaded && !createThread(&partition->thread, scenePartitionWorker, partition)) {
+            LOG3DHW("[scenerecorder] Failed creating recording thread!");
+            exit(-1);
+        }
+    }
+
+    LOG3DHW("[scenerecorder] Created scene recorder (%d objects, %d partitions, %s)", objectCount, recorder->partitionCount,
+        recorder->threaded ? "recorded on worker threads" : "recorded on render thread");
+}
+
+// Records all partitions and returns when they are done. Has to be called on render thread, inside uniform ring frame -
+// every partition gets range for all of its objects up front, so workers never touch the ring (or GL) themselves.
+void recordScene(SceneRecorder* recorder, UniformRing* uniformRing, const FrameUniforms* frameUniforms, GLuint programId,
+    GLuint textureId, GLuint vao, GLint first, GLsizei count, GLenum indexType, float meshDequantization[4][4], float rotationAngle) {
+    mat4x4 projection, viewProjection;
+    memcpy(projection, frameUniforms->projection, sizeof(mat4x4));
+    memcpy(recorder->view, frameUniforms->view, sizeof(mat4x4));
+    mat4x4_mul(viewProjection, (const float (*)[4]) projection, (const float (*)[4]) recorder->view);
+    extractFrustumPlanes(viewProjection, recorder->frustumPlanes);
+    recorder->programId = programId;
+    recorder->textureId = textureId;
+    recorder->vao = vao;
+    recorder->first = first;
+    recorder->count = count;
+    recorder->indexType = indexType;
+    memcpy(recorder->meshDequantization, meshDequantization, sizeof(mat4x4));
+    recorder->rotationAngle = rotationAngle;
+
+    GLsizeiptr objectUniformsSize = alignUniformSize(uniformRing, sizeof(ObjectUniforms));
+    for (uint32_t i = 0; i < recorder->partitionCount; i++) {
+        ScenePartition* partition = &recorder->partitions[i];
+        reserveUniforms(uniformRing, partition->objectCount * objectUniformsSize, &partition->uniforms);
+    }
+
+    if (recorder->threaded) {
+        lockMutex(&recorder->mutex);
+        recorder->frame++;
+        recorder->pendingPartitions = recorder->partitionCount;
+        broadcastCondVar(&recorder->frameStarted);
+        while (recorder->pendingPartitions > 0) {
+            waitCondVar(&recorder->partitionRecorded, &recorder->mutex);
+        }
+        unlockMutex(&recorder->mutex);
+    } else {
+        recordScenePartition(&recorder->partitions[0]);
+    }
+
+    for (uint32_t i = 0; i < recorder->partitionCount; i++) {
+        flushUniforms(uniformRing, &recorder->partitions[i].uniforms);
+    }
+
+    recorder->recordedFrames++;
+    for (uint32_t i = 0; i < recorder->partitionCount; i++) {
+        recorder->recordedBytes += recorder->partitions[i].commands.size;
+        recorder->recordedCommands += recorder->partitions[i].commands.commandCount;
+    }
+}
+
+// Has to be called on render thread, inside uniform ring frame. Partitions are replayed in order,
+// so the result is the same no matter how many threads recorded them.
+void replayScene(SceneRecorder* recorder, UniformRing* uniformRing) {
+    for (uint32_t i = 0; i < recorder->partitionCount; i++) {
+        replayCommandBuffer(&recorder->partitions[i].commands, uniformRing);
+    }
+}
+
+void destroySceneRecorder(SceneRecorder* recorder) {
+    lockMutex(&recorder->mutex);
+    recorder->running = false;
+    broadcastCondVar(&recorder->frameStarted);
+    unlockMutex(&recorder->mutex);
+
+    for (uint32_t i = 0; i < recorder->partitionCount; i++) {
+        ScenePartition* partition = &recorder->partitions[i];
+        if (recorder->threaded) {
+            joinThread(partition->thread);
+        }
+        destroyRenderQueue(&partition->queue);
+        destroyCommandBuffer(&partition->commands);
+    }
+
+    destroyCondVar(&recorder->partitionRecorded);
+    destroyCondVar(&recorder->frameStarted);
+    destroyMutex(&recorder->mutex);
+
+    uint64_t frames = recorder->recordedFrames > 0 ? recorder->recordedFrames : 1;
+    LOG3DHW("[scenerecorder] Destroyed scene recorder (avg %llu commands, %llu bytes recorded per frame)",
+        (unsigned long long) (recorder->recordedCommands / frames), (unsigned long long) (recorder->recordedBytes / frames));
+}
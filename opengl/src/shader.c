@@ -1,7 +1,20 @@
+#include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
 
 #include "shader.h"
+#include "uniforms.h"
+#include "instancing.h"
+#include "meshpool.h"
 #include "glad/gl.h"
 #include "utils.h"
 
@@ -28,40 +41,191 @@ bool handleShaderOperationResult(GLuint id, GLenum status) {
     return success;
 }
 
-GLuint loadAndLinkShaderProgram() {
-    // Compile vertex shader
-    GLuint vertexShaderId = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShaderId, 1, &GLSL_VERTEX_SHADER, NULL);
-    glCompileShader(vertexShaderId);
-    if (!handleShaderOperationResult(vertexShaderId, GL_COMPILE_STATUS)) {
+// Assigns uniform blocks to fixed binding points and sampler to texture unit once after linking,
+// so render loop never has to look up uniform locations or set them again.
+// Instanced programs take model matrices from attributes or storage buffer instead of ObjectUniforms block,
+// vertex pulling programs read vertices from mesh pool storage buffers.
+void bindShaderProgramInterface(GLuint programId) {
+    GLuint frameUniformsIndex = glGetUniformBlockIndex(programId, "FrameUniforms");
+    if (frameUniformsIndex == GL_INVALID_INDEX) {
+        LOG3DHW("[shader] FrameUniforms block not found in program %d!", programId);
         exit(-1);
     }
+    glUniformBlockBinding(programId, frameUniformsIndex, FRAME_UNIFORMS_BINDING);
+
+    GLuint objectUniformsIndex = glGetUniformBlockIndex(programId, "ObjectUniforms");
+    if (objectUniformsIndex != GL_INVALID_INDEX) {
+        glUniformBlockBinding(programId, objectUniformsIndex, OBJECT_UNIFORMS_BINDING);
+    }
+
+    GLuint instanceModelsIndex = glGetProgramResourceIndex(programId, GL_SHADER_STORAGE_BLOCK, "InstanceModels");
+    if (instanceModelsIndex != GL_INVALID_INDEX) {
+        glShaderStorageBlockBinding(programId, instanceModelsIndex, INSTANCE_STORAGE_BINDING);
+    }
+
+    GLuint pulledVerticesIndex = glGetProgramResourceIndex(programId, GL_SHADER_STORAGE_BLOCK, "PulledVertices");
+    if (pulledVerticesIndex != GL_INVALID_INDEX) {
+        glShaderStorageBlockBinding(programId, pulledVerticesIndex, MESH_POOL_VERTICES_BINDING);
+        glShaderStorageBlockBinding(programId, glGetProgramResourceIndex(programId, GL_SHADER_STORAGE_BLOCK, "PulledIndices"),
+            MESH_POOL_INDICES_BINDING);
+    }
+
+    // Sampler uniform is part of program state, so it's enough to set it once
+    glUseProgram(programId);
+    glUniform1i(glGetUniformLocation(programId, "texture_diffuse1"), 0);
+    glUseProgram(0);
+}
+
+// FNV-1a, continued over all strings identifying the program
+static uint64_t hashString(uint64_t hash, const char* string) {
+    for (const unsigned char* c = (const unsigned char*) string; *c != '\0'; c++) {
+        hash ^= *c;
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+// Binary is only valid for exactly the same sources on the same GPU and driver.
+// GL_VERSION contains driver version too (e.g. "4.6 (Core Profile) Mesa 23.1.0" or "4.6.0 NVIDIA 535.54").
+uint64_t hashProgram(const char* vertexShaderSource, const char* fragmentShaderSource) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = hashString(hash, vertexShaderSource);
+    hash = hashString(hash, fragmentShaderSource);
+    hash = hashString(hash, (const char*) glGetString(GL_VENDOR));
+    hash = hashString(hash, (const char*) glGetString(GL_RENDERER));
+    hash = hashString(hash, (const char*) glGetString(GL_VERSION));
+    hash = hashString(hash, (const char*) glGetString(GL_SHADING_LANGUAGE_VERSION));
+
+    return hash;
+}
+
+static char programCacheDirectory[PROGRAM_CACHE_PATH_MAX] = PROGRAM_CACHE_DIRECTORY;
+
+void setProgramCacheDirectory(const char* directory) {
+    snprintf(programCacheDirectory, sizeof(programCacheDirectory), "%s", directory);
+
+    LOG3DHW("[shader] Program cache directory: %s", programCacheDirectory);
+}
+
+void getProgramCachePath(char* cachePath, size_t cachePathSize, uint64_t hash) {
+    snprintf(cachePath, cachePathSize, PROGRAM_CACHE_PATH_FORMAT, programCacheDirectory, (unsigned long long) hash);
+}
+
+// Restores program from cache file, returns false when there is no cache or driver rejected the binary
+bool loadProgramBinary(GLuint programId, const char* cachePath, uint64_t hash) {
+    FILE* cacheFile = fopen(cachePath, "rb");
+    if (cacheFile == NULL) {
+        return false;
+    }
+
+    ProgramCacheHeader header;
+    if (fread(&header, sizeof(ProgramCacheHeader), 1, cacheFile) != 1 || header.magic != PROGRAM_CACHE_MAGIC
+        || header.hash != hash || header.length <= 0) {
+        LOG3DHW("[shader] Ignoring invalid program cache file %s", cachePath);
+        fclose(cacheFile);
+        return false;
+    }
+
+    void* binary = malloc(header.length);
+    size_t read = fread(binary, 1, header.length, cacheFile);
+    fclose(cacheFile);
+    if (read != (size_t) header.length) {
+        LOG3DHW("[shader] Ignoring truncated program cache file %s", cachePath);
+        free(binary);
+        return false;
+    }
+
+    // Driver may reject binary any time (e.g. after update which didn't change version string), in that case
+    // link status is false and program has to be compiled from sources
+    glProgramBinary(programId, header.format, binary, header.length);
+    free(binary);
+
+    GLint success = GL_FALSE;
+    glGetProgramiv(programId, GL_LINK_STATUS, &success);
+    if (!success) {
+        LOG3DHW("[shader] Driver rejected cached program binary %s, compiling from sources", cachePath);
+    }
+
+    return success;
+}
+
+void saveProgramBinary(GLuint programId, const char* cachePath, uint64_t hash) {
+    ProgramCacheHeader header = { 0 };
+    header.magic = PROGRAM_CACHE_MAGIC;
+    header.hash = hash;
+    glGetProgramiv(programId, GL_PROGRAM_BINARY_LENGTH, &header.length);
+    if (header.length <= 0) {
+        return;
+    }
+
+    void* binary = malloc(header.length);
+    glGetProgramBinary(programId, header.length, NULL, &header.format, binary);
+
+    // Directory is created on first save, failure because it already exists is expected
+#ifdef _WIN32
+    _mkdir(programCacheDirectory);
+#else
+    mkdir(programCacheDirectory, 0755);
+#endif
 
-    // Compile fragment shader
-    GLuint fragmentShaderId = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShaderId, 1, &GLSL_FRAGMENT_SHADER, NULL);
-    glCompileShader(fragmentShaderId);
-    if (!handleShaderOperationResult(fragmentShaderId, GL_COMPILE_STATUS)) {
+    FILE* cacheFile = fopen(cachePath, "wb");
+    if (cacheFile == NULL) {
+        LOG3DHW("[shader] Failed opening program cache file %s (result: %s)", cachePath, strerror(errno));
+        free(binary);
+        return;
+    }
+
+    fwrite(&header, sizeof(ProgramCacheHeader), 1, cacheFile);
+    fwrite(binary, 1, header.length, cacheFile);
+    fclose(cacheFile);
+    free(binary);
+
+    LOG3DHW("[shader] Saved program binary to %s (%d bytes)", cachePath, header.length);
+}
+
+// Compute programs have no FrameUniforms block, their interface is bound by the module using them
+GLuint loadAndLinkComputeProgramFromSource(const char* computeShaderSource) {
+    GLint binaryFormatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormatCount);
+
+    uint64_t hash = hashProgram(computeShaderSource, "");
+    char cachePath[PROGRAM_CACHE_PATH_MAX];
+    getProgramCachePath(cachePath, sizeof(cachePath), hash);
+
+    if (binaryFormatCount > 0) {
+        GLuint cachedProgramId = glCreateProgram();
+        if (loadProgramBinary(cachedProgramId, cachePath, hash)) {
+            LOG3DHW("[shader] Loaded compute program from cache %s (programId=%d)", cachePath, cachedProgramId);
+
+            return cachedProgramId;
+        }
+        glDeleteProgram(cachedProgramId);
+    }
+
+    GLuint computeShaderId = glCreateShader(GL_COMPUTE_SHADER);
+    glShaderSource(computeShaderId, 1, &computeShaderSource, NULL);
+    glCompileShader(computeShaderId);
+    if (!handleShaderOperationResult(computeShaderId, GL_COMPILE_STATUS)) {
         exit(-1);
     }
 
-    // Create and link shader program
     GLuint programId = glCreateProgram();
-    glAttachShader(programId, vertexShaderId);
-    glAttachShader(programId, fragmentShaderId);
+    glAttachShader(programId, computeShaderId);
+    glProgramParameteri(programId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
     glLinkProgram(programId);
     if (!handleShaderOperationResult(programId, GL_LINK_STATUS)) {
         exit(-1);
     }
 
-    // Detach and delete shaders after linking program
-    glDetachShader(programId, vertexShaderId);
-    glDetachShader(programId, fragmentShaderId);
+    glDetachShader(programId, computeShaderId);
+    glDeleteShader(computeShaderId);
 
-    glDeleteShader(vertexShaderId);
-    glDeleteShader(fragmentShaderId); 
+    if (binaryFormatCount > 0) {
+        saveProgramBinary(programId, cachePath, hash);
+    }
 
-    LOG3DHW("[shader] Compiled and linked shader program (vertexShaderId=%d, fragmentShaderId=%d, programId=%d)", vertexShaderId, fragmentShaderId, programId);
+    LOG3DHW("[shader] Compiled and linked compute program (computeShaderId=%d, programId=%d)", computeShaderId, programId);
 
     return programId;
 }
\ No newline at end of file
@@ -0,0 +1,206 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "shadervariants.h"
+#include "shader.h"
+#include "glad/gl.h"
+#include "utils.h"
+
+// Indexed by bit of the feature in SHADER_FEATURE_* mask
+static const char* SHADER_FEATURE_DEFINES[SHADER_FEATURE_COUNT] = {
+    "TEXTURED", "INSTANCED_ATTRIBUTES", "INSTANCED_STORAGE", "VERTEX_PULLING"
+};
+
+typedef enum ShaderVariantState {
+    SHADER_VARIANT_COMPILING, // compile and link were issued, results weren't checked yet
+    SHADER_VARIANT_READY
+} ShaderVariantState;
+
+typedef struct ShaderVariant {
+    uint32_t features;
+    ShaderVariantState state;
+    GLuint programId;
+    GLuint vertexShaderId;
+    GLuint fragmentShaderId;
+    uint64_t hash; // of sources and driver, names program binary cache file
+} ShaderVariant;
+
+typedef struct ShaderVariantCache {
+    ShaderVariant variants[SHADER_VARIANT_MAX];
+    unsigned int variantCount;
+    bool parallelCompile; // GL_KHR_parallel_shader_compile
+    bool binaryCache; // driver supports at least one program binary format
+
+    // Statistics
+    unsigned int compiledCount;
+    unsigned int restoredCount;
+} ShaderVariantCache;
+
+static ShaderVariantCache variantCache;
+
+void createShaderVariantCache(void) {
+    memset(&variantCache, 0, sizeof(ShaderVariantCache));
+
+    GLint binaryFormatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormatCount);
+    variantCache.binaryCache = binaryFormatCount > 0;
+
+    variantCache.parallelCompile = GLAD_GL_KHR_parallel_shader_compile;
+
+    // Let the driver use as many compiler threads as it wants
+    if (variantCache.parallelCompile) {
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+    }
+
+    LOG3DHW("[shadervariants] Created shader variant cache (parallel compile: %s, program binaries: %s)",
+        variantCache.parallelCompile ? "yes" : "no", variantCache.binaryCache ? "yes" : "no");
+}
+
+static ShaderVariant* findShaderVariant(uint32_t features) {
+    for (unsigned int i = 0; i < variantCache.variantCount; i++) {
+        if (variantCache.variants[i].features == features) {
+            return &variantCache.variants[i];
+        }
+    }
+
+    return NULL;
+}
+
+// Version line, feature defines, optional prelude (functions used by features), then base source.
+// "#line" keeps line numbers in compile errors same as in base source.
+static char* buildVariantSource(uint32_t features, const char* prelude, const char* baseSource) {
+    size_t capacity = strlen(prelude) + strlen(baseSource) + 64;
+    for (unsigned int i = 0; i < SHADER_FEATURE_COUNT; i++) {
+        capacity += strlen(SHADER_FEATURE_DEFINES[i]) + 16;
+    }
+
+    char* source = (char*) malloc(capacity);
+    size_t length = (size_t) snprintf(source, capacity, "#version 430 core\n");
+    for (unsigned int i = 0; i < SHADER_FEATURE_COUNT; i++) {
+        if (features & (1u << i)) {
+            length += (size_t) snprintf(source + length, capacity - length, "#define %s\n", SHADER_FEATURE_DEFINES[i]);
+        }
+    }
+    snprintf(source + length, capacity - length, "%s#line 1\n%s", prelude, baseSource);
+
+    return source;
+}
+
+static GLuint compileShader(GLenum type, const char* source) {
+    GLuint shaderId = glCreateShader(type);
+    glShaderSource(shaderId, 1, &source, NULL);
+    glCompileShader(shaderId);
+
+    return shaderId;
+}
+
+void requestShaderVariant(uint32_t features) {
+    if (findShaderVariant(features) != NULL) {
+        return;
+    }
+    if (variantCache.variantCount == SHADER_VARIANT_MAX) {
+        LOG3DHW("[shadervariants] Too many shader variants (max: %d)!", SHADER_VARIANT_MAX);
+        exit(-1);
+    }
+
+    ShaderVariant* variant = &variantCache.variants[variantCache.variantCount++];
+    memset(variant, 0, sizeof(ShaderVariant));
+    variant->features = features;
+
+    const char* vertexPrelude = (features & SHADER_FEATURE_VERTEX_PULLING) ? GLSL_VERTEX_PULLING_SOURCE : "";
+    char* vertexShaderSource = buildVariantSource(features, vertexPrelude, GLSL_BASE_VERTEX_SHADER);
+    char* fragmentShaderSource = buildVariantSource(features, "", GLSL_BASE_FRAGMENT_SHADER);
+    variant->hash = hashProgram(vertexShaderSource, fragmentShaderSource);
+
+    // Program binary saved by previous run skips compiler completely
+    if (variantCache.binaryCache) {
+        char cachePath[PROGRAM_CACHE_PATH_MAX];
+        getProgramCachePath(cachePath, sizeof(cachePath), variant->hash);
+
+        variant->programId = glCreateProgram();
+        if (loadProgramBinary(variant->programId, cachePath, variant->hash)) {
+            bindShaderProgramInterface(variant->programId);
+            variant->state = SHADER_VARIANT_READY;
+            variantCache.restoredCount++;
+            free(vertexShaderSource);
+            free(fragmentShaderSource);
+
+            LOG3DHW("[shadervariants] Loaded shader variant 0x%x from cache %s (programId=%d)", features, cachePath,
+                variant->programId);
+
+            return;
+        }
+        glDeleteProgram(variant->programId);
+    }
+
+    // Nothing here queries results - with parallel compile all of it returns right away and compiler works
+    // in the background, until status of the program is checked in finishShaderVariant()
+    variant->vertexShaderId = compileShader(GL_VERTEX_SHADER, vertexShaderSource);
+    variant->fragmentShaderId = compileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
+    free(vertexShaderSource);
+    free(fragmentShaderSource);
+
+    variant->programId = glCreateProgram();
+    glAttachShader(variant->programId, variant->vertexShaderId);
+    glAttachShader(variant->programId, variant->fragmentShaderId);
+    glProgramParameteri(variant->programId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(variant->programId);
+    variant->state = SHADER_VARIANT_COMPILING;
+}
+
+// Checks results of compile and link (blocks if they aren't finished yet) and prepares program for use
+static void finishShaderVariant(ShaderVariant* variant) {
+    if (!handleShaderOperationResult(variant->vertexShaderId, GL_COMPILE_STATUS)
+        || !handleShaderOperationResult(variant->fragmentShaderId, GL_COMPILE_STATUS)
+        || !handleShaderOperationResult(variant->programId, GL_LINK_STATUS)) {
+        LOG3DHW("[shadervariants] Failed building shader variant 0x%x!", variant->features);
+        exit(-1);
+    }
+
+    glDetachShader(variant->programId, variant->vertexShaderId);
+    glDetachShader(variant->programId, variant->fragmentShaderId);
+    glDeleteShader(variant->vertexShaderId);
+    glDeleteShader(variant->fragmentShaderId);
+
+    if (variantCache.binaryCache) {
+        char cachePath[PROGRAM_CACHE_PATH_MAX];
+        getProgramCachePath(cachePath, sizeof(cachePath), variant->hash);
+        saveProgramBinary(variant->programId, cachePath, variant->hash);
+    }
+
+    bindShaderProgramInterface(variant->programId);
+    variant->state = SHADER_VARIANT_READY;
+    variantCache.compiledCount++;
+
+    LOG3DHW("[shadervariants] Compiled and linked shader variant 0x%x (vertexShaderId=%d, fragmentShaderId=%d, programId=%d)",
+        variant->features, variant->vertexShaderId, variant->fragmentShaderId, variant->programId);
+}
+
+GLuint getShaderVariant(uint32_t features) {
+    ShaderVariant* variant = findShaderVariant(features);
+    if (variant == NULL) {
+        requestShaderVariant(features);
+        variant = findShaderVariant(features);
+    }
+    if (variant->state == SHADER_VARIANT_COMPILING) {
+        finishShaderVariant(variant);
+    }
+
+    return variant->programId;
+}
+
+void destroyShaderVariantCache(void) {
+    for (unsigned int i = 0; i < variantCache.variantCount; i++) {
+        ShaderVariant* variant = &variantCache.variants[i];
+        if (variant->state == SHADER_VARIANT_COMPILING) {
+            glDeleteShader(variant->vertexShaderId);
+            glDeleteShader(variant->fragmentShaderId);
+        }
+        glDeleteProgram(variant->programId);
+    }
+
+    LOG3DHW("[shadervariants] Destroyed shader variant cache (%d variants: %d compiled, %d loaded from program binary cache)",
+        variantCache.variantCount, variantCache.compiledCount, variantCache.restoredCount);
+}
@@ -0,0 +1,136 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "streambuffer.h"
+#include "glstate.h"
+#include "glad/gl.h"
+#include "utils.h"
+
+// Works like uniform ring (see uniforms.c): one big buffer split into STREAM_BUFFER_FRAMES regions,
+// guarded by fences when persistently mapped. Callers get a pointer and write vertices/indices straight
+// into GPU visible memory, without any driver call per mesh.
+// Without ARB_buffer_storage callers write into CPU shadow copy instead, which is uploaded with a single
+// glBufferSubData per flush (instead of one per mesh) into storage orphaned at the beginning of the frame.
+// Orphaning already gives every frame fresh storage, so that buffer holds just one frame and is always written at offset 0.
+void createStreamBuffer(StreamBuffer* stream, GLsizeiptr frameSize) {
+    memset(stream, 0, sizeof(StreamBuffer));
+
+    stream->frameSize = frameSize;
+    stream->persistent = GLAD_GL_ARB_buffer_storage;
+
+    glGenBuffers(1, &stream->buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, stream->buffer);
+
+    if (stream->persistent) {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_ARRAY_BUFFER, stream->frameSize * STREAM_BUFFER_FRAMES, NULL, flags);
+        stream->mapped = (unsigned char*) glMapBufferRange(GL_ARRAY_BUFFER, 0, stream->frameSize * STREAM_BUFFER_FRAMES, flags);
+        if (stream->mapped == NULL) {
+            LOG3DHW("[streambuffer] Failed mapping stream buffer!");
+            exit(-1);
+        }
+    } else {
+        glBufferData(GL_ARRAY_BUFFER, stream->frameSize, NULL, GL_STREAM_DRAW);
+        stream->shadow = (unsigned char*) malloc(stream->frameSize);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    LOG3DHW("[streambuffer] Created stream buffer (buffer=%d, %d x %ld bytes, %s)", stream->buffer,
+        stream->persistent ? STREAM_BUFFER_FRAMES : 1, (long) stream->frameSize,
+        stream->persistent ? "persistently mapped" : "orphaned with glBufferSubData");
+}
+
+// Only persistent buffer is split into frame regions, orphaned one is reallocated every frame instead
+static GLintptr frameRegionOffset(const StreamBuffer* stream) {
+    return stream->persistent ? stream->frame * stream->frameSize : 0;
+}
+
+void beginStreamBufferFrame(StreamBuffer* stream) {
+    stream->head = 0;
+    stream->flushed = 0;
+
+    if (stream->persistent) {
+        // Wait until GPU is done with draws which used this region STREAM_BUFFER_FRAMES frames ago
+        GLsync fence = stream->fences[stream->frame];
+        if (fence != NULL) {
+            GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000); // 1 s
+            if (result == GL_WAIT_FAILED || result == GL_TIMEOUT_EXPIRED) {
+                LOG3DHW("[streambuffer] Failed waiting for stream buffer fence (result: 0x%x)!", result);
+            }
+
+            glDeleteSync(fence);
+            stream->fences[stream->frame] = NULL;
+        }
+    } else {
+        // Orphaning - driver gives us fresh storage, old one lives until GPU stops using it
+        if (hasDirectStateAccess()) {
+            glNamedBufferData(stream->buffer, stream->frameSize, NULL, GL_STREAM_DRAW);
+        } else {
+            cachedBindBuffer(GL_ARRAY_BUFFER, stream->buffer);
+            glBufferData(GL_ARRAY_BUFFER, stream->frameSize, NULL, GL_STREAM_DRAW);
+        }
+    }
+}
+
+// Reserves size bytes in the current frame region and returns pointer to write them to.
+// Offset is aligned to given value (vertex stride for glDrawArrays first vertex, index size for indices).
+void* allocateStreamData(StreamBuffer* stream, GLsizeiptr size, GLsizeiptr alignment, GLintptr* offset) {
+    GLsizeiptr start = (stream->head + alignment - 1) / alignment * alignment;
+    if (start + size > stream->frameSize) {
+        LOG3DHW("[streambuffer] Stream buffer frame region overflow (size: %ld bytes)!", (long) stream->frameSize);
+        exit(-1);
+    }
+
+    stream->head = start + size;
+    *offset = frameRegionOffset(stream) + start;
+
+    return stream->persistent ? stream->mapped + *offset : stream->shadow + start;
+}
+
+// Has to be called after writing and before draws which read the data. Persistent mapping is coherent,
+// so there is nothing to do; otherwise everything written since the last flush is uploaded at once.
+void flushStreamBuffer(StreamBuffer* stream) {
+    if (stream->persistent || stream->flushed == stream->head) {
+        return;
+    }
+
+    GLintptr offset = frameRegionOffset(stream) + stream->flushed;
+    GLsizeiptr size = stream->head - stream->flushed;
+    if (hasDirectStateAccess()) {
+        glNamedBufferSubData(stream->buffer, offset, size, stream->shadow + stream->flushed);
+    } else {
+        cachedBindBuffer(GL_ARRAY_BUFFER, stream->buffer);
+        glBufferSubData(GL_ARRAY_BUFFER, offset, size, stream->shadow + stream->flushed);
+    }
+
+    stream->flushed = stream->head;
+}
+
+// Has to be called after the last draw using this frame's data was issued
+void endStreamBufferFrame(StreamBuffer* stream) {
+    if (stream->persistent) {
+        stream->fences[stream->frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        stream->frame = (stream->frame + 1) % STREAM_BUFFER_FRAMES;
+    }
+}
+
+void destroyStreamBuffer(StreamBuffer* stream) {
+    for (unsigned int i = 0; i < STREAM_BUFFER_FRAMES; i++) {
+        if (stream->fences[i] != NULL) {
+            glDeleteSync(stream->fences[i]);
+        }
+    }
+
+    if (stream->persistent) {
+        glBindBuffer(GL_ARRAY_BUFFER, stream->buffer);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    glDeleteBuffers(1, &stream->buffer);
+    free(stream->shadow);
+
+    LOG3DHW("[streambuffer] Destroyed stream buffer");
+}
@@ -1,34 +1,339 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
 #include "texture.h"
+#include "glstate.h"
 #include "utils.h"
 #include "glad/gl.h"
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
-GLuint loadTexture() {
-    GLuint textureId = -1;
+// Textures are not uploaded with glTexImage2D at load time (which blocks until driver copies and converts
+// whole image and then generates mipmaps). Instead immutable storage is allocated up front and pixels are copied
+// in small portions through pixel unpack buffer (PBO): CPU writes rows to the staging region, glTexSubImage2D
+// with PBO bound only schedules GPU copy and returns. At most TEXTURE_STREAM_FRAME_BUDGET bytes are sent per frame,
+// so loading textures mid-session doesn't cause frame spikes - texture just gets sharper over a few frames.
+// Streamer may also live on asset loader context (see loader.c), which pushes uploads through the same staging
+// regions without frame budget (finishTextureStreamer()). Render context state cache must not be touched there.
+void createTextureStreamer(TextureStreamer* streamer, bool stateCache) {
+    memset(streamer, 0, sizeof(TextureStreamer));
+    streamer->persistent = GLAD_GL_ARB_buffer_storage;
+    streamer->stateCache = stateCache;
 
-    glGenTextures(1, &textureId);
-    glBindTexture(GL_TEXTURE_2D, textureId);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    GLsizeiptr size = TEXTURE_STREAM_FRAME_BUDGET * TEXTURE_STREAM_REGIONS;
+    glGenBuffers(1, &streamer->pbo);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, streamer->pbo);
 
-    int x, y, n;
-    unsigned char* data = stbi_load(TEXTURE_PATH, &x, &y, &n, 0);
-    
-    if (data) {
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, x, y, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
+    if (streamer->persistent) {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_PIXEL_UNPACK_BUFFER, size, NULL, flags);
+        streamer->mapped = (unsigned char*) glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, flags);
+        if (streamer->mapped == NULL) {
+            LOG3DHW("[texture] Failed mapping texture staging buffer!");
+            exit(-1);
+        }
+    } else {
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW);
+    }
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
-        stbi_image_free(data);
+    LOG3DHW("[texture] Created texture streamer (pbo=%d, %d x %d bytes, %s)", streamer->pbo, TEXTURE_STREAM_REGIONS,
+        TEXTURE_STREAM_FRAME_BUDGET, streamer->persistent ? "persistently mapped" : "mapped every frame");
+}
+
+// State cache tracks bindings of render context only, so streamer on loader context binds directly
+static void bindStreamerBuffer(const TextureStreamer* streamer, GLenum target, GLuint buffer) {
+    if (streamer->stateCache) {
+        cachedBindBuffer(target, buffer);
+    } else {
+        glBindBuffer(target, buffer);
+    }
+}
 
-        LOG3DHW("[texture] Loaded texture %s", TEXTURE_PATH);
+static void bindStreamerTexture(const TextureStreamer* streamer, GLuint texture) {
+    if (streamer->stateCache) {
+        cachedBindTexture(0, GL_TEXTURE_2D, texture);
     } else {
-        LOG3DHW("[texture] Failed loading texture!");
+        glBindTexture(GL_TEXTURE_2D, texture);
+    }
+}
+
+// Box filter, halves both dimensions (odd edge is clamped)
+static unsigned char* downsampleLevel(const unsigned char* src, GLsizei srcWidth, GLsizei srcHeight, GLsizei dstWidth, GLsizei dstHeight) {
+    unsigned char* dst = (unsigned char*) malloc((size_t) dstWidth * dstHeight * 4);
+    if (dst == NULL) {
+        LOG3DHW("[texture] Failed allocating mip level!");
+        exit(-1);
+    }
+
+    for (GLsizei y = 0; y < dstHeight; y++) {
+        GLsizei y0 = y * 2;
+        GLsizei y1 = y0 + 1 < srcHeight ? y0 + 1 : y0;
+        for (GLsizei x = 0; x < dstWidth; x++) {
+            GLsizei x0 = x * 2;
+            GLsizei x1 = x0 + 1 < srcWidth ? x0 + 1 : x0;
+            for (int c = 0; c < 4; c++) {
+                unsigned int sum = src[(y0 * srcWidth + x0) * 4 + c] + src[(y0 * srcWidth + x1) * 4 + c]
+                    + src[(y1 * srcWidth + x0) * 4 + c] + src[(y1 * srcWidth + x1) * 4 + c];
+                dst[(y * dstWidth + x) * 4 + c] = (unsigned char) ((sum + 2) / 4);
+            }
+        }
+    }
+
+    return dst;
+}
+
+static GLsizei levelSize(GLsizei size, GLint level) {
+    GLsizei levelSize = size >> level;
+    return levelSize > 0 ? levelSize : 1;
+}
 
+// Image is decoded as RGBA8, so driver never has to convert pixels on upload.
+// Full mip chain is built on CPU, so nothing has to run glGenerateMipmap after the upload.
+static void decodeTexture(const char* path, TextureUpload* upload) {
+    int x, y, n;
+    unsigned char* data = stbi_load(path, &x, &y, &n, 4);
+    if (data == NULL) {
+        LOG3DHW("[texture] Failed loading texture %s!", path);
         exit(-1);
     }
 
+    memset(upload, 0, sizeof(TextureUpload));
+    upload->path = path;
+    upload->width = x;
+    upload->height = y;
+
+    upload->mips[0] = data;
+    upload->levels = 1;
+    while ((x > 1 || y > 1) && upload->levels < TEXTURE_MAX_LEVELS) {
+        GLint level = upload->levels++;
+        upload->mips[level] = downsampleLevel(upload->mips[level - 1], levelSize(upload->width, level - 1),
+            levelSize(upload->height, level - 1), levelSize(upload->width, level), levelSize(upload->height, level));
+        x = levelSize(upload->width, level);
+        y = levelSize(upload->height, level);
+    }
+}
+
+static void freeTextureMips(TextureUpload* upload) {
+    stbi_image_free(upload->mips[0]);
+    for (GLint level = 1; level < upload->levels; level++) {
+        free(upload->mips[level]);
+    }
+}
+
+// Single texel texture used in place of textures which are still loading
+GLuint createPlaceholderTexture() {
+    const unsigned char texel[4] = { 255, 255, 255, 255 };
+
+    GLuint textureId;
+    glGenTextures(1, &textureId);
+    glBindTexture(GL_TEXTURE_2D, textureId);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, 1, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, texel);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
     return textureId;
-}
\ No newline at end of file
+}
+
+// Returns texture right away, its contents are uploaded by following updateTextureStreamer() calls.
+GLuint streamTexture(TextureStreamer* streamer, const char* path) {
+    if (streamer->uploadCount >= TEXTURE_STREAM_MAX_UPLOADS) {
+        LOG3DHW("[texture] Too many pending texture uploads (max: %d)!", TEXTURE_STREAM_MAX_UPLOADS);
+        exit(-1);
+    }
+
+    TextureUpload* upload = &streamer->uploads[streamer->uploadCount++];
+    decodeTexture(path, upload);
+
+    // Smallest level goes first; GL_TEXTURE_BASE_LEVEL follows the last complete level,
+    // so texture is usable (blurry) after the first frame and gets sharper while upload goes on
+    upload->level = upload->levels - 1;
+    upload->row = 0;
+
+    // With DSA texture is created and set up without touching any binding
+    if (hasDirectStateAccess()) {
+        glCreateTextures(GL_TEXTURE_2D, 1, &upload->textureId);
+        glTextureStorage2D(upload->textureId, upload->levels, GL_RGBA8, upload->width, upload->height);
+        glTextureParameteri(upload->textureId, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTextureParameteri(upload->textureId, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTextureParameteri(upload->textureId, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTextureParameteri(upload->textureId, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTextureParameteri(upload->textureId, GL_TEXTURE_BASE_LEVEL, upload->level);
+    } else {
+        glGenTextures(1, &upload->textureId);
+        bindStreamerTexture(streamer, upload->textureId);
+        glTexStorage2D(GL_TEXTURE_2D, upload->levels, GL_RGBA8, upload->width, upload->height);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, upload->level);
+    }
+
+    LOG3DHW("[texture] Queued texture %s for streaming (texture=%d, %dx%d, %d levels)", path, upload->textureId,
+        upload->width, upload->height, upload->levels);
+
+    return upload->textureId;
+}
+
+// Has to be called once per frame. Fills next staging region with rows of pending uploads (up to the frame budget)
+// and schedules their copies to textures.
+void updateTextureStreamer(TextureStreamer* streamer) {
+    if (streamer->uploadCount == 0) {
+        return;
+    }
+
+    // If GPU still copies from this region, we skip the frame rather than wait
+    GLsync fence = streamer->fences[streamer->region];
+    if (fence != NULL) {
+        GLenum result = glClientWaitSync(fence, 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED) {
+            return;
+        } else if (result == GL_WAIT_FAILED) {
+            LOG3DHW("[texture] Failed waiting for texture staging fence!");
+        }
+
+        glDeleteSync(fence);
+        streamer->fences[streamer->region] = NULL;
+    }
+
+    GLintptr regionOffset = streamer->region * TEXTURE_STREAM_FRAME_BUDGET;
+    bindStreamerBuffer(streamer, GL_PIXEL_UNPACK_BUFFER, streamer->pbo);
+
+    unsigned char* region;
+    if (streamer->persistent) {
+        region = streamer->mapped + regionOffset;
+    } else {
+        // Region is guarded by fence, so there is no need for driver to synchronize the mapping
+        region = (unsigned char*) glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, regionOffset, TEXTURE_STREAM_FRAME_BUDGET,
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        if (region == NULL) {
+            LOG3DHW("[texture] Failed mapping texture staging region!");
+            exit(-1);
+        }
+    }
+
+    TextureCopy copies[TEXTURE_STREAM_MAX_COPIES];
+    unsigned int copyCount = 0;
+    GLsizeiptr used = 0;
+    unsigned int uploadIndex = 0;
+    while (uploadIndex < streamer->uploadCount && copyCount < TEXTURE_STREAM_MAX_COPIES) {
+        TextureUpload* upload = &streamer->uploads[uploadIndex];
+        GLsizei width = levelSize(upload->width, upload->level);
+        GLsizei height = levelSize(upload->height, upload->level);
+        GLsizeiptr rowSize = (GLsizeiptr) width * 4; // RGBA8 rows are always 4 byte aligned (GL_UNPACK_ALIGNMENT)
+
+        // Row wider than whole region (over 65536 texels) can't be staged. It goes straight from client memory,
+        // alone in its update, so streaming of such texture moves on by a row every frame instead of getting stuck.
+        const unsigned char* pixels = upload->mips[upload->level] + upload->row * rowSize;
+        bool direct = rowSize > TEXTURE_STREAM_FRAME_BUDGET;
+        GLsizei rows = direct ? (used == 0 ? 1 : 0) : (GLsizei) ((TEXTURE_STREAM_FRAME_BUDGET - used) / rowSize);
+        if (rows > height - upload->row) {
+            rows = height - upload->row;
+        }
+        if (rows == 0) {
+            break; // budget exhausted
+        }
+
+        if (!direct) {
+            memcpy(region + used, pixels, rows * rowSize);
+        }
+
+        TextureCopy* copy = &copies[copyCount++];
+        copy->textureId = upload->textureId;
+        copy->level = upload->level;
+        copy->width = width;
+        copy->row = upload->row;
+        copy->rows = rows;
+        copy->offset = regionOffset + used;
+        copy->pixels = direct ? pixels : NULL;
+        copy->lastInLevel = upload->row + rows == height;
+        used = direct ? TEXTURE_STREAM_FRAME_BUDGET : used + rows * rowSize;
+
+        upload->row += rows;
+        if (upload->row == height) {
+            if (upload->level == 0) {
+                uploadIndex++; // all levels copied, upload is finished below
+            } else {
+                upload->level--;
+                upload->row = 0;
+            }
+        }
+    }
+
+    if (!streamer->persistent) {
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    }
+
+    // With PBO bound, last parameter of glTexSubImage2D is offset in the buffer, not client memory pointer
+    for (unsigned int i = 0; i < copyCount; i++) {
+        TextureCopy* copy = &copies[i];
+        const void* pixels = copy->pixels != NULL ? copy->pixels : (const void*) copy->offset;
+        if (copy->pixels != NULL) {
+            bindStreamerBuffer(streamer, GL_PIXEL_UNPACK_BUFFER, 0);
+        }
+        if (hasDirectStateAccess()) {
+            glTextureSubImage2D(copy->textureId, copy->level, 0, copy->row, copy->width, copy->rows, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+            if (copy->lastInLevel) {
+                glTextureParameteri(copy->textureId, GL_TEXTURE_BASE_LEVEL, copy->level);
+            }
+        } else {
+            bindStreamerTexture(streamer, copy->textureId);
+            glTexSubImage2D(GL_TEXTURE_2D, copy->level, 0, copy->row, copy->width, copy->rows, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+            if (copy->lastInLevel) {
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, copy->level);
+            }
+        }
+    }
+    // Unpack buffer can't stay bound, client memory uploads elsewhere would read from it
+    bindStreamerBuffer(streamer, GL_PIXEL_UNPACK_BUFFER, 0);
+
+    streamer->fences[streamer->region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    streamer->region = (streamer->region + 1) % TEXTURE_STREAM_REGIONS;
+
+    // Release finished uploads (they are always at the front, uploads are served in order)
+    for (unsigned int i = 0; i < uploadIndex; i++) {
+        TextureUpload* upload = &streamer->uploads[i];
+        freeTextureMips(upload);
+
+        LOG3DHW("[texture] Streamed texture %s (texture=%d)", upload->path, upload->textureId);
+    }
+    streamer->uploadCount -= uploadIndex;
+    memmove(&streamer->uploads[0], &streamer->uploads[uploadIndex], streamer->uploadCount * sizeof(TextureUpload));
+}
+
+// Streams all pending uploads right away, waiting for staging regions GPU still copies from. Meant for loader thread,
+// where there are no frames to spread uploads over and waiting doesn't stall rendering.
+void finishTextureStreamer(TextureStreamer* streamer) {
+    while (streamer->uploadCount > 0) {
+        GLsync fence = streamer->fences[streamer->region];
+        if (fence != NULL && glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED) { // 1 s
+            LOG3DHW("[texture] Texture staging region still in use after 1 s, waiting more");
+            continue;
+        }
+
+        updateTextureStreamer(streamer);
+    }
+}
+
+void destroyTextureStreamer(TextureStreamer* streamer) {
+    for (unsigned int i = 0; i < TEXTURE_STREAM_REGIONS; i++) {
+        if (streamer->fences[i] != NULL) {
+            glDeleteSync(streamer->fences[i]);
+        }
+    }
+
+    for (unsigned int i = 0; i < streamer->uploadCount; i++) {
+        freeTextureMips(&streamer->uploads[i]);
+    }
+
+    if (streamer->persistent) {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, streamer->pbo);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    glDeleteBuffers(1, &streamer->pbo);
+}
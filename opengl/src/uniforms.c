@@ -0,0 +1,174 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "uniforms.h"
+#include "glstate.h"
+#include "glad/gl.h"
+#include "utils.h"
+
+// Uniform data for all draws is written into one buffer, split into UNIFORM_RING_FRAMES regions,
+// so CPU can fill region of the next frame while GPU still reads previous ones.
+// With ARB_buffer_storage the buffer is mapped once (persistent & coherent) and we just memcpy into it,
+// fence per region makes sure we never overwrite data GPU hasn't consumed yet.
+// Without it, buffer storage is orphaned with glBufferData(NULL) every frame and filled with glBufferSubData
+// (reserved ranges are written to CPU shadow copy of the region and uploaded in one call by flushUniforms()).
+void createUniformRing(UniformRing* ring, GLsizeiptr frameSize) {
+    memset(ring, 0, sizeof(UniformRing));
+
+    // Offsets passed to glBindBufferRange have to be multiple of this (typically 16-256 bytes)
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &ring->offsetAlignment);
+    ring->frameSize = (frameSize + ring->offsetAlignment - 1) / ring->offsetAlignment * ring->offsetAlignment;
+    ring->persistent = GLAD_GL_ARB_buffer_storage;
+
+    glGenBuffers(1, &ring->buffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, ring->buffer);
+
+    if (ring->persistent) {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_UNIFORM_BUFFER, ring->frameSize * UNIFORM_RING_FRAMES, NULL, flags);
+        ring->mapped = (unsigned char*) glMapBufferRange(GL_UNIFORM_BUFFER, 0, ring->frameSize * UNIFORM_RING_FRAMES, flags);
+        if (ring->mapped == NULL) {
+            LOG3DHW("[uniforms] Failed mapping uniform buffer!");
+            exit(-1);
+        }
+    } else {
+        glBufferData(GL_UNIFORM_BUFFER, ring->frameSize * UNIFORM_RING_FRAMES, NULL, GL_STREAM_DRAW);
+        ring->shadow = (unsigned char*) malloc(ring->frameSize);
+    }
+
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    LOG3DHW("[uniforms] Created uniform ring (buffer=%d, %d x %ld bytes, alignment=%d, %s)", ring->buffer, UNIFORM_RING_FRAMES,
+        (long) ring->frameSize, ring->offsetAlignment, ring->persistent ? "persistently mapped" : "orphaned with glBufferSubData");
+}
+
+void beginUniformRingFrame(UniformRing* ring) {
+    ring->head = 0;
+
+    if (ring->persistent) {
+        // Wait until GPU is done with draws which used this region UNIFORM_RING_FRAMES frames ago.
+        // Usually the fence is long signaled by now, so this doesn't block.
+        GLsync fence = ring->fences[ring->frame];
+        if (fence != NULL) {
+            GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000); // 1 s
+            if (result == GL_WAIT_FAILED || result == GL_TIMEOUT_EXPIRED) {
+                LOG3DHW("[uniforms] Failed waiting for uniform ring fence (result: 0x%x)!", result);
+            }
+
+            glDeleteSync(fence);
+            ring->fences[ring->frame] = NULL;
+        }
+    } else {
+        // Orphaning - driver gives us fresh storage, old one lives until GPU stops using it
+        if (hasDirectStateAccess()) {
+            glNamedBufferData(ring->buffer, ring->frameSize * UNIFORM_RING_FRAMES, NULL, GL_STREAM_DRAW);
+        } else {
+            cachedBindBuffer(GL_UNIFORM_BUFFER, ring->buffer);
+            glBufferData(GL_UNIFORM_BUFFER, ring->frameSize * UNIFORM_RING_FRAMES, NULL, GL_STREAM_DRAW);
+        }
+    }
+}
+
+GLsizeiptr alignUniformSize(const UniformRing* ring, GLsizeiptr size) {
+    return (size + ring->offsetAlignment - 1) / ring->offsetAlignment * ring->offsetAlignment;
+}
+
+// Moves head of the current frame region by aligned size and returns buffer offset of the space
+static GLintptr allocateUniforms(UniformRing* ring, GLsizeiptr size) {
+    GLsizeiptr alignedSize = alignUniformSize(ring, size);
+    if (ring->head + alignedSize > ring->frameSize) {
+        LOG3DHW("[uniforms] Uniform ring frame region overflow (size: %ld bytes)!", (long) ring->frameSize);
+        exit(-1);
+    }
+
+    GLintptr offset = ring->frame * ring->frameSize + ring->head;
+    ring->head += alignedSize;
+
+    return offset;
+}
+
+// Copies data to the current frame region and returns its offset in the buffer (for bindUniforms())
+GLintptr pushUniforms(UniformRing* ring, const void* data, GLsizeiptr size) {
+    GLintptr offset = allocateUniforms(ring, size);
+    if (ring->persistent) {
+        memcpy(ring->mapped + offset, data, size);
+    } else if (hasDirectStateAccess()) {
+        glNamedBufferSubData(ring->buffer, offset, size, data);
+    } else {
+        cachedBindBuffer(GL_UNIFORM_BUFFER, ring->buffer);
+        glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+    }
+
+    return offset;
+}
+
+// Has to be called on render thread, inside uniform ring frame. Range itself can be written from any thread,
+// it's just memory - only flushUniforms() (and draws using it) have to wait until writing is done.
+void reserveUniforms(UniformRing* ring, GLsizeiptr size, UniformRange* range) {
+    range->offset = allocateUniforms(ring, size);
+    range->data = ring->persistent ? ring->mapped + range->offset : ring->shadow + (range->offset - ring->frame * ring->frameSize);
+    range->size = alignUniformSize(ring, size);
+    range->head = 0;
+    range->offsetAlignment = ring->offsetAlignment;
+}
+
+// Same as pushUniforms(), but inside reserved range and without copying - caller writes to returned pointer
+void* allocateRangeUniforms(UniformRange* range, GLsizeiptr size, GLintptr* offset) {
+    GLsizeiptr alignedSize = (size + range->offsetAlignment - 1) / range->offsetAlignment * range->offsetAlignment;
+    if (range->head + alignedSize > range->size) {
+        LOG3DHW("[uniforms] Uniform range overflow (size: %ld bytes)!", (long) range->size);
+        exit(-1);
+    }
+
+    void* data = range->data + range->head;
+    *offset = range->offset + range->head;
+    range->head += alignedSize;
+
+    return data;
+}
+
+// Makes written part of the range visible to GPU. Persistent mapping is coherent, so there is nothing to do;
+// otherwise it's uploaded from shadow copy at once.
+void flushUniforms(UniformRing* ring, const UniformRange* range) {
+    if (ring->persistent || range->head == 0) {
+        return;
+    }
+
+    if (hasDirectStateAccess()) {
+        glNamedBufferSubData(ring->buffer, range->offset, range->head, range->data);
+    } else {
+        cachedBindBuffer(GL_UNIFORM_BUFFER, ring->buffer);
+        glBufferSubData(GL_UNIFORM_BUFFER, range->offset, range->head, range->data);
+    }
+}
+
+void bindUniforms(UniformRing* ring, GLuint binding, GLintptr offset, GLsizeiptr size) {
+    cachedBindBufferRange(GL_UNIFORM_BUFFER, binding, ring->buffer, offset, size);
+}
+
+// Has to be called after the last draw using this frame's uniforms was issued
+void endUniformRingFrame(UniformRing* ring) {
+    if (ring->persistent) {
+        ring->fences[ring->frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    ring->frame = (ring->frame + 1) % UNIFORM_RING_FRAMES;
+}
+
+void destroyUniformRing(UniformRing* ring) {
+    for (unsigned int i = 0; i < UNIFORM_RING_FRAMES; i++) {
+        if (ring->fences[i] != NULL) {
+            glDeleteSync(ring->fences[i]);
+        }
+    }
+
+    if (ring->persistent) {
+        glBindBuffer(GL_UNIFORM_BUFFER, ring->buffer);
+        glUnmapBuffer(GL_UNIFORM_BUFFER);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+
+    glDeleteBuffers(1, &ring->buffer);
+    free(ring->shadow);
+}
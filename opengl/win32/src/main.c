@@ -1,5 +1,7 @@
 #include <stdio.h>
 #include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
 #define _USE_MATH_DEFINES
 #include <math.h>
 #define WIN32_LEAN_AND_MEAN // https://devblogs.microsoft.com/oldnewthing/20091130-00/?p=15863
@@ -13,8 +15,21 @@
 // Internal stuff
 #include "gldebug.h"
 #include "shader.h"
+#include "shadervariants.h"
 #include "mesh.h"
+#include "meshpool.h"
 #include "texture.h"
+#include "uniforms.h"
+#include "instancing.h"
+#include "profiler.h"
+#include "framepacing.h"
+#include "glstate.h"
+#include "renderqueue.h"
+#include "culling.h"
+#include "streambuffer.h"
+#include "occlusion.h"
+#include "scenerecorder.h"
+#include "capture.h"
 #include "utils.h"
 
 const int WINDOW_WIDTH = 1600;
@@ -36,6 +51,72 @@ LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
 void printLastError(const TCHAR* message);
 
 int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _In_ LPSTR lpCmdLine, _In_ int nShowCmd) {
+    // "--instances <count> [attributes|ssbo]" draws given number of cubes with single instanced draw call,
+    // "--gpu-culling" frustum culls instances in compute shader and draws visible ones with single glDrawElementsIndirect,
+    // "--dynamic-cubes <count>" draws cubes whose vertices are generated on CPU every frame (streamed geometry),
+    // "--objects <count>" draws cubes with individual draw calls, recorded on "--record-threads <n>" threads (0 - render thread),
+    // "--occlusion <count>" draws cubes hidden behind the big one, skipped on GPU based on occlusion queries,
+    // "--vertex-pulling" draws cube from packed mesh pool storage buffers instead of vertex attributes,
+    // "--capture <path>" writes every frame as raw RGBA video to file ("-" for stdout) without stalling rendering,
+    // "--profile" periodically reports CPU and GPU time of frame parts and frame time jitter,
+    // "--program-cache <dir>" stores linked program binaries in given directory instead of next to the executable
+    GLsizei instanceCount = 0;
+    bool profile = false;
+    bool gpuCulling = false;
+    unsigned int dynamicCubeCount = 0;
+    unsigned int occludedCubeCount = 0;
+    unsigned int sceneObjectCount = 0;
+    unsigned int recordThreadCount = SCENE_RECORDER_DEFAULT_THREADS;
+    bool vertexPulling = false;
+    const char* capturePath = NULL;
+    char programCacheDirectory[MAX_PATH] = { 0 };
+    InstanceLayout instanceLayout = INSTANCE_LAYOUT_ATTRIBUTES;
+    // lpCmdLine is one string, C runtime already split it into __argc/__argv the same way main() gets it
+    // (quoted arguments with spaces included), so flags are parsed in any order like on Linux
+    int argc = __argc;
+    char** argv = __argv;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--instances") == 0 && i + 1 < argc) {
+            instanceCount = atoi(argv[++i]);
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                instanceLayout = parseInstanceLayout(argv[++i]);
+            }
+        } else if (strcmp(argv[i], "--gpu-culling") == 0) {
+            gpuCulling = true;
+        } else if (strcmp(argv[i], "--dynamic-cubes") == 0 && i + 1 < argc) {
+            dynamicCubeCount = (unsigned int) atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--objects") == 0 && i + 1 < argc) {
+            sceneObjectCount = (unsigned int) atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--record-threads") == 0 && i + 1 < argc) {
+            recordThreadCount = (unsigned int) atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--occlusion") == 0 && i + 1 < argc) {
+            occludedCubeCount = (unsigned int) atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--vertex-pulling") == 0) {
+            vertexPulling = true;
+        } else if (strcmp(argv[i], "--capture") == 0 && i + 1 < argc) {
+            capturePath = argv[++i];
+        } else if (strcmp(argv[i], "--profile") == 0) {
+            profile = true;
+        } else if (strcmp(argv[i], "--program-cache") == 0 && i + 1 < argc) {
+            snprintf(programCacheDirectory, sizeof(programCacheDirectory), "%s", argv[++i]);
+        }
+    }
+
+    FILE* captureOutput = capturePath != NULL ? openCaptureOutput(capturePath) : NULL;
+    if (programCacheDirectory[0] == '\0') {
+        // Program binaries are cached next to the executable by default, so they don't end up in whatever
+        // directory the demo was started from
+        char executablePath[MAX_PATH] = { 0 };
+        GetModuleFileNameA(NULL, executablePath, MAX_PATH);
+        char* lastSeparator = strrchr(executablePath, '\\');
+        if (lastSeparator != NULL) {
+            *lastSeparator = '\0';
+            snprintf(programCacheDirectory, sizeof(programCacheDirectory), "%s\\%s", executablePath, PROGRAM_CACHE_DIRECTORY);
+        } else {
+            snprintf(programCacheDirectory, sizeof(programCacheDirectory), "%s", PROGRAM_CACHE_DIRECTORY);
+        }
+    }
+
     WindowData windowData = { 0 };
     initGlContext(hInstance, &windowData);
     ShowWindow(windowData.windowHandle, nShowCmd);
@@ -47,29 +128,99 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
     glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
     glDebugMessageCallback(glDebugCallbackFunction, NULL);
 
+    // Per-frame binds go through state cache, so unchanged state doesn't reach the driver
+    createGLStateCache(profile);
+
     // Enable backface culling
     glEnable(GL_CULL_FACE);
     glCullFace(GL_BACK);
 
+    // Enable depth testing (occlusion tests are made against the depth buffer too)
+    glEnable(GL_DEPTH_TEST);
+
     glViewport(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT); // set initial viewport size
 
-    // Load and compile shader program
-    GLuint shaderProgramId = loadAndLinkShaderProgram();
+    // All shader variants this run draws with are requested first, so with parallel shader compile
+    // they are compiled side by side while the rest of startup goes on
+    setProgramCacheDirectory(programCacheDirectory);
+    createShaderVariantCache();
+    uint32_t cubeShaderFeatures = SHADER_FEATURE_TEXTURED | (vertexPulling ? SHADER_FEATURE_VERTEX_PULLING : 0);
+    requestShaderVariant(cubeShaderFeatures);
+    if (dynamicCubeCount > 0) {
+        requestShaderVariant(SHADER_FEATURE_TEXTURED);
+    }
+    if (instanceCount > 0) {
+        requestShaderVariant(instanceLayoutShaderFeatures(instanceLayout));
+    }
+    if (occludedCubeCount > 0) {
+        requestShaderVariant(0);
+    }
+    GLuint shaderProgramId = getShaderVariant(cubeShaderFeatures);
 
     // Load cube vertices data to GPU
     GLuint meshVao = loadCubeMesh();
 
-    // Load texture
-    GLuint textureId = loadTexture();
+    // With vertex pulling cube is drawn from mesh pool, any other mesh added there would share its buffers and vertex array
+    MeshPool meshPool = { 0 };
+    GLuint cubeVao = meshVao;
+    GLint cubeFirstIndex = 0;
+    GLsizei cubeIndexCount = CUBE_INDEX_COUNT;
+    GLenum cubeIndexType = CUBE_INDEX_TYPE;
+    mat4x4 cubeDequantization; // cube mesh buffer stores quantized positions, this turns them back into cube's ones
+    getCubeDequantization(cubeDequantization);
+    if (vertexPulling) {
+        createMeshPool(&meshPool, 1024, 4096, 1.f);
+        PooledMesh cubeMesh = addCubeToMeshPool(&meshPool);
+        cubeVao = meshPool.vao;
+        cubeFirstIndex = cubeMesh.firstIndex;
+        cubeIndexCount = cubeMesh.indexCount;
+        cubeIndexType = 0; // pool's indices are read by vertex shader, draw itself isn't indexed
+        mat4x4_identity(cubeDequantization); // pool unpacks positions with its own scale
+    }
+
+    // Texture storage is created right away, pixels are streamed in over the next frames
+    TextureStreamer textureStreamer;
+    createTextureStreamer(&textureStreamer, true);
+    GLuint textureId = streamTexture(&textureStreamer, TEXTURE_PATH);
+
+    // Create ring buffer for per-frame and per-object uniform data
+    UniformRing uniformRing;
+    // (every object and occluded cube push model matrix for its draw, occluded one for bounding box test too, 256 is the largest offset alignment)
+    createUniformRing(&uniformRing, sizeof(FrameUniforms) + sizeof(ObjectUniforms) + 1024 + (occludedCubeCount * 2 + sceneObjectCount) * 256);
+
+    // Optional instanced path, used to stress test the backend with many objects
+    InstanceBatch instanceBatch = { 0 };
+    if (instanceCount > 0) {
+        createInstanceBatch(&instanceBatch, instanceLayout, getShaderVariant(instanceLayoutShaderFeatures(instanceLayout)),
+            instanceCount, meshVao, CUBE_INDEX_COUNT, CUBE_INDEX_TYPE, cubeDequantization);
+    }
+
+    // Instances outside of view frustum are dropped by compute shader, cube bounding sphere radius is sqrt(3)
+    CullingPass cullingPass = { 0 };
+    if (instanceCount > 0 && gpuCulling) {
+        createCullingPass(&cullingPass, &instanceBatch, sqrtf(3.f));
+    }
+
+    // Resource creation above binds objects directly
+    invalidateGLStateCache();
+
+    // GPU timers for main parts of the frame
+    GpuProfiler gpuProfiler;
+    createGpuProfiler(&gpuProfiler, profile);
+    unsigned int clearScope = addGpuScope(&gpuProfiler, "clear");
+    unsigned int drawScope = addGpuScope(&gpuProfiler, "draw");
+    unsigned int swapScope = addGpuScope(&gpuProfiler, "swap");
+
+    // Caps number of frames queued ahead of GPU
+    FramePacer framePacer;
+    createFramePacer(&framePacer, FRAME_PACER_DEFAULT_FRAMES_IN_FLIGHT, profile);
 
     // Cube rotation vars
     float rotationAngle = 0.f;
     const float rotationSpeedRadians = (45.f * ((float) M_PI / 180.f)); // rotate by 45 degree / s
 
-    // GL matrices setup
-    float modelMat[4][4] = { { 0.f } };
-    float perspectiveMat[4][4] = { { 0.f } };
-    float viewMat[4][4] = { { 0.f } };
+    // GL matrices setup (uploaded as std140 uniform blocks)
+    FrameUniforms frameUniforms = { 0 };
 
     // Camera vectors setup
     const float cameraPos[] = { 0.f, 0.f, 0.f }; // we position our camera at [0, 0, 0] in world space
@@ -79,6 +230,45 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
     const float zNear = 0.01f; // near plane
     const float zFar = 1000.f; // far plane
 
+    // Regular (non-instanced) draws are gathered every frame and submitted sorted by state and depth
+    RenderQueue renderQueue;
+    createRenderQueue(&renderQueue, 16 + occludedCubeCount, zFar);
+
+    // Geometry generated every frame is written to stream buffer, its vertex array uses the same layout as cube mesh
+    StreamBuffer streamBuffer = { 0 };
+    GLuint streamVao = 0;
+    GLuint streamProgramId = 0; // streamed vertices are always read through vertex attributes
+    if (dynamicCubeCount > 0) {
+        createStreamBuffer(&streamBuffer, dynamicCubeCount * CUBE_VERTEX_COUNT * CUBE_VERTEX_STRIDE);
+        glGenVertexArrays(1, &streamVao);
+        attachCubeMeshBuffer(streamVao, streamBuffer.buffer);
+        streamProgramId = getShaderVariant(SHADER_FEATURE_TEXTURED);
+        invalidateGLStateCache();
+    }
+
+    // Optional scene of cubes drawn one by one, culled, sorted and recorded into command buffers on worker threads
+    SceneRecorder sceneRecorder;
+    if (sceneObjectCount > 0) {
+        createSceneRecorder(&sceneRecorder, sceneObjectCount, recordThreadCount, zFar);
+    }
+
+    // Bounding boxes of occluded cubes are tested against depth buffer after opaque draws, next frame uses the results
+    OcclusionCuller occlusionCuller;
+    if (occludedCubeCount > 0) {
+        createOcclusionCuller(&occlusionCuller, getShaderVariant(0), meshVao);
+        for (unsigned int i = 0; i < occludedCubeCount; i++) {
+            addOccludedObject(&occlusionCuller);
+        }
+        invalidateGLStateCache();
+    }
+
+    // Frames are read back into pixel pack buffers and written to capture output on writer thread
+    // (capture keeps initial size, resized window is cropped or padded)
+    FrameCapture frameCapture;
+    if (captureOutput != NULL) {
+        createFrameCapture(&frameCapture, WINDOW_WIDTH, WINDOW_HEIGHT, captureOutput);
+    }
+
     // Delta time between consecutive renders, used as "smoothing" value for rotation
     // Normally it would be applied to all movement on screen. 
     // Even better solution would be to use fixed timestep (especially if there is any physics 
@@ -105,43 +295,164 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
             DispatchMessage(&msg);
         }
 
+        waitForFrameSlot(&framePacer);
+        beginGpuProfilerFrame(&gpuProfiler);
+
+        beginGpuScope(&gpuProfiler, clearScope);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         glClearColor((99.f / 255.f), (139.f / 255.f), (235.f / 255.f), 1.f);
+        endGpuScope(&gpuProfiler, clearScope);
 
-        // Preparing model matrix
-        mat4x4_identity(modelMat); // model matrix have to be identity matrix initially
-        mat4x4_translate(modelMat, 0.f, 0.f, -5.f); // apply translation to model matrix; move cube to the back, to be in front of camera
-        mat4x4_rotate(modelMat, modelMat, 0.7f, 0.2f, -0.8f, rotationAngle); // apply in-place rotation to model matrix
-        rotationAngle += (rotationSpeedRadians * deltaTime);
+        beginGpuScope(&gpuProfiler, drawScope);
 
         // Preparing perspective matrix
-        mat4x4_perspective(perspectiveMat, fov, ((float) windowData.currentWidth / (float) windowData.currentHeight), zNear, zFar);
+        mat4x4_perspective(frameUniforms.projection, fov, ((float) windowData.currentWidth / (float) windowData.currentHeight), zNear, zFar);
 
         // Preparing view (world-to-camera) matrix
-        mat4x4_look_at(viewMat, cameraPos, front, up);
+        mat4x4_look_at(frameUniforms.view, cameraPos, front, up);
+
+        // Copy next portion of pending texture uploads (within per-frame budget)
+        updateTextureStreamer(&textureStreamer);
+
+        // Uniforms are written to this frame's region of the ring and bound by range, block bindings
+        // and sampler unit were already set when program was linked
+        beginUniformRingFrame(&uniformRing);
+        GLintptr frameUniformsOffset = pushUniforms(&uniformRing, &frameUniforms, sizeof(FrameUniforms));
+        bindUniforms(&uniformRing, FRAME_UNIFORMS_BINDING, frameUniformsOffset, sizeof(FrameUniforms));
+        if (vertexPulling) {
+            bindMeshPool(&meshPool);
+        }
+
+        cachedBindTexture(0, GL_TEXTURE_2D, textureId);
+
+        if (instanceCount > 0) {
+            // Drawing all cubes with single instanced draw call, model matrices are taken from instance buffer
+            updateInstanceGrid(&instanceBatch, rotationAngle);
+            if (gpuCulling) {
+                cullInstanceBatch(&cullingPass, &instanceBatch, &frameUniforms);
+                drawCulledInstanceBatch(&cullingPass, &instanceBatch);
+            } else {
+                drawInstanceBatch(&instanceBatch);
+            }
+        } else if (sceneObjectCount > 0) {
+            // Only replay of already recorded commands runs on this thread
+            recordScene(&sceneRecorder, &uniformRing, &frameUniforms, shaderProgramId, textureId, cubeVao, cubeFirstIndex,
+                cubeIndexCount, cubeIndexType, cubeDequantization, rotationAngle);
+            replayScene(&sceneRecorder, &uniformRing);
+        } else {
+            beginRenderQueue(&renderQueue);
+            if (occludedCubeCount > 0) {
+                updateOcclusionResults(&occlusionCuller);
+            }
+            if (dynamicCubeCount > 0) {
+                beginStreamBufferFrame(&streamBuffer);
+            }
+
+            // Cube is 5 units in front of camera, our cube have 36 indices -> 12 triangles
+            DrawItem* cube = addDrawItem(&renderQueue, RENDER_PASS_OPAQUE, shaderProgramId, textureId, cubeVao, cubeFirstIndex, cubeIndexCount, 5.f);
+            cube->indexType = cubeIndexType;
+
+            // Preparing model matrix
+            mat4x4_identity(cube->objectUniforms.model); // model matrix have to be identity matrix initially
+            mat4x4_translate(cube->objectUniforms.model, 0.f, 0.f, -5.f); // apply translation to model matrix; move cube to the back, to be in front of camera
+            mat4x4_rotate(cube->objectUniforms.model, (const float (*)[4]) cube->objectUniforms.model, 0.7f, 0.2f, -0.8f, rotationAngle); // apply in-place rotation to model matrix
+            mat4x4_mul(cube->objectUniforms.model, (const float (*)[4]) cube->objectUniforms.model, (const float (*)[4]) cubeDequantization);
+
+            // Small cubes orbiting the big one, regenerated on CPU every frame and written straight to stream buffer
+            if (dynamicCubeCount > 0) {
+                GLintptr streamOffset;
+                float* vertices = (float*) allocateStreamData(&streamBuffer, dynamicCubeCount * CUBE_VERTEX_COUNT * CUBE_VERTEX_STRIDE,
+                    CUBE_VERTEX_STRIDE, &streamOffset);
+                for (unsigned int i = 0; i < dynamicCubeCount; i++) {
+                    float orbitAngle = rotationAngle + (float) i * 2.f * (float) M_PI / (float) dynamicCubeCount;
+                    mat4x4 model;
+                    mat4x4_translate(model, cosf(orbitAngle) * 3.f, sinf(orbitAngle) * 3.f, -5.f);
+                    mat4x4_rotate(model, (const float (*)[4]) model, 0.7f, 0.2f, -0.8f, -2.f * rotationAngle);
+                    mat4x4_scale_aniso(model, (const float (*)[4]) model, 0.2f, 0.2f, 0.2f);
+                    writeCubeVertices(vertices + i * CUBE_VERTEX_COUNT * (CUBE_VERTEX_STRIDE / sizeof(float)), model);
+                }
+                flushStreamBuffer(&streamBuffer);
+
+                // Vertices are already in world space, so the whole ring is a single draw with identity model matrix
+                DrawItem* dynamicCubes = addDrawItem(&renderQueue, RENDER_PASS_OPAQUE, streamProgramId, textureId, streamVao,
+                    (GLint) (streamOffset / CUBE_VERTEX_STRIDE), dynamicCubeCount * CUBE_VERTEX_COUNT, 5.f);
+                mat4x4_identity(dynamicCubes->objectUniforms.model);
+            }
+
+            // Layers of 4x4 smaller cubes behind the big one - mostly hidden, each is drawn conditionally on its last test
+            for (unsigned int i = 0; i < occludedCubeCount; i++) {
+                float z = -12.f - 3.f * (float) (i / 16);
+                DrawItem* occludedCube = addDrawItem(&renderQueue, RENDER_PASS_OPAQUE, shaderProgramId, textureId, cubeVao, cubeFirstIndex, cubeIndexCount, -z);
+                occludedCube->indexType = cubeIndexType;
+                mat4x4_translate(occludedCube->objectUniforms.model, ((float) (i % 4) - 1.5f) * 1.2f, ((float) (i / 4 % 4) - 1.5f) * 1.2f, z);
+                mat4x4_scale_aniso(occludedCube->objectUniforms.model, (const float (*)[4]) occludedCube->objectUniforms.model, 0.5f, 0.5f, 0.5f);
+                mat4x4_mul(occludedCube->objectUniforms.model, (const float (*)[4]) occludedCube->objectUniforms.model, (const float (*)[4]) cubeDequantization);
+                setOccludedObjectBounds(&occlusionCuller, i, occludedCube->objectUniforms.model);
+                occludedCube->occlusionQuery = getOcclusionQuery(&occlusionCuller, i);
+            }
 
-        // Setting uniforms in shader program (we have to only pass pointer to first element of matrix)
-        glUseProgram(shaderProgramId);
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgramId, "projection"), 1, false, &perspectiveMat[0][0]);
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgramId, "view"), 1, false, &viewMat[0][0]);
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgramId, "model"), 1, false, &modelMat[0][0]);
+            // Drawing cube (state stays bound, next frame binds the same one)
+            submitRenderQueue(&renderQueue, &uniformRing);
+            if (occludedCubeCount > 0) {
+                issueOcclusionTests(&occlusionCuller, &uniformRing);
+            }
+            if (dynamicCubeCount > 0) {
+                endStreamBufferFrame(&streamBuffer);
+            }
+        }
+        rotationAngle += (rotationSpeedRadians * deltaTime);
 
-        glActiveTexture(GL_TEXTURE0);
-        glUniform1i(glGetUniformLocation(shaderProgramId, "texture_diffuse1"), 0);
-        glBindTexture(GL_TEXTURE_2D, textureId);
+        endUniformRingFrame(&uniformRing);
 
-        // Drawing cube
-        glBindVertexArray(meshVao);
-        glDrawArrays(GL_TRIANGLES, 0, 36); // our cube have 108 vertices -> 36 triangles
-        glBindVertexArray(0);
+        // Back buffer still holds the frame before swap
+        if (captureOutput != NULL) {
+            captureFrame(&frameCapture);
+        }
+        endGpuScope(&gpuProfiler, drawScope);
 
+        beginGpuScope(&gpuProfiler, swapScope);
         SwapBuffers(windowData.deviceContextHandle);
+        endGpuScope(&gpuProfiler, swapScope);
+        endFramePacerFrame(&framePacer);
+
+        endGpuProfilerFrame(&gpuProfiler);
+        endGLStateCacheFrame();
 
         // Uncomment this to see deltaTime in action - consistent cube rotation regardless of FPS.
         // This simulates frame time of ~100ms (10FPS) 
         // Sleep(100);
     }
 
+    if (instanceCount > 0) {
+        if (gpuCulling) {
+            destroyCullingPass(&cullingPass);
+        }
+        destroyInstanceBatch(&instanceBatch);
+    }
+    destroyUniformRing(&uniformRing);
+    destroyTextureStreamer(&textureStreamer);
+    destroyGpuProfiler(&gpuProfiler);
+    destroyFramePacer(&framePacer);
+    destroyRenderQueue(&renderQueue);
+    if (dynamicCubeCount > 0) {
+        glDeleteVertexArrays(1, &streamVao);
+        destroyStreamBuffer(&streamBuffer);
+    }
+    if (occludedCubeCount > 0) {
+        destroyOcclusionCuller(&occlusionCuller);
+    }
+    if (vertexPulling) {
+        destroyMeshPool(&meshPool);
+    }
+    if (sceneObjectCount > 0) {
+        destroySceneRecorder(&sceneRecorder);
+    }
+    if (captureOutput != NULL) {
+        destroyFrameCapture(&frameCapture);
+    }
+    destroyShaderVariantCache();
+    destroyGLStateCache();
+
     return 0;
 }
 
@@ -313,10 +624,12 @@ void initGlContext(HINSTANCE hInstance, WindowData* windowData) {
     }
 
     // Having real GL context as current one, we can safely load GL from GLAD
+    double loadStartMs = monotonicMilliseconds();
     if (!gladLoaderLoadGL()) {
         LOG3DHW("[window-win32] Failed loading GL!");
         exit(-1);
     }
+    LOG3DHW("[window-win32] Loaded GL functions in %.3f ms (%s)", monotonicMilliseconds() - loadStartMs, GL_LOADING_MODE);
 
     // Print GL version
     LOG3DHW("[window-win32] OpenGL version: %s", glGetString(GL_VERSION));
@@ -10,8 +10,20 @@ typedef struct UniformBufferObject {
     float proj[4][4];
 } UniformBufferObject;
 
+#define MULTIVIEW_MAX_VIEWS 8
+
+// Uniform buffer for rendering the same model from several cameras at once - each view (array layer)
+// picks its own view and projection matrix by view index
+typedef struct MultiviewUniformBufferObject {
+    float model[4][4];
+    float view[MULTIVIEW_MAX_VIEWS][4][4];
+    float proj[MULTIVIEW_MAX_VIEWS][4][4];
+} MultiviewUniformBufferObject;
+
 void createUniformBuffers(VulkanData* vkData);
 
+void createCubeMeshBuffers(VulkanData* vkData);
+
 void createBuffer(VulkanData* vkData, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags memoryProperties, VkBuffer* buffer, VkDeviceMemory* bufferMemory);
 
 void destroyBuffer(VulkanData* vkData, VkBuffer buffer, VkDeviceMemory bufferMemory);
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdbool.h>
+#include <vulkan/vulkan.h>
+
+#include "vkdata.h"
+
+// What changed in the scene since command buffers were recorded. Any change makes
+// affected per-frame command buffers dirty, so they're re-recorded before next use.
+typedef enum SceneChangeFlagBits {
+    SCENE_CHANGE_NONE = 0,
+    SCENE_CHANGE_DRAW_LIST = 1 << 0, // pipelines, vertex buffers or draw calls
+    SCENE_CHANGE_BINDINGS = 1 << 1, // descriptor sets
+    SCENE_CHANGE_RENDER_TARGETS = 1 << 2 // render pass or framebuffers
+} SceneChangeFlagBits;
+typedef uint32_t SceneChangeFlags;
+
+// Passes of the frame render graph in execution order. Transient image lifetimes are given in these.
+typedef enum FramePass {
+    FRAME_PASS_MAIN,
+    FRAME_PASS_POST_PROCESS,
+    FRAME_PASS_PRESENT
+} FramePass;
+
+void createFrameCommandBuffers(VulkanData* vkData);
+
+void markSceneChanged(VulkanData* vkData, SceneChangeFlags changes);
+
+void markFrameChanged(VulkanData* vkData, uint32_t imageIndex, SceneChangeFlags changes);
+
+bool updateFrameCommandBuffer(VulkanData* vkData, uint32_t imageIndex);
+
+void destroyFrameCommandBuffers(VulkanData* vkData);
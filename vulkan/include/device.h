@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stdbool.h>
 #include <vulkan/vulkan.h>
 
 #include "vkdata.h"
@@ -8,6 +9,17 @@ static const char* requiredDeviceExts[] = {
     VK_KHR_SWAPCHAIN_EXTENSION_NAME
 };
 
+// Extensions required for fast-linked pipelines; enabled only if physical device supports all of them
+static const char* graphicsPipelineLibraryDeviceExts[] = {
+    VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME,
+    VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME
+};
+
+// Extensions required for rendering multiple views in single render pass; enabled only if supported
+static const char* multiviewDeviceExts[] = {
+    VK_KHR_MULTIVIEW_EXTENSION_NAME
+};
+
 #ifdef _WIN32
 VkBool32 checkPresentationSupport(VulkanData* vkData, int queueFamilyIndex);
 #else
@@ -22,9 +34,12 @@ void pickPhysicalDevice(VulkanData* vkData);
 void createDeviceQueues(VulkanData* vkData, const char* validationLayerNames[], int validationLayerCount);
 #else
 #include <X11/Xlib.h>
+// Display may be NULL for offscreen only rendering (no presentation queue, no swapchain extension)
 void createDeviceQueues(VulkanData* vkData, Display* display, XVisualInfo* visualInfo, const char* validationLayerNames[], int validationLayerCount);
 #endif
 
 void createSynchronizationPrimitives(VulkanData* vkData);
 
+bool tryFindMemoryIndex(VulkanData* vkData, uint32_t typeFilter, VkMemoryPropertyFlags requiredMemPropertyFlags, uint32_t* memoryIndex);
+
 uint32_t findMemoryIndex(VulkanData* vkData, uint32_t typeFilter, VkMemoryPropertyFlags requiredMemPropertyFlags);
\ No newline at end of file
@@ -1,14 +1,37 @@
 #pragma once
 
+#include <stdbool.h>
+
 #include "vkdata.h"
 
+// Pipeline state which can differ between pipelines sharing the same layout and render pass
+typedef struct PipelineVariant {
+    VkPolygonMode polygonMode;
+    VkCullModeFlags cullMode;
+    VkPipelineCreateFlags flags;
+} PipelineVariant;
+
 void createDescriptorSetLayout(VulkanData* vkData);
 
-void createGraphicsPipeline(VulkanData* vkData);
+PipelineVariant getDefaultPipelineVariant();
 
-void createRenderPass(VulkanData* vkData);
+void createGraphicsPipelineLayout(VulkanData* vkData);
+
+void createGraphicsPipelineVariant(VulkanData* vkData, const PipelineVariant* variant, VkPipeline* pipeline);
+
+void createOffscreenGraphicsPipeline(VulkanData* vkData, VkRenderPass renderPass, VkPipelineLayout pipelineLayout, VkExtent2D extent,
+    VkShaderModule vertexShaderModule, VkShaderModule fragmentShaderModule, VkPipeline* pipeline);
 
-void createCommandBuffers(VulkanData* vkData);
+void createFullscreenPipeline(VulkanData* vkData, VkRenderPass renderPass, VkPipelineLayout pipelineLayout, VkExtent2D extent,
+    VkShaderModule vertexShaderModule, VkShaderModule fragmentShaderModule, VkPipeline* pipeline);
+
+void createGraphicsPipelineLibrary(VulkanData* vkData, const PipelineVariant* variant, 
+    VkGraphicsPipelineLibraryFlagsEXT libraryPart, VkPipeline* library);
+
+void linkGraphicsPipelineLibraries(VulkanData* vkData, const VkPipeline* libraries, uint32_t libraryCount, bool optimize,
+    VkPipeline* pipeline);
+
+void createRenderPass(VulkanData* vkData);
 
 void createCommandPool(VulkanData* vkData);
 
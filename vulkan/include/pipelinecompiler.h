@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stdbool.h>
+#include <vulkan/vulkan.h>
+
+#include "vkdata.h"
+#include "pipeline.h"
+#include "threading.h"
+
+#define PIPELINE_COMPILER_THREAD_COUNT 2
+#define PIPELINE_COMPILER_MAX_JOBS 32 // pipelines requested, but not delivered yet
+
+// Called on the thread calling pollPipelineCompiler() when requested pipeline is ready.
+// Ownership of the pipeline is passed to the callback receiver.
+typedef void (*PipelineReadyCallback)(VulkanData* vkData, uint32_t pipelineId, VkPipeline pipeline, void* userData);
+
+typedef enum PipelineJobState {
+    PIPELINE_JOB_FREE, // slot can be reused, pipeline was delivered (or job was flushed)
+    PIPELINE_JOB_QUEUED,
+    PIPELINE_JOB_COMPILING,
+    PIPELINE_JOB_READY
+} PipelineJobState;
+
+typedef struct PipelineJob {
+    uint32_t pipelineId;
+    PipelineVariant variant;
+    PipelineJobState state;
+    VkPipeline pipeline;
+    PipelineReadyCallback readyCallback;
+    void* userData;
+    float compileTimeMs;
+} PipelineJob;
+
+typedef struct PipelineCompiler {
+    VulkanData* vkData;
+    Thread threads[PIPELINE_COMPILER_THREAD_COUNT];
+    Mutex mutex;
+    CondVar jobQueued;
+    CondVar jobFinished;
+    PipelineJob jobs[PIPELINE_COMPILER_MAX_JOBS];
+    uint32_t nextPipelineId; // IDs are never reused, so stale ID can't refer to job in recycled slot
+    uint32_t firstValidPipelineId; // IDs below this were issued before last flush
+    uint32_t jobsQueued;
+    uint32_t jobsInProgress;
+    bool running;
+
+    // With VK_EXT_graphics_pipeline_library, vertex input, fragment shader and fragment output
+    // interface parts are shared by all variants and created once (per render pass). They retain
+    // link time optimization info, so the same libraries serve both fast and optimized linking.
+    VkPipeline vertexInputLibrary;
+    VkPipeline fragmentShaderLibrary;
+    VkPipeline fragmentOutputLibrary;
+} PipelineCompiler;
+
+void createPipelineCompiler(VulkanData* vkData, PipelineCompiler* compiler);
+
+// Creates pipeline usable right away, on calling thread. With pipeline libraries it's only linked from
+// prebuilt parts (no link time optimization), otherwise it's compiled with optimizations disabled.
+void createFallbackPipeline(PipelineCompiler* compiler, const PipelineVariant* variant, VkPipeline* pipeline);
+
+// Queues fully optimized pipeline for compilation on worker threads
+uint32_t requestPipeline(PipelineCompiler* compiler, const PipelineVariant* variant, PipelineReadyCallback readyCallback, void* userData);
+
+bool isPipelineReady(PipelineCompiler* compiler, uint32_t pipelineId);
+
+VkPipeline getPipelineOrFallback(PipelineCompiler* compiler, uint32_t pipelineId, VkPipeline fallbackPipeline);
+
+void pollPipelineCompiler(PipelineCompiler* compiler);
+
+void flushPipelineCompiler(PipelineCompiler* compiler);
+
+void destroyPipelineCompiler(PipelineCompiler* compiler);
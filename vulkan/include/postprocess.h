@@ -0,0 +1,17 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "vkdata.h"
+
+// Scene is rendered and post processed in the same format swapchain is created with (see createSwapchainAndImageViews()),
+// so neither post pass nor the final blit converts pixel values
+#define SCENE_COLOR_FORMAT VK_FORMAT_B8G8R8A8_UNORM
+
+void createPostProcessing(VulkanData* vkData);
+
+void destroyPostProcessing(VulkanData* vkData);
+
+void recordPostProcessPass(VulkanData* vkData, VkCommandBuffer commandBuffer, uint32_t imageIndex, void* userData);
+
+void recordPresentPass(VulkanData* vkData, VkCommandBuffer commandBuffer, uint32_t imageIndex, void* userData);
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <stdbool.h>
+#include <vulkan/vulkan.h>
+
+#include "vkdata.h"
+
+#define RENDER_GRAPH_MAX_RESOURCES 16
+#define RENDER_GRAPH_MAX_PASSES 16
+#define RENDER_GRAPH_MAX_PASS_ACCESSES 8
+
+// How a resource is used by a pass. Each access maps to pipeline stages, access flags and (for images) layout,
+// so passes only declare what they do and the graph works out barriers between them.
+typedef enum ResourceAccess {
+    ACCESS_NONE, // contents undefined, e.g. image not used yet
+    ACCESS_SWAPCHAIN_ACQUIRE, // image acquired with vkAcquireNextImageKHR (semaphore waited at color attachment output)
+    ACCESS_HOST_WRITE,
+    ACCESS_HOST_READ, // e.g. mapped readback buffer read after queue is idle
+    ACCESS_TRANSFER_READ,
+    ACCESS_TRANSFER_WRITE,
+    ACCESS_INDIRECT_BUFFER_READ,
+    ACCESS_VERTEX_BUFFER_READ,
+    ACCESS_INDEX_BUFFER_READ,
+    ACCESS_UNIFORM_READ,
+    ACCESS_VERTEX_SHADER_READ,
+    ACCESS_FRAGMENT_SHADER_READ,
+    ACCESS_COMPUTE_SHADER_READ,
+    ACCESS_COMPUTE_SHADER_WRITE,
+    ACCESS_COLOR_ATTACHMENT_WRITE,
+    ACCESS_DEPTH_ATTACHMENT_READ,
+    ACCESS_DEPTH_ATTACHMENT_WRITE,
+    ACCESS_PRESENT
+} ResourceAccess;
+
+typedef struct AccessInfo {
+    VkPipelineStageFlags stageMask;
+    VkAccessFlags accessMask;
+    VkImageLayout layout;
+    bool write;
+} AccessInfo;
+
+typedef void (*RenderGraphPassCallback)(VulkanData* vkData, VkCommandBuffer commandBuffer, uint32_t imageIndex, void* userData);
+
+typedef struct RenderGraphResource {
+    const char* name;
+    VkImage image; // either image or buffer is set
+    VkImageAspectFlags aspectMask;
+    VkBuffer buffer;
+    ResourceAccess initialAccess; // how resource was used before the graph starts
+    ResourceAccess finalAccess; // how resource has to be left after the graph ends; ACCESS_NONE if it's graph internal
+    bool transient; // contents are discarded between graph executions (first use transitions from undefined layout)
+} RenderGraphResource;
+
+typedef struct RenderGraphPassAccess {
+    uint32_t resource;
+    ResourceAccess access;
+} RenderGraphPassAccess;
+
+// Barriers executed as single vkCmdPipelineBarrier() call
+typedef struct RenderGraphBarrierBatch {
+    VkPipelineStageFlags srcStageMask;
+    VkPipelineStageFlags dstStageMask;
+    VkMemoryBarrier memoryBarrier; // covers all hazards not requiring layout transition
+    VkImageMemoryBarrier imageBarriers[RENDER_GRAPH_MAX_RESOURCES];
+    uint32_t imageBarrierCount;
+} RenderGraphBarrierBatch;
+
+typedef struct RenderGraphPass {
+    const char* name;
+    RenderGraphPassAccess accesses[RENDER_GRAPH_MAX_PASS_ACCESSES];
+    uint32_t accessCount;
+    RenderGraphPassCallback callback;
+    void* userData;
+
+    // Computed by compileRenderGraph()
+    bool culled;
+    RenderGraphBarrierBatch barriers; // executed before the pass
+} RenderGraphPass;
+
+typedef struct RenderGraph {
+    RenderGraphResource resources[RENDER_GRAPH_MAX_RESOURCES];
+    uint32_t resourceCount;
+    RenderGraphPass passes[RENDER_GRAPH_MAX_PASSES];
+    uint32_t passCount;
+
+    // Computed by compileRenderGraph(), executed after the last pass
+    RenderGraphBarrierBatch finalBarriers;
+} RenderGraph;
+
+AccessInfo getAccessInfo(ResourceAccess access);
+
+void initRenderGraph(RenderGraph* graph);
+
+uint32_t addRenderGraphImage(RenderGraph* graph, const char* name, VkImage image, VkImageAspectFlags aspectMask,
+    ResourceAccess initialAccess, ResourceAccess finalAccess);
+
+uint32_t addRenderGraphTransientImage(RenderGraph* graph, const char* name, VkImage image, VkImageAspectFlags aspectMask,
+    ResourceAccess previousAccess);
+
+uint32_t addRenderGraphBuffer(RenderGraph* graph, const char* name, VkBuffer buffer, ResourceAccess initialAccess, ResourceAccess finalAccess);
+
+uint32_t addRenderGraphPass(RenderGraph* graph, const char* name, RenderGraphPassCallback callback, void* userData);
+
+void addRenderGraphPassAccess(RenderGraph* graph, uint32_t pass, uint32_t resource, ResourceAccess access);
+
+void compileRenderGraph(RenderGraph* graph);
+
+void executeRenderGraph(VulkanData* vkData, RenderGraph* graph, VkCommandBuffer commandBuffer, uint32_t imageIndex);
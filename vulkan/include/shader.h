@@ -7,3 +7,5 @@
 void loadShaderFromFile(const char* filename, char** shaderBytes, size_t* shaderBytesLen);
 
 void createShaderModules(VulkanData *vkData, VkShaderModule *vertexShaderModule, VkShaderModule *fragmentShaderModule);
+
+void createShaderModule(VulkanData* vkData, const char* shaderBytes, size_t shaderBytesLen, VkShaderModule* shaderModule);
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <stdint.h>
+#include <vulkan/vulkan.h>
+
+#include "vkdata.h"
+
+#define THUMBNAIL_SIZE 256
+#define THUMBNAIL_FORMAT VK_FORMAT_R8G8B8A8_UNORM
+#define THUMBNAIL_DEFAULT_COUNT 8
+
+void renderThumbnails(VulkanData* vkData, uint32_t thumbnailCount, const char* filenamePrefix);
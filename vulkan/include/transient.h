@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include "vkdata.h"
+
+#define TRANSIENT_MAX_IMAGES 8
+
+// Render target which is only needed during part of a frame (depth, MSAA color, post-processing buffers).
+// Lifetime is given as range of render graph passes using the image.
+typedef struct TransientImage {
+    const char* name;
+    VkFormat format;
+    VkImageUsageFlags usage;
+    VkImageAspectFlags aspectMask;
+    uint32_t firstPass;
+    uint32_t lastPass;
+
+    VkImage image;
+    VkImageView imageView;
+    VkDeviceSize size;
+    uint32_t block; // memory block the image is bound to; images sharing a block alias each other
+} TransientImage;
+
+typedef struct TransientImagePool {
+    TransientImage images[TRANSIENT_MAX_IMAGES];
+    uint32_t imageCount;
+    VkDeviceMemory blocks[TRANSIENT_MAX_IMAGES];
+    uint32_t blockCount;
+} TransientImagePool;
+
+uint32_t addTransientImage(TransientImagePool* pool, const char* name, VkFormat format, VkImageUsageFlags usage,
+    VkImageAspectFlags aspectMask, uint32_t firstPass, uint32_t lastPass);
+
+void allocateTransientImages(VulkanData* vkData, TransientImagePool* pool);
+
+void freeTransientImages(VulkanData* vkData, TransientImagePool* pool);
+
+void createTransientImages(VulkanData* vkData);
+
+void destroyTransientImages(VulkanData* vkData);
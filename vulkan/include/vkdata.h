@@ -2,6 +2,8 @@
 
 #include <vulkan/vulkan.h>
 
+typedef struct TransientImagePool TransientImagePool;
+
 typedef struct VulkanData {
     VkInstance instance;
     VkDebugUtilsMessengerEXT debugUtilsMessenger;
@@ -23,11 +25,20 @@ typedef struct VulkanData {
     VkDescriptorSet* descriptorSets;
     VkRenderPass renderPass;
     VkPipeline pipeline;
+    VkPipelineCache pipelineCache;
     VkFramebuffer* framebuffers;
-    VkCommandBuffer* commandBuffers;
-    VkCommandPool commandPool;
+    VkCommandBuffer* commandBuffers; // one per swapchain image, each allocated from its own frame command pool
+    VkCommandPool* frameCommandPools;
+    uint32_t* frameSceneChanges; // SceneChangeFlags since command buffer of given frame was last recorded
+    VkCommandPool commandPool; // used for one-time transfer commands
     VkBuffer vertexBuffer;
     VkDeviceMemory vertexBufferMemory;
+    VkBuffer indexBuffer;
+    VkDeviceMemory indexBufferMemory;
+    uint32_t indexCount;
+    VkIndexType indexType;
+    VkBool32 vertexPulling; // vertex shader reads vertex and index buffer as storage buffers, draws have no vertex input
+    float meshDequantization[4][4]; // mesh vertices are quantized, model matrix has to be multiplied by this
     VkBuffer* uniformBuffers;
     VkDeviceMemory* uniformBufferMemories;
     VkDescriptorPool descriptorPool;
@@ -36,6 +47,33 @@ typedef struct VulkanData {
     VkImageView textureImageView;
     VkSampler textureSampler;
 
+    // Intermediate render targets, recreated with swapchain
+    TransientImagePool* transientImagePool;
+    VkFormat depthFormat;
+    VkImage depthImage;
+    VkImageView depthImageView;
+    VkImage sceneColorImage;
+    VkImageView sceneColorImageView;
+    VkImage postColorImage; // VK_NULL_HANDLE when post pass renders straight into swapchain image (see presentByBlit)
+    VkImageView postColorImageView;
+    VkBool32 postColorAliasesDepth;
+
+    // Post processing
+    VkBool32 presentByBlit; // swapchain images can be blit destination, otherwise post pass renders into them directly
+    VkRenderPass postRenderPass;
+    VkFramebuffer* postFramebuffers; // one per swapchain image
+    VkDescriptorSetLayout postDescriptorSetLayout;
+    VkDescriptorPool postDescriptorPool;
+    VkDescriptorSet postDescriptorSet;
+    VkSampler postSampler;
+    VkPipelineLayout postPipelineLayout;
+    VkPipeline postPipeline;
+
+    // Optional device features
+    VkBool32 graphicsPipelineLibrarySupported;
+    VkBool32 multiviewSupported;
+    uint32_t maxMultiviewViewCount;
+
     // Synchornization primitives
     uint32_t maxFramesInFlight;
     VkSemaphore* imageAvailableSemaphores;
@@ -21,12 +21,15 @@
 #include "vkdebug.h"
 #include "device.h"
 #include "swapchain.h"
+#include "postprocess.h"
 #include "shader.h"
 #include "buffers.h"
 #include "utils.h"
-#include "cube.h"
 #include "pipeline.h"
 #include "texture.h"
+#include "pipelinecompiler.h"
+#include "commands.h"
+#include "thumbnails.h"
 #include "linmath.h"
 
 static const int WINDOW_WIDTH = 1600;
@@ -36,6 +39,12 @@ static const char* requiredInstanceExts[] = {
     VK_KHR_SURFACE_EXTENSION_NAME,
     VK_KHR_XLIB_SURFACE_EXTENSION_NAME,
     VK_EXT_DEBUG_UTILS_EXTENSION_NAME,
+    VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME, // needed for querying graphics pipeline library and multiview support
+};
+// Thumbnails are rendered offscreen and never presented, so no surface extensions (and no X display) are needed
+static const char* offscreenInstanceExts[] = {
+    VK_EXT_DEBUG_UTILS_EXTENSION_NAME,
+    VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME,
 };
 static const char* validationLayerNames[] = {
     "VK_LAYER_KHRONOS_validation"
@@ -44,7 +53,117 @@ static const int MAX_FRAMES_IN_FLIGHT = 2;
 static int currentWindowWidth = WINDOW_WIDTH;
 static int currentWindowHeight = WINDOW_HEIGHT;
 
+// Optimized pipeline is compiled in the background while we render with the fallback one created by
+// createFallbackPipeline(). Once it's ready, we swap pipelines and mark command buffers for re-recording.
+// Fallback pipeline may still be used by frames in flight, so it's only retired here and destroyed later.
+static void onPipelineReady(VulkanData* vkData, uint32_t pipelineId, VkPipeline pipeline, void* userData) {
+    VkPipeline* retiredPipeline = (VkPipeline*) userData;
+    *retiredPipeline = vkData->pipeline;
+    vkData->pipeline = pipeline;
+
+    markSceneChanged(vkData, SCENE_CHANGE_DRAW_LIST);
+
+    LOG3DHW("[main] Switched to optimized pipeline %d", pipelineId);
+}
+
+// Device has to be idle when this is called
+static void destroyRetiredPipeline(VulkanData* vkData, VkPipeline* retiredPipeline) {
+    if (*retiredPipeline != VK_NULL_HANDLE) {
+        vkDestroyPipeline(vkData->device, *retiredPipeline, NULL);
+        *retiredPipeline = VK_NULL_HANDLE;
+    }
+}
+
+static void createInstance(VulkanData* vkData, const char* extensions[], uint32_t extensionCount) {
+    VkResult vkr;
+
+    // Prepare application info
+    VkApplicationInfo appInfo = { 0 };
+    appInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    appInfo.pApplicationName = WINDOW_TITLE;
+    appInfo.applicationVersion = VK_MAKE_VERSION(1, 0, 0);
+    appInfo.pEngineName = "n/a";
+    appInfo.engineVersion = VK_MAKE_VERSION(0, 0, 0);
+    appInfo.apiVersion = VK_API_VERSION_1_0;
+
+    // If we want to debug VkInstance creation, we have to prepare VkDebugUtilsMessengerCreateInfoEXT 
+    // in advance and pass it to pNext of VkInstanceCreateInfo. 
+    VkDebugUtilsMessengerCreateInfoEXT debugUtilsMessengerCreateInfo = { 0 };
+    debugUtilsMessengerCreateInfo.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
+    // Uncomment VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT to enable verbose logging
+    debugUtilsMessengerCreateInfo.messageSeverity =
+        /*VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT |*/ VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    debugUtilsMessengerCreateInfo.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT |
+        VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
+    debugUtilsMessengerCreateInfo.pfnUserCallback = vkDebugCallback3DHW;
+    debugUtilsMessengerCreateInfo.pUserData = NULL;
+
+    // Setup Vulkan instance create info with instance extensions and validation layers we want.
+    VkInstanceCreateInfo createInfo = { 0 };
+    createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    createInfo.pApplicationInfo = &appInfo;
+    createInfo.enabledExtensionCount = extensionCount;
+    createInfo.ppEnabledExtensionNames = extensions;
+    createInfo.enabledLayerCount = 1;
+    createInfo.ppEnabledLayerNames = validationLayerNames;
+    createInfo.pNext = (VkDebugUtilsMessengerCreateInfoEXT*) &debugUtilsMessengerCreateInfo;
+
+    VkInstance instance;
+    if ((vkr = vkCreateInstance(&createInfo, NULL, &instance)) != VK_SUCCESS) {
+        LOG3DHW("[main] Failed creating VkInstance (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    LOG3DHW("[main] Created Vulkan instance");
+    vkData->instance = instance;
+
+    prepareDebug(debugUtilsMessengerCreateInfo, vkData);
+}
+
+// Thumbnails only need the cube, its texture and offscreen targets created by renderThumbnails(), so there is
+// no window, surface, swapchain or render loop - this works without X server
+static void renderThumbnailsOffscreen(VulkanData* vkData, uint32_t thumbnailCount) {
+    createInstance(vkData, offscreenInstanceExts, ARRAY_SIZE(offscreenInstanceExts));
+    pickPhysicalDevice(vkData);
+    createDeviceQueues(vkData, NULL, NULL, validationLayerNames, 1);
+    createDescriptorSetLayout(vkData);
+    loadShaderFromFile("frag.spv", &vkData->fragmentShaderBytes, &vkData->fragmentShaderLength);
+    createCubeMeshBuffers(vkData);
+    createCommandPool(vkData);
+    createTextureImage(vkData, "assets/texture.jpg");
+    createTextureImageView(vkData);
+    createTextureImageSampler(vkData);
+
+    renderThumbnails(vkData, thumbnailCount, "thumbnail");
+
+    cleanup(vkData);
+    vkDestroyInstance(vkData->instance, NULL);
+    LOG3DHW("[main] Destroyed instance");
+}
+
 int main(int argc, char** argv) {
+    VulkanData vkData = { 0 };
+
+    // "--thumbnails [count]" renders the cube from count cameras around it into thumbnail_XX.ppm files and quits,
+    // "--vertex-pulling" draws the cube with vertex shader fetching vertices from storage buffers (main_pull.vert)
+    bool thumbnails = false;
+    uint32_t thumbnailCount = THUMBNAIL_DEFAULT_COUNT;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--thumbnails") == 0) {
+            thumbnails = true;
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                thumbnailCount = (uint32_t) atoi(argv[++i]);
+            }
+        } else if (strcmp(argv[i], "--vertex-pulling") == 0) {
+            vkData.vertexPulling = VK_TRUE;
+        }
+    }
+
+    if (thumbnails) {
+        renderThumbnailsOffscreen(&vkData, thumbnailCount);
+        return EXIT_SUCCESS;
+    }
+
     // Initializing threads may be required on some implementations for Xlib surface.
     // https://www.khronos.org/registry/vulkan/specs/1.3-extensions/html/chap33.html#platformCreateSurface_xlib
     XInitThreads();
@@ -98,64 +217,20 @@ int main(int argc, char** argv) {
     XWindowAttributes windowAttributes;
     XGetWindowAttributes(display, window, &windowAttributes);
 
-    VulkanData vkData = { 0 };
     VkResult vkr; // global var for holding VkResults
-
-    // Prepare application info
-    VkApplicationInfo appInfo = { 0 };
-    appInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
-    appInfo.pApplicationName = WINDOW_TITLE;
-    appInfo.applicationVersion = VK_MAKE_VERSION(1, 0, 0);
-    appInfo.pEngineName = "n/a";
-    appInfo.engineVersion = VK_MAKE_VERSION(0, 0, 0);
-    appInfo.apiVersion = VK_API_VERSION_1_0;
-
-    // If we want to debug VkInstance creation, we have to prepare VkDebugUtilsMessengerCreateInfoEXT 
-    // in advance and pass it to pNext of VkInstanceCreateInfo. 
-    VkDebugUtilsMessengerCreateInfoEXT debugUtilsMessengerCreateInfo = { 0 };
-    debugUtilsMessengerCreateInfo.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
-    // Uncomment VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT to enable verbose logging
-    debugUtilsMessengerCreateInfo.messageSeverity =
-        /*VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT |*/ VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
-    debugUtilsMessengerCreateInfo.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT |
-        VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
-    debugUtilsMessengerCreateInfo.pfnUserCallback = vkDebugCallback3DHW;
-    debugUtilsMessengerCreateInfo.pUserData = NULL;
-
-    // Setup Vulkan instance create info with instance extensions and validation layers we want.
-    VkInstanceCreateInfo createInfo = { 0 };
-    createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
-    createInfo.pApplicationInfo = &appInfo;
-    createInfo.enabledExtensionCount = 3;
-    createInfo.ppEnabledExtensionNames = requiredInstanceExts;
-    createInfo.enabledLayerCount = 1;
-    createInfo.ppEnabledLayerNames = validationLayerNames;
-    createInfo.pNext = (VkDebugUtilsMessengerCreateInfoEXT*) &debugUtilsMessengerCreateInfo;
-
-    VkInstance instance;
-    if ((vkr = vkCreateInstance(&createInfo, NULL, &instance)) != VK_SUCCESS) {
-        LOG3DHW("[main] Failed creating VkInstance (result: %s)!", mapVkResultToString(vkr));
-        exit(-1);
-    }
-
-    LOG3DHW("[main] Created Vulkan instance");
-    vkData.instance = instance;
-
-    prepareDebug(debugUtilsMessengerCreateInfo, &vkData);
+    createInstance(&vkData, requiredInstanceExts, ARRAY_SIZE(requiredInstanceExts));
     pickPhysicalDevice(&vkData);
     createDeviceQueues(&vkData, display, &visualInfo, validationLayerNames, 1);
     createSurface(&vkData, display, window);
     createSwapchainAndImageViews(&vkData, currentWindowWidth, currentWindowHeight);
     createRenderPass(&vkData);
     createDescriptorSetLayout(&vkData);
-    loadShaderFromFile("vert.spv", &vkData.vertexShaderBytes, &vkData.vertexShaderLength);
+    loadShaderFromFile(vkData.vertexPulling ? "vert_pull.spv" : "vert.spv", &vkData.vertexShaderBytes, &vkData.vertexShaderLength);
     loadShaderFromFile("frag.spv", &vkData.fragmentShaderBytes, &vkData.fragmentShaderLength);
-    createGraphicsPipeline(&vkData);
+    createGraphicsPipelineLayout(&vkData);
     createFramebuffers(&vkData);
-    createBuffer(&vkData, sizeof(CUBE_DATA), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, 
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 
-        &vkData.vertexBuffer, &vkData.vertexBufferMemory); // Create vertex buffer & copy vertices
-    copyDataToBuffer(&vkData, vkData.vertexBufferMemory, sizeof(CUBE_DATA), (const float*) CUBE_DATA);
+    createPostProcessing(&vkData);
+    createCubeMeshBuffers(&vkData); // Create vertex & index buffers & copy indexed cube to them
     createUniformBuffers(&vkData);
     createCommandPool(&vkData);
     createTextureImage(&vkData, "assets/texture.jpg");
@@ -163,11 +238,18 @@ int main(int argc, char** argv) {
     createTextureImageSampler(&vkData);
     createDescriptorPool(&vkData);
     createDescriptorSets(&vkData);
-    createCommandBuffers(&vkData);
+    createFrameCommandBuffers(&vkData);
 
     vkData.maxFramesInFlight = MAX_FRAMES_IN_FLIGHT;
     createSynchronizationPrimitives(&vkData);
 
+    PipelineCompiler pipelineCompiler;
+    createPipelineCompiler(&vkData, &pipelineCompiler);
+    PipelineVariant defaultVariant = getDefaultPipelineVariant();
+    VkPipeline retiredPipeline = VK_NULL_HANDLE;
+    createFallbackPipeline(&pipelineCompiler, &defaultVariant, &vkData.pipeline);
+    requestPipeline(&pipelineCompiler, &defaultVariant, onPipelineReady, &retiredPipeline);
+
      // Cube rotation vars
     float rotationAngle = 0.f;
     const float rotationSpeedRadians = (45.f * ((float) M_PI / 180.f)); // rotate by 45 degree / s
@@ -200,6 +282,7 @@ int main(int argc, char** argv) {
 
     XEvent xEvent;
     bool running = true;
+
     LOG3DHW("[main] Starting render loop...");
     while (running) {
         // Update delta time based on last time diff between renders
@@ -240,11 +323,15 @@ int main(int argc, char** argv) {
 
         // Drawing begins here
         if (running) {
+            // Deliver pipelines compiled in the background since last frame
+            pollPipelineCompiler(&pipelineCompiler);
+
             // Preparing model matrix
             mat4x4_identity(uniform.model); // model matrix have to be identity matrix initially
             mat4x4_translate(uniform.model, 0.f, 0.f, -5.f); // apply translation to model matrix; move cube to the back, to be in front of camera
             // apply in-place rotation to model matrix (-rotationAngle, because of flipped Vulkan coordinates compared to OpenGL)
             mat4x4_rotate(uniform.model, uniform.model, 0.7f, 0.2f, -0.8f, -rotationAngle); 
+            mat4x4_mul(uniform.model, (const float (*)[4]) uniform.model, (const float (*)[4]) vkData.meshDequantization); // vertex buffer holds quantized positions
             rotationAngle += (rotationSpeedRadians * deltaTime);
 
             // Preparing perspective matrix
@@ -272,6 +359,9 @@ int main(int argc, char** argv) {
             }
             vkData.imagesInFlight[imageIndex] = vkData.inFlightFences[currentFrame];
 
+            // Command buffer of this image is no longer in flight, so it can be re-recorded if scene has changed
+            updateFrameCommandBuffer(&vkData, imageIndex);
+
             VkSemaphore waitSemaphores[] = {
                 vkData.imageAvailableSemaphores[currentFrame]
             };
@@ -327,13 +417,18 @@ int main(int argc, char** argv) {
                     XGetWindowAttributes(display, window, &windowAttributes);
 
                     vkDeviceWaitIdle(vkData.device);
+                    flushPipelineCompiler(&pipelineCompiler); // pending pipelines reference render pass we're about to destroy
+                    destroyRetiredPipeline(&vkData, &retiredPipeline);
                     cleanupSwapchain(&vkData);
 
                     createSwapchainAndImageViews(&vkData, windowAttributes.width, windowAttributes.height);
                     createRenderPass(&vkData);
-                    createGraphicsPipeline(&vkData);
+                    createGraphicsPipelineLayout(&vkData);
                     createFramebuffers(&vkData);
-                    createCommandBuffers(&vkData);
+                    createPostProcessing(&vkData);
+                    createFrameCommandBuffers(&vkData);
+                    createFallbackPipeline(&pipelineCompiler, &defaultVariant, &vkData.pipeline);
+                    requestPipeline(&pipelineCompiler, &defaultVariant, onPipelineReady, &retiredPipeline);
                 }
             }
 
@@ -343,6 +438,8 @@ int main(int argc, char** argv) {
 
     vkDeviceWaitIdle(vkData.device);
 
+    destroyPipelineCompiler(&pipelineCompiler);
+    destroyRetiredPipeline(&vkData, &retiredPipeline);
     cleanup(&vkData);
 
     XDestroyWindow(display, window);
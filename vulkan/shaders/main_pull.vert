@@ -0,0 +1,31 @@
+#version 450
+
+// Same as main.vert, but without vertex input - vertex is fetched from storage buffers by gl_VertexIndex
+// of non-indexed draw. Buffers are laid out as in createCubeMeshBuffers(): 32 bit indices and 12 byte vertices
+// from initCubeVertexFormat() (snorm16 position padded to 4 components, unorm16 tex coords).
+layout(location = 0) out vec2 fragTexCoords;
+
+layout(binding = 0) uniform UniformBufferObject {
+    mat4 model;
+    mat4 view;
+    mat4 projection;
+} ubo;
+
+layout(std430, binding = 2) readonly buffer Vertices {
+    uint vertexWords[];
+};
+
+layout(std430, binding = 3) readonly buffer Indices {
+    uint indices[];
+};
+
+void main() {
+    uint base = indices[gl_VertexIndex] * 3;
+    vec2 positionXY = unpackSnorm2x16(vertexWords[base]);
+    float positionZ = unpackSnorm2x16(vertexWords[base + 1]).x;
+    vec2 texCoords = unpackUnorm2x16(vertexWords[base + 2]);
+
+    // -texCoords.x; flip horizontally, because tex coords in cube.h are according to OpenGL coordinates system
+    fragTexCoords = vec2(-texCoords.x, texCoords.y);
+    gl_Position = ubo.projection * ubo.view * ubo.model * vec4(positionXY, positionZ, 1.0);
+}
@@ -0,0 +1,11 @@
+#version 450
+
+layout(location = 0) out vec4 outColor;
+
+layout(binding = 0) uniform sampler2D sceneColor;
+
+void main() {
+    // Pass-through; scene color and output have the same size, so each pixel copies its own texel unfiltered.
+    // Effects go here, the rest of the frame (transient images, barriers, present) is already in place for them.
+    outColor = texelFetch(sceneColor, ivec2(gl_FragCoord.xy), 0);
+}
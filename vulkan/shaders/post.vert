@@ -0,0 +1,9 @@
+#version 450
+
+layout(location = 0) out vec2 fragTexCoords;
+
+void main() {
+    // Single triangle covering the whole screen, corners are generated from vertex index (no vertex buffer is bound)
+    fragTexCoords = vec2((gl_VertexIndex << 1) & 2, gl_VertexIndex & 2);
+    gl_Position = vec4(fragTexCoords * 2.0 - 1.0, 0.0, 1.0);
+}
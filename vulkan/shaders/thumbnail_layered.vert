@@ -0,0 +1,26 @@
+#version 450
+
+// Has to match MULTIVIEW_MAX_VIEWS in buffers.h
+#define MAX_VIEWS 8
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec2 inTexCoords;
+
+layout(location = 0) out vec2 fragTexCoords;
+
+layout(binding = 0) uniform MultiviewUniformBufferObject {
+    mat4 model;
+    mat4 view[MAX_VIEWS];
+    mat4 projection[MAX_VIEWS];
+} ubo;
+
+// Fallback without VK_KHR_multiview: each array layer is rendered by its own render pass, view index is pushed before the draw
+layout(push_constant) uniform PushConstants {
+    uint viewIndex;
+} pushConstants;
+
+void main() {
+    // -inTexCoords.x; flip horizontally, because tex coords in cube.h are according to OpenGL coordinates system
+    fragTexCoords = vec2(-inTexCoords.x, inTexCoords.y); 
+    gl_Position = ubo.projection[pushConstants.viewIndex] * ubo.view[pushConstants.viewIndex] * ubo.model * vec4(inPosition, 1.0);
+}
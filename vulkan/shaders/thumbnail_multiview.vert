@@ -0,0 +1,23 @@
+#version 450
+#extension GL_EXT_multiview : require
+
+// Has to match MULTIVIEW_MAX_VIEWS in buffers.h
+#define MAX_VIEWS 8
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec2 inTexCoords;
+
+layout(location = 0) out vec2 fragTexCoords;
+
+layout(binding = 0) uniform MultiviewUniformBufferObject {
+    mat4 model;
+    mat4 view[MAX_VIEWS];
+    mat4 projection[MAX_VIEWS];
+} ubo;
+
+void main() {
+    // -inTexCoords.x; flip horizontally, because tex coords in cube.h are according to OpenGL coordinates system
+    fragTexCoords = vec2(-inTexCoords.x, inTexCoords.y); 
+    // Multiview render pass runs this shader once per view, gl_ViewIndex is the array layer being rendered
+    gl_Position = ubo.projection[gl_ViewIndex] * ubo.view[gl_ViewIndex] * ubo.model * vec4(inPosition, 1.0);
+}
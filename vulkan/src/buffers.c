@@ -7,13 +7,17 @@
 #include "vkdata.h"
 #include "utils.h"
 #include "vkdebug.h"
+#include "texture.h"
+#include "cube.h"
+#include "indexedmesh.h"
 
-// Map used buffer types to string (mapping is incomplete!)
+// Map used buffer types to string, by their most specific usage bit (mapping is incomplete!)
 static inline const char* bufferUsageEnumToString(VkBufferUsageFlags usage) {
-    return usage == VK_BUFFER_USAGE_VERTEX_BUFFER_BIT ? "VK_BUFFER_USAGE_VERTEX_BUFFER_BIT" :
-        usage == VK_BUFFER_USAGE_INDEX_BUFFER_BIT ? "VK_BUFFER_USAGE_INDEX_BUFFER_BIT" :
-        usage == VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT ? "VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT" :
-        usage == VK_BUFFER_USAGE_TRANSFER_SRC_BIT ? "VK_BUFFER_USAGE_TRANSFER_SRC_BIT" :
+    return usage & VK_BUFFER_USAGE_VERTEX_BUFFER_BIT ? "VK_BUFFER_USAGE_VERTEX_BUFFER_BIT" :
+        usage & VK_BUFFER_USAGE_INDEX_BUFFER_BIT ? "VK_BUFFER_USAGE_INDEX_BUFFER_BIT" :
+        usage & VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT ? "VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT" :
+        usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT ? "VK_BUFFER_USAGE_STORAGE_BUFFER_BIT" :
+        usage & VK_BUFFER_USAGE_TRANSFER_SRC_BIT ? "VK_BUFFER_USAGE_TRANSFER_SRC_BIT" :
         "UNKNOWN";
 }
 
@@ -28,6 +32,49 @@ void createUniformBuffers(VulkanData* vkData) {
     }
 }
 
+// Cube's triangle list is welded and reordered for vertex cache, then drawn with vkCmdDrawIndexed().
+// Vertices are quantized (see initCubeVertexFormat()), pipelines take vertex input layout from the same format.
+// Both buffers are storage buffers too (descriptor bindings 2 and 3), so with vertex pulling the vertex shader
+// fetches them itself - indices are then always 32 bit, shader reads them as uint array.
+void createCubeMeshBuffers(VulkanData* vkData) {
+    IndexedMesh mesh;
+    buildIndexedMesh(&mesh, CUBE_DATA, ARRAY_SIZE(CUBE_DATA) / VERTEX_OFFSET, VERTEX_OFFSET);
+
+    VertexFormat format;
+    initCubeVertexFormat(&format);
+    getVertexDequantization(&format, vkData->meshDequantization);
+    if (vkData->vertexPulling && format.stride != 3 * sizeof(uint32_t)) {
+        LOG3DHW("[buffers] Vertex pulling shader decodes 12 byte vertices, but cube vertex format has %d bytes!", format.stride);
+        exit(-1);
+    }
+    VkDeviceSize verticesSize = mesh.vertexCount * format.stride;
+    void* vertices = malloc(verticesSize);
+    encodeVertices(&format, mesh.vertices, mesh.vertexCount, VERTEX_OFFSET, vertices);
+    createBuffer(vkData, verticesSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+        &vkData->vertexBuffer, &vkData->vertexBufferMemory);
+    copyDataToBuffer(vkData, vkData->vertexBufferMemory, verticesSize, vertices);
+    free(vertices);
+
+    uint32_t indexSize = vkData->vertexPulling ? sizeof(uint32_t) : indexedMeshIndexSize(&mesh);
+    VkDeviceSize indicesSize = mesh.indexCount * indexSize;
+    void* indices = malloc(indicesSize);
+    if (vkData->vertexPulling) {
+        memcpy(indices, mesh.indices, indicesSize);
+    } else {
+        writeIndexedMeshIndices(&mesh, indices);
+    }
+    createBuffer(vkData, indicesSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+        &vkData->indexBuffer, &vkData->indexBufferMemory);
+    copyDataToBuffer(vkData, vkData->indexBufferMemory, indicesSize, indices);
+    free(indices);
+
+    vkData->indexCount = mesh.indexCount;
+    vkData->indexType = indexSize == sizeof(uint16_t) ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+    destroyIndexedMesh(&mesh);
+}
+
 void createBuffer(VulkanData* vkData, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags memoryProperties, VkBuffer* buffer, VkDeviceMemory* bufferMemory) {
     VkResult vkr;
     const char* usageStr = bufferUsageEnumToString(usage);
@@ -0,0 +1,197 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <vulkan/vulkan.h>
+
+#include "commands.h"
+#include "vkdata.h"
+#include "rendergraph.h"
+#include "postprocess.h"
+#include "utils.h"
+#include "vkdebug.h"
+
+static void recordMainPass(VulkanData* vkData, VkCommandBuffer commandBuffer, uint32_t imageIndex, void* userData) {
+    VkClearValue clearValues[2] = { 0 };
+    VkClearColorValue clearColorValue = { { (99.f / 255.f), (139.f / 255.f), (235.f / 255.f), 1.f } };
+    clearValues[0].color = clearColorValue;
+    clearValues[1].depthStencil.depth = 1.f;
+
+    VkOffset2D renderAreaOffset = { 0, 0 };
+
+    VkRenderPassBeginInfo renderPassBeginInfo = { 0 };
+    renderPassBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    renderPassBeginInfo.framebuffer = vkData->framebuffers[imageIndex];
+    renderPassBeginInfo.renderPass = vkData->renderPass;
+    renderPassBeginInfo.renderArea.extent = vkData->extent;
+    renderPassBeginInfo.renderArea.offset = renderAreaOffset;
+    renderPassBeginInfo.clearValueCount = ARRAY_SIZE(clearValues);
+    renderPassBeginInfo.pClearValues = clearValues;
+
+    vkCmdBeginRenderPass(commandBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkData->pipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkData->pipelineLayout, 0, 1, &vkData->descriptorSets[imageIndex], 0, NULL);
+
+    // With vertex pulling, gl_VertexIndex of non-indexed draw walks the index buffer bound as storage buffer
+    if (vkData->vertexPulling) {
+        vkCmdDraw(commandBuffer, vkData->indexCount, 1, 0, 0);
+    } else {
+        VkBuffer vertexBuffers[] = {
+            vkData->vertexBuffer
+        };
+        VkDeviceSize bufferOffsets[] = { 0 };
+        vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, bufferOffsets);
+        vkCmdBindIndexBuffer(commandBuffer, vkData->indexBuffer, 0, vkData->indexType);
+
+        vkCmdDrawIndexed(commandBuffer, vkData->indexCount, 1, 0, 0, 0);
+    }
+    vkCmdEndRenderPass(commandBuffer);
+}
+
+static void recordFrameCommandBuffer(VulkanData* vkData, uint32_t imageIndex) {
+    VkResult vkr;
+    VkCommandBuffer commandBuffer = vkData->commandBuffers[imageIndex];
+
+    VkCommandBufferBeginInfo commandBufferBeginInfo = { 0 };
+    commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    if ((vkr = vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo)) != VK_SUCCESS) {
+        LOG3DHW("[commands] Failed beginning command buffer (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    // Frame is described as render graph, which takes care of barriers and layout transitions between passes.
+    // Swapchain image leaves the graph in present layout; host written buffers need no barriers.
+    RenderGraph graph;
+    initRenderGraph(&graph);
+
+    uint32_t swapchainImage = addRenderGraphImage(&graph, "swapchain image", vkData->images[imageIndex], VK_IMAGE_ASPECT_COLOR_BIT,
+        ACCESS_SWAPCHAIN_ACQUIRE, ACCESS_PRESENT);
+    // Transient images are shared by all frames, so they have to wait for the previous frame. When post color
+    // aliases depth, each of them also waits for the last use of the other one (previous user of the memory).
+    uint32_t depthImage = addRenderGraphTransientImage(&graph, "depth", vkData->depthImage, VK_IMAGE_ASPECT_DEPTH_BIT,
+        vkData->postColorAliasesDepth ? ACCESS_TRANSFER_READ : ACCESS_DEPTH_ATTACHMENT_WRITE);
+    uint32_t sceneColorImage = addRenderGraphTransientImage(&graph, "scene color", vkData->sceneColorImage, VK_IMAGE_ASPECT_COLOR_BIT,
+        ACCESS_FRAGMENT_SHADER_READ);
+    uint32_t postColorImage = 0;
+    if (vkData->presentByBlit) {
+        postColorImage = addRenderGraphTransientImage(&graph, "post color", vkData->postColorImage, VK_IMAGE_ASPECT_COLOR_BIT,
+            vkData->postColorAliasesDepth ? ACCESS_DEPTH_ATTACHMENT_WRITE : ACCESS_TRANSFER_READ);
+    }
+    uint32_t textureImage = addRenderGraphImage(&graph, "texture", vkData->textureImage, VK_IMAGE_ASPECT_COLOR_BIT,
+        ACCESS_FRAGMENT_SHADER_READ, ACCESS_NONE);
+    uint32_t vertexBuffer = addRenderGraphBuffer(&graph, "vertex buffer", vkData->vertexBuffer, ACCESS_HOST_WRITE, ACCESS_NONE);
+    uint32_t indexBuffer = addRenderGraphBuffer(&graph, "index buffer", vkData->indexBuffer, ACCESS_HOST_WRITE, ACCESS_NONE);
+    uint32_t uniformBuffer = addRenderGraphBuffer(&graph, "uniform buffer", vkData->uniformBuffers[imageIndex], ACCESS_HOST_WRITE, ACCESS_NONE);
+
+    // Passes are added in FramePass order, which transient image lifetimes are expressed in
+    uint32_t mainPass = addRenderGraphPass(&graph, "main", recordMainPass, NULL);
+    addRenderGraphPassAccess(&graph, mainPass, sceneColorImage, ACCESS_COLOR_ATTACHMENT_WRITE);
+    addRenderGraphPassAccess(&graph, mainPass, depthImage, ACCESS_DEPTH_ATTACHMENT_WRITE);
+    addRenderGraphPassAccess(&graph, mainPass, textureImage, ACCESS_FRAGMENT_SHADER_READ);
+    addRenderGraphPassAccess(&graph, mainPass, vertexBuffer, vkData->vertexPulling ? ACCESS_VERTEX_SHADER_READ : ACCESS_VERTEX_BUFFER_READ);
+    addRenderGraphPassAccess(&graph, mainPass, indexBuffer, vkData->vertexPulling ? ACCESS_VERTEX_SHADER_READ : ACCESS_INDEX_BUFFER_READ);
+    addRenderGraphPassAccess(&graph, mainPass, uniformBuffer, ACCESS_UNIFORM_READ);
+
+    uint32_t postProcessPass = addRenderGraphPass(&graph, "post process", recordPostProcessPass, NULL);
+    addRenderGraphPassAccess(&graph, postProcessPass, sceneColorImage, ACCESS_FRAGMENT_SHADER_READ);
+    if (vkData->presentByBlit) {
+        addRenderGraphPassAccess(&graph, postProcessPass, postColorImage, ACCESS_COLOR_ATTACHMENT_WRITE);
+
+        uint32_t presentPass = addRenderGraphPass(&graph, "present", recordPresentPass, NULL);
+        addRenderGraphPassAccess(&graph, presentPass, postColorImage, ACCESS_TRANSFER_READ);
+        addRenderGraphPassAccess(&graph, presentPass, swapchainImage, ACCESS_TRANSFER_WRITE);
+    } else {
+        addRenderGraphPassAccess(&graph, postProcessPass, swapchainImage, ACCESS_COLOR_ATTACHMENT_WRITE);
+    }
+
+    compileRenderGraph(&graph);
+    executeRenderGraph(vkData, &graph, commandBuffer, imageIndex);
+
+    if ((vkr = vkEndCommandBuffer(commandBuffer)) != VK_SUCCESS) {
+        LOG3DHW("[commands] Failed ending command buffer (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+}
+
+// Every swapchain image gets its own command pool with single command buffer. Resetting the whole pool
+// (instead of individual command buffers) is the cheapest way to recycle command memory, and since each pool
+// is only used by one frame, we can reset it as soon as that frame is no longer in flight.
+void createFrameCommandBuffers(VulkanData* vkData) {
+    VkResult vkr;
+
+    vkData->frameCommandPools = (VkCommandPool*) malloc(vkData->imageCount * sizeof(VkCommandPool));
+    vkData->commandBuffers = (VkCommandBuffer*) malloc(vkData->imageCount * sizeof(VkCommandBuffer));
+    vkData->frameSceneChanges = (SceneChangeFlags*) malloc(vkData->imageCount * sizeof(SceneChangeFlags));
+
+    for (uint32_t i = 0; i < vkData->imageCount; i++) {
+        VkCommandPoolCreateInfo commandPoolCreateInfo = { 0 };
+        commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        commandPoolCreateInfo.queueFamilyIndex = vkData->graphicsQueueFamilyIndex;
+        commandPoolCreateInfo.flags = 0; // no VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, we reset whole pool
+        if ((vkr = vkCreateCommandPool(vkData->device, &commandPoolCreateInfo, NULL, &vkData->frameCommandPools[i])) != VK_SUCCESS) {
+            LOG3DHW("[commands] Failed creating frame command pool (result: %s)!", mapVkResultToString(vkr));
+            exit(-1);
+        }
+
+        VkCommandBufferAllocateInfo commandBufferAllocateInfo = { 0 };
+        commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        commandBufferAllocateInfo.commandPool = vkData->frameCommandPools[i];
+        commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        commandBufferAllocateInfo.commandBufferCount = 1;
+        if ((vkr = vkAllocateCommandBuffers(vkData->device, &commandBufferAllocateInfo, &vkData->commandBuffers[i])) != VK_SUCCESS) {
+            LOG3DHW("[commands] Failed allocating command buffer (result: %s)!", mapVkResultToString(vkr));
+            exit(-1);
+        }
+
+        // Nothing is recorded yet, so command buffers are recorded on first use
+        vkData->frameSceneChanges[i] = SCENE_CHANGE_DRAW_LIST | SCENE_CHANGE_BINDINGS | SCENE_CHANGE_RENDER_TARGETS;
+    }
+
+    LOG3DHW("[commands] Created %d frame command pools and buffers", vkData->imageCount);
+}
+
+// Marks command buffers of all frames as dirty (e.g. when the same pipeline is used by every frame)
+void markSceneChanged(VulkanData* vkData, SceneChangeFlags changes) {
+    for (uint32_t i = 0; i < vkData->imageCount; i++) {
+        vkData->frameSceneChanges[i] |= changes;
+    }
+}
+
+// Marks command buffer of single frame as dirty (e.g. when only its descriptor set or framebuffer changed)
+void markFrameChanged(VulkanData* vkData, uint32_t imageIndex, SceneChangeFlags changes) {
+    vkData->frameSceneChanges[imageIndex] |= changes;
+}
+
+// Re-records command buffer of given frame if anything it depends on has changed, otherwise it's reused as is.
+// Caller has to make sure the command buffer is no longer in flight (wait for imagesInFlight fence first).
+// Returns true if command buffer was re-recorded.
+bool updateFrameCommandBuffer(VulkanData* vkData, uint32_t imageIndex) {
+    VkResult vkr;
+
+    SceneChangeFlags changes = vkData->frameSceneChanges[imageIndex];
+    if (changes == SCENE_CHANGE_NONE) {
+        return false;
+    }
+
+    if ((vkr = vkResetCommandPool(vkData->device, vkData->frameCommandPools[imageIndex], 0)) != VK_SUCCESS) {
+        LOG3DHW("[commands] Failed resetting frame command pool (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    recordFrameCommandBuffer(vkData, imageIndex);
+    vkData->frameSceneChanges[imageIndex] = SCENE_CHANGE_NONE;
+
+    LOG3DHW("[commands] Re-recorded command buffer for image %d (changes: 0x%x)", imageIndex, changes);
+
+    return true;
+}
+
+void destroyFrameCommandBuffers(VulkanData* vkData) {
+    // Destroying the pool frees all command buffers allocated from it
+    for (uint32_t i = 0; i < vkData->imageCount; i++) {
+        vkDestroyCommandPool(vkData->device, vkData->frameCommandPools[i], NULL);
+    }
+
+    free(vkData->frameCommandPools);
+    free(vkData->commandBuffers);
+    free(vkData->frameSceneChanges);
+}
@@ -26,6 +26,23 @@ VkBool32 checkPresentationSupport(VulkanData* vkData, int queueFamilyIndex, Disp
 }
 #endif
 
+static VkFormat findDepthFormat(VulkanData* vkData) {
+    VkFormat candidates[] = {
+        VK_FORMAT_D32_SFLOAT, VK_FORMAT_D24_UNORM_S8_UINT, VK_FORMAT_D32_SFLOAT_S8_UINT
+    };
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(candidates); i++) {
+        VkFormatProperties formatProperties;
+        vkGetPhysicalDeviceFormatProperties(vkData->physicalDevice, candidates[i], &formatProperties);
+        if (formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT) {
+            return candidates[i];
+        }
+    }
+
+    LOG3DHW("[device] Suitable depth format not found!");
+    exit(-1);
+}
+
 void pickPhysicalDevice(VulkanData* vkData) {
     uint32_t physicalDevicesCount = 0;
     vkEnumeratePhysicalDevices(vkData->instance, &physicalDevicesCount, NULL);
@@ -48,6 +65,8 @@ void pickPhysicalDevice(VulkanData* vkData) {
         uint32_t deviceExtensionsCount;
         vkEnumerateDeviceExtensionProperties(physicalDevices[i], NULL, &deviceExtensionsCount, NULL);
         bool swapchainSupported = false;
+        uint32_t pipelineLibraryExtsFound = 0;
+        uint32_t multiviewExtsFound = 0;
         if (deviceExtensionsCount > 0) {
             VkExtensionProperties* deviceExtensionProps = (VkExtensionProperties*) malloc(deviceExtensionsCount * sizeof(VkExtensionProperties));
             vkEnumerateDeviceExtensionProperties(physicalDevices[i], NULL, &deviceExtensionsCount, deviceExtensionProps);
@@ -56,6 +75,18 @@ void pickPhysicalDevice(VulkanData* vkData) {
                 if (strncmp(requiredDeviceExts[0], deviceExtensionProps[i].extensionName, strlen(requiredDeviceExts[0])) == 0) {
                     swapchainSupported = true;
                 }
+
+                for (uint32_t j = 0; j < ARRAY_SIZE(graphicsPipelineLibraryDeviceExts); j++) {
+                    if (strcmp(graphicsPipelineLibraryDeviceExts[j], deviceExtensionProps[i].extensionName) == 0) {
+                        pipelineLibraryExtsFound++;
+                    }
+                }
+
+                for (uint32_t j = 0; j < ARRAY_SIZE(multiviewDeviceExts); j++) {
+                    if (strcmp(multiviewDeviceExts[j], deviceExtensionProps[i].extensionName) == 0) {
+                        multiviewExtsFound++;
+                    }
+                }
             }
 
             free(deviceExtensionProps);
@@ -67,6 +98,8 @@ void pickPhysicalDevice(VulkanData* vkData) {
         // we only check if device is discrete GPU and has swapchain support.
         if (props.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU && swapchainSupported) {
             suitableDeviceIndex = i;
+            vkData->graphicsPipelineLibrarySupported = pipelineLibraryExtsFound == ARRAY_SIZE(graphicsPipelineLibraryDeviceExts);
+            vkData->multiviewSupported = multiviewExtsFound == ARRAY_SIZE(multiviewDeviceExts);
             break;
         }
     }
@@ -80,6 +113,62 @@ void pickPhysicalDevice(VulkanData* vkData) {
 
     vkData->physicalDevice = physicalDevices[suitableDeviceIndex];
 
+    // Having extensions present is not enough, we also have to check if graphicsPipelineLibrary and multiview features
+    // are available. Querying extension features requires vkGetPhysicalDeviceFeatures2KHR (VK_KHR_get_physical_device_properties2).
+    if (vkData->graphicsPipelineLibrarySupported || vkData->multiviewSupported) {
+        PFN_vkGetPhysicalDeviceFeatures2KHR vkGetPhysicalDeviceFeatures2KHR =
+            (PFN_vkGetPhysicalDeviceFeatures2KHR) vkGetInstanceProcAddr(vkData->instance, "vkGetPhysicalDeviceFeatures2KHR");
+        PFN_vkGetPhysicalDeviceProperties2KHR vkGetPhysicalDeviceProperties2KHR =
+            (PFN_vkGetPhysicalDeviceProperties2KHR) vkGetInstanceProcAddr(vkData->instance, "vkGetPhysicalDeviceProperties2KHR");
+
+        VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT pipelineLibraryFeatures = { 0 };
+        pipelineLibraryFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+
+        VkPhysicalDeviceMultiviewFeaturesKHR multiviewFeatures = { 0 };
+        multiviewFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES_KHR;
+
+        // Only structures of extensions supported by the device may be chained
+        VkPhysicalDeviceFeatures2KHR features2 = { 0 };
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+        if (vkData->graphicsPipelineLibrarySupported) {
+            pipelineLibraryFeatures.pNext = features2.pNext;
+            features2.pNext = &pipelineLibraryFeatures;
+        }
+        if (vkData->multiviewSupported) {
+            multiviewFeatures.pNext = features2.pNext;
+            features2.pNext = &multiviewFeatures;
+        }
+
+        if (vkGetPhysicalDeviceFeatures2KHR != NULL) {
+            vkGetPhysicalDeviceFeatures2KHR(vkData->physicalDevice, &features2);
+        }
+
+        vkData->graphicsPipelineLibrarySupported = pipelineLibraryFeatures.graphicsPipelineLibrary;
+        vkData->multiviewSupported = multiviewFeatures.multiview;
+
+        // Number of views rendered by single multiview render pass is limited by the device (at least 6)
+        if (vkData->multiviewSupported && vkGetPhysicalDeviceProperties2KHR != NULL) {
+            VkPhysicalDeviceMultiviewPropertiesKHR multiviewProperties = { 0 };
+            multiviewProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES_KHR;
+
+            VkPhysicalDeviceProperties2KHR properties2 = { 0 };
+            properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR;
+            properties2.pNext = &multiviewProperties;
+
+            vkGetPhysicalDeviceProperties2KHR(vkData->physicalDevice, &properties2);
+
+            vkData->maxMultiviewViewCount = multiviewProperties.maxMultiviewViewCount;
+        } else {
+            vkData->multiviewSupported = VK_FALSE;
+        }
+    }
+
+    LOG3DHW("[device] Graphics pipeline library support: %s", vkData->graphicsPipelineLibrarySupported ? "yes" : "no");
+    LOG3DHW("[device] Multiview support: %s (max views: %d)", vkData->multiviewSupported ? "yes" : "no", vkData->maxMultiviewViewCount);
+
+    // Depth format only depends on the device, so it's known before any render target (swapchain or offscreen) exists
+    vkData->depthFormat = findDepthFormat(vkData);
+
     free(physicalDevices);
 }
 
@@ -88,6 +177,13 @@ void createDeviceQueues(VulkanData* vkData, const char* validationLayerNames[],
 #else
 void createDeviceQueues(VulkanData* vkData, Display* display, XVisualInfo* visualInfo, const char* validationLayerNames[], int validationLayerCount) {
 #endif
+    // Without display (Linux only) device is used for offscreen rendering; no presentation queue and no swapchain
+#ifdef _WIN32
+    bool presenting = true;
+#else
+    bool presenting = display != NULL;
+#endif
+
     uint32_t queueFamilyCount = 0;
     VkQueueFamilyProperties queueFamilyProps = { 0 };
     vkGetPhysicalDeviceQueueFamilyProperties(vkData->physicalDevice, &queueFamilyCount, NULL);
@@ -116,12 +212,17 @@ void createDeviceQueues(VulkanData* vkData, Display* display, XVisualInfo* visua
 #ifdef _WIN32
         VkBool32 supportsPresentation = checkPresentationSupport(vkData, i);
 #else
-        VkBool32 supportsPresentation = checkPresentationSupport(vkData, i, display, visualInfo);
+        VkBool32 supportsPresentation = presenting && checkPresentationSupport(vkData, i, display, visualInfo);
 #endif
         if ((presentQueueFamilyIndex < 0) && supportsPresentation) {
             presentQueueFamilyIndex = i;
         }
     }   
+
+    // Offscreen only device never presents, present queue is just an alias of the graphics one
+    if (!presenting) {
+        presentQueueFamilyIndex = graphicsQueueFamilyIndex;
+    }
     
     if (graphicsQueueFamilyIndex < 0 || presentQueueFamilyIndex < 0) {
         LOG3DHW("[device] No suitable queue families for graphics and/or presentation found!");
@@ -141,6 +242,41 @@ void createDeviceQueues(VulkanData* vkData, Display* display, XVisualInfo* visua
     // We currently don't need any physical device features (like geometry shader support)
     VkPhysicalDeviceFeatures physicalDeviceFeatures = { 0 };
 
+    // Required extensions are always enabled, optional ones only when supported by selected physical device
+    const char* enabledDeviceExts[ARRAY_SIZE(requiredDeviceExts) + ARRAY_SIZE(graphicsPipelineLibraryDeviceExts) + ARRAY_SIZE(multiviewDeviceExts)];
+    uint32_t enabledDeviceExtsCount = 0;
+    // Swapchain extension depends on surface instance extensions, which offscreen only instance doesn't enable
+    for (uint32_t i = 0; presenting && i < ARRAY_SIZE(requiredDeviceExts); i++) {
+        enabledDeviceExts[enabledDeviceExtsCount++] = requiredDeviceExts[i];
+    }
+
+    // Features of optional extensions are chained to device create info
+    void* deviceCreateInfoNext = NULL;
+
+    VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT pipelineLibraryFeatures = { 0 };
+    pipelineLibraryFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+    pipelineLibraryFeatures.graphicsPipelineLibrary = VK_TRUE;
+    if (vkData->graphicsPipelineLibrarySupported) {
+        for (uint32_t i = 0; i < ARRAY_SIZE(graphicsPipelineLibraryDeviceExts); i++) {
+            enabledDeviceExts[enabledDeviceExtsCount++] = graphicsPipelineLibraryDeviceExts[i];
+        }
+
+        pipelineLibraryFeatures.pNext = deviceCreateInfoNext;
+        deviceCreateInfoNext = &pipelineLibraryFeatures;
+    }
+
+    VkPhysicalDeviceMultiviewFeaturesKHR multiviewFeatures = { 0 };
+    multiviewFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES_KHR;
+    multiviewFeatures.multiview = VK_TRUE;
+    if (vkData->multiviewSupported) {
+        for (uint32_t i = 0; i < ARRAY_SIZE(multiviewDeviceExts); i++) {
+            enabledDeviceExts[enabledDeviceExtsCount++] = multiviewDeviceExts[i];
+        }
+
+        multiviewFeatures.pNext = deviceCreateInfoNext;
+        deviceCreateInfoNext = &multiviewFeatures;
+    }
+
     // Fill logical device create info, passing information of device queues, validation layers, and device extensions,
     // then create logical device.
     VkDeviceCreateInfo deviceCreateInfo = { 0 };
@@ -150,8 +286,9 @@ void createDeviceQueues(VulkanData* vkData, Display* display, XVisualInfo* visua
     deviceCreateInfo.pEnabledFeatures = &physicalDeviceFeatures;
     deviceCreateInfo.enabledLayerCount = validationLayerCount;
     deviceCreateInfo.ppEnabledLayerNames = validationLayerNames;
-    deviceCreateInfo.ppEnabledExtensionNames = requiredDeviceExts;
-    deviceCreateInfo.enabledExtensionCount = 1;
+    deviceCreateInfo.ppEnabledExtensionNames = enabledDeviceExts;
+    deviceCreateInfo.enabledExtensionCount = enabledDeviceExtsCount;
+    deviceCreateInfo.pNext = deviceCreateInfoNext;
 
     VkDevice device;
     VkResult vkr;
@@ -214,23 +351,29 @@ void createSynchronizationPrimitives(VulkanData* vkData) {
     LOG3DHW("[device] Created synchronization primitives");   
 }
 
-// Utility method for finding appropriate memory for given filter and properties
-uint32_t findMemoryIndex(VulkanData* vkData, uint32_t typeFilter, VkMemoryPropertyFlags requiredMemPropertyFlags) {
+// Utility method for finding appropriate memory for given filter and properties.
+// Returns false if there is no such memory, so caller can fall back to other properties.
+bool tryFindMemoryIndex(VulkanData* vkData, uint32_t typeFilter, VkMemoryPropertyFlags requiredMemPropertyFlags, uint32_t* memoryIndex) {
     VkPhysicalDeviceMemoryProperties physicalDeviceMemProperties;
     vkGetPhysicalDeviceMemoryProperties(vkData->physicalDevice, &physicalDeviceMemProperties);
 
-    int suitableMemoryIndex = -1;
     for (uint32_t i = 0; i < physicalDeviceMemProperties.memoryTypeCount; i++) {
         if ((typeFilter & (1 << i)) && ((physicalDeviceMemProperties.memoryTypes[i].propertyFlags & requiredMemPropertyFlags) == requiredMemPropertyFlags)) {
-            suitableMemoryIndex = i;
-            break;
+            *memoryIndex = i;
+            return true;
         }
     }
 
-    if (suitableMemoryIndex < 0) {
+    return false;
+}
+
+// Same as tryFindMemoryIndex(), but memory is required
+uint32_t findMemoryIndex(VulkanData* vkData, uint32_t typeFilter, VkMemoryPropertyFlags requiredMemPropertyFlags) {
+    uint32_t suitableMemoryIndex;
+    if (!tryFindMemoryIndex(vkData, typeFilter, requiredMemPropertyFlags, &suitableMemoryIndex)) {
         LOG3DHW("[device] Suitable memory not found!");
         exit(-1);
     }
 
-    return (uint32_t) suitableMemoryIndex;
+    return suitableMemoryIndex;
 }
\ No newline at end of file
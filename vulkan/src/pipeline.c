@@ -1,9 +1,12 @@
 #include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
 #include <vulkan/vulkan.h>
 
 #include "pipeline.h"
 #include "vkdata.h"
 #include "shader.h"
+#include "postprocess.h"
 #include "buffers.h"
 #include "cube.h"
 #include "utils.h"
@@ -26,13 +29,24 @@ void createDescriptorSetLayout(VulkanData* vkData) {
     samplerLayoutBinding.pImmutableSamplers = NULL;
     samplerLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
 
+    // Vertex and index buffer, read by vertex shader when vertices are pulled (see main_pull.vert)
+    VkDescriptorSetLayoutBinding vertexStorageLayoutBinding = { 0 };
+    vertexStorageLayoutBinding.binding = 2;
+    vertexStorageLayoutBinding.descriptorCount = 1;
+    vertexStorageLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    vertexStorageLayoutBinding.pImmutableSamplers = NULL;
+    vertexStorageLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+    VkDescriptorSetLayoutBinding indexStorageLayoutBinding = vertexStorageLayoutBinding;
+    indexStorageLayoutBinding.binding = 3;
+
     VkDescriptorSetLayoutBinding bindings[] = {
-        uboLayoutBinding, samplerLayoutBinding
+        uboLayoutBinding, samplerLayoutBinding, vertexStorageLayoutBinding, indexStorageLayoutBinding
     };
 
     VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = { 0 };
     descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    descriptorSetLayoutCreateInfo.bindingCount = 2;
+    descriptorSetLayoutCreateInfo.bindingCount = ARRAY_SIZE(bindings);
     descriptorSetLayoutCreateInfo.pBindings = bindings;
 
     if ((vkr = vkCreateDescriptorSetLayout(vkData->device, &descriptorSetLayoutCreateInfo, NULL, &vkData->descriptorSetLayout)) != VK_SUCCESS) {
@@ -41,12 +55,66 @@ void createDescriptorSetLayout(VulkanData* vkData) {
     }
 }
 
-void createGraphicsPipeline(VulkanData* vkData) {
-    VkResult vkr;
-    VkShaderModule vertexShaderModule;
-    VkShaderModule fragmentShaderModule;
-    createShaderModules(vkData, &vertexShaderModule, &fragmentShaderModule);
+static VkFormat vertexAttributeVkFormat(const VertexAttribute* attribute) {
+    static const VkFormat FLOAT32_FORMATS[4] = {
+        VK_FORMAT_R32_SFLOAT, VK_FORMAT_R32G32_SFLOAT, VK_FORMAT_R32G32B32_SFLOAT, VK_FORMAT_R32G32B32A32_SFLOAT
+    };
+    static const VkFormat HALF_FLOAT_FORMATS[4] = {
+        VK_FORMAT_R16_SFLOAT, VK_FORMAT_R16G16_SFLOAT, VK_FORMAT_R16G16B16_SFLOAT, VK_FORMAT_R16G16B16A16_SFLOAT
+    };
+    static const VkFormat SNORM16_FORMATS[4] = {
+        VK_FORMAT_R16_SNORM, VK_FORMAT_R16G16_SNORM, VK_FORMAT_R16G16B16_SNORM, VK_FORMAT_R16G16B16A16_SNORM
+    };
+    static const VkFormat UNORM16_FORMATS[4] = {
+        VK_FORMAT_R16_UNORM, VK_FORMAT_R16G16_UNORM, VK_FORMAT_R16G16B16_UNORM, VK_FORMAT_R16G16B16A16_UNORM
+    };
+
+    uint32_t component = vertexAttributeStoredComponents(attribute) - 1;
+    switch (attribute->encoding) {
+        case VERTEX_ENCODING_FLOAT32: return FLOAT32_FORMATS[component];
+        case VERTEX_ENCODING_HALF_FLOAT: return HALF_FLOAT_FORMATS[component];
+        case VERTEX_ENCODING_UNORM16: return UNORM16_FORMATS[component];
+        default: return SNORM16_FORMATS[component]; // snorm16 and octahedral
+    }
+}
+
+// Single interleaved binding, attributes with more components than shader inputs are fine (extra ones are dropped)
+static void fillVertexInputDescriptions(const VertexFormat* format, VkVertexInputBindingDescription* bindingDescription,
+    VkVertexInputAttributeDescription* attributeDescriptions) {
+    memset(bindingDescription, 0, sizeof(VkVertexInputBindingDescription));
+    bindingDescription->binding = 0;
+    bindingDescription->stride = format->stride;
+    bindingDescription->inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+
+    for (uint32_t i = 0; i < format->attributeCount; i++) {
+        memset(&attributeDescriptions[i], 0, sizeof(VkVertexInputAttributeDescription));
+        attributeDescriptions[i].binding = 0;
+        attributeDescriptions[i].location = format->attributes[i].location;
+        attributeDescriptions[i].offset = format->attributes[i].offset;
+        attributeDescriptions[i].format = vertexAttributeVkFormat(&format->attributes[i]);
+    }
+}
 
+// All fixed-function and shader stage state of our graphics pipeline. Create infos point to other members
+// of this struct, so it has to stay in place (not be copied) after being filled by fillGraphicsPipelineState().
+typedef struct GraphicsPipelineState {
+    VkPipelineShaderStageCreateInfo shaderStages[2];
+    VkVertexInputBindingDescription bindingDescription;
+    VkVertexInputAttributeDescription vertexAttributeDescriptions[VERTEX_FORMAT_MAX_ATTRIBUTES];
+    VkPipelineVertexInputStateCreateInfo vertexInputState;
+    VkPipelineInputAssemblyStateCreateInfo inputAssemblyState;
+    VkViewport viewport;
+    VkRect2D scissor;
+    VkPipelineViewportStateCreateInfo viewportState;
+    VkPipelineRasterizationStateCreateInfo rasterizationState;
+    VkPipelineMultisampleStateCreateInfo multisampleState;
+    VkPipelineDepthStencilStateCreateInfo depthStencilState;
+    VkPipelineColorBlendAttachmentState colorBlendAttachmentState;
+    VkPipelineColorBlendStateCreateInfo colorBlendState;
+} GraphicsPipelineState;
+
+static void fillGraphicsPipelineState(VkExtent2D extent, const PipelineVariant* variant, VkShaderModule vertexShaderModule, 
+    VkShaderModule fragmentShaderModule, GraphicsPipelineState* state) {
     VkPipelineShaderStageCreateInfo vertexShaderStageCreateInfo = { 0 };
     vertexShaderStageCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
     vertexShaderStageCreateInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
@@ -59,77 +127,76 @@ void createGraphicsPipeline(VulkanData* vkData) {
     fragmentShaderStageCreateInfo.module = fragmentShaderModule;
     fragmentShaderStageCreateInfo.pName = "main";
 
-    VkPipelineShaderStageCreateInfo shaderStages[] = {
-        vertexShaderStageCreateInfo, fragmentShaderStageCreateInfo
-    };
+    state->shaderStages[0] = vertexShaderStageCreateInfo;
+    state->shaderStages[1] = fragmentShaderStageCreateInfo;
 
-    VkVertexInputBindingDescription bindingDescription = { 0 };
-    bindingDescription.binding = 0;
-    bindingDescription.stride = VERTEX_OFFSET * sizeof(float);
-    bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-
-    VkVertexInputAttributeDescription vertexAttributeDescPosition = { 0 };
-    vertexAttributeDescPosition.binding = 0;
-    vertexAttributeDescPosition.location = 0;
-    vertexAttributeDescPosition.offset = 0;
-    vertexAttributeDescPosition.format = VK_FORMAT_R32G32B32_SFLOAT;
-
-    VkVertexInputAttributeDescription vertexAttributeDescTexCoords = { 0 };
-    vertexAttributeDescTexCoords.binding = 0;
-    vertexAttributeDescTexCoords.location = 1;
-    vertexAttributeDescTexCoords.offset = TEX_COORDS_OFFSET * sizeof(float);
-    vertexAttributeDescTexCoords.format = VK_FORMAT_R32G32_SFLOAT;
-
-    VkVertexInputAttributeDescription vertexAttributeDescriptions[] = {
-        vertexAttributeDescPosition, vertexAttributeDescTexCoords
-    };
+    // Vertex buffer holds quantized cube vertices (see createCubeMeshBuffers())
+    VertexFormat vertexFormat;
+    initCubeVertexFormat(&vertexFormat);
+    fillVertexInputDescriptions(&vertexFormat, &state->bindingDescription, state->vertexAttributeDescriptions);
 
     VkPipelineVertexInputStateCreateInfo vertexInputStateCreateInfo = { 0 };
     vertexInputStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
     vertexInputStateCreateInfo.vertexBindingDescriptionCount = 1;
-    vertexInputStateCreateInfo.pVertexBindingDescriptions = &bindingDescription;
-    vertexInputStateCreateInfo.vertexAttributeDescriptionCount = 2;
-    vertexInputStateCreateInfo.pVertexAttributeDescriptions = vertexAttributeDescriptions;
+    vertexInputStateCreateInfo.pVertexBindingDescriptions = &state->bindingDescription;
+    vertexInputStateCreateInfo.vertexAttributeDescriptionCount = vertexFormat.attributeCount;
+    vertexInputStateCreateInfo.pVertexAttributeDescriptions = state->vertexAttributeDescriptions;
+    state->vertexInputState = vertexInputStateCreateInfo;
 
     VkPipelineInputAssemblyStateCreateInfo inputAssemblyStateCreateInfo = { 0 };
     inputAssemblyStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
     inputAssemblyStateCreateInfo.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
     inputAssemblyStateCreateInfo.primitiveRestartEnable = VK_FALSE;
+    state->inputAssemblyState = inputAssemblyStateCreateInfo;
 
     VkViewport viewport = { 0 };
     viewport.x = 0.f;
     viewport.y = 0.f;
-    viewport.width = (float) vkData->extent.width;
-    viewport.height = (float) vkData->extent.height;
+    viewport.width = (float) extent.width;
+    viewport.height = (float) extent.height;
     viewport.minDepth = 0.f;
     viewport.maxDepth = 1.f;
+    state->viewport = viewport;
 
     VkOffset2D scissorOffset = { .x = 0, .y = 0 };
     VkRect2D scissor = { 0 };
     scissor.offset = scissorOffset;
-    scissor.extent = vkData->extent;
+    scissor.extent = extent;
+    state->scissor = scissor;
 
     VkPipelineViewportStateCreateInfo viewportStateCreateInfo = { 0 };
     viewportStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
     viewportStateCreateInfo.scissorCount = 1;
-    viewportStateCreateInfo.pScissors = &scissor;
+    viewportStateCreateInfo.pScissors = &state->scissor;
     viewportStateCreateInfo.viewportCount = 1;
-    viewportStateCreateInfo.pViewports = &viewport;
+    viewportStateCreateInfo.pViewports = &state->viewport;
+    state->viewportState = viewportStateCreateInfo;
 
     VkPipelineRasterizationStateCreateInfo rasterizationStateCreateInfo = { 0 };
     rasterizationStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
     rasterizationStateCreateInfo.depthClampEnable = VK_FALSE;
     rasterizationStateCreateInfo.rasterizerDiscardEnable = VK_FALSE;
-    rasterizationStateCreateInfo.polygonMode = VK_POLYGON_MODE_FILL;
-    rasterizationStateCreateInfo.cullMode = VK_CULL_MODE_BACK_BIT;
+    rasterizationStateCreateInfo.polygonMode = variant->polygonMode;
+    rasterizationStateCreateInfo.cullMode = variant->cullMode;
     rasterizationStateCreateInfo.frontFace = VK_FRONT_FACE_CLOCKWISE;
     rasterizationStateCreateInfo.depthBiasEnable = VK_FALSE;
     rasterizationStateCreateInfo.lineWidth = 1.0f;
+    state->rasterizationState = rasterizationStateCreateInfo;
 
     VkPipelineMultisampleStateCreateInfo multisampleStateCreateInfo = { 0 };
     multisampleStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
     multisampleStateCreateInfo.sampleShadingEnable = VK_FALSE;
     multisampleStateCreateInfo.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    state->multisampleState = multisampleStateCreateInfo;
+
+    VkPipelineDepthStencilStateCreateInfo depthStencilStateCreateInfo = { 0 };
+    depthStencilStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depthStencilStateCreateInfo.depthTestEnable = VK_TRUE;
+    depthStencilStateCreateInfo.depthWriteEnable = VK_TRUE;
+    depthStencilStateCreateInfo.depthCompareOp = VK_COMPARE_OP_LESS;
+    depthStencilStateCreateInfo.depthBoundsTestEnable = VK_FALSE;
+    depthStencilStateCreateInfo.stencilTestEnable = VK_FALSE;
+    state->depthStencilState = depthStencilStateCreateInfo;
 
     VkPipelineColorBlendAttachmentState colorBlendAttachmentState = { 0 };
     colorBlendAttachmentState.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
@@ -140,21 +207,40 @@ void createGraphicsPipeline(VulkanData* vkData) {
     colorBlendAttachmentState.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
     colorBlendAttachmentState.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
     colorBlendAttachmentState.alphaBlendOp = VK_BLEND_OP_ADD;
+    state->colorBlendAttachmentState = colorBlendAttachmentState;
 
     VkPipelineColorBlendStateCreateInfo colorBlendStateCreateInfo = { 0 };
     colorBlendStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
     colorBlendStateCreateInfo.logicOpEnable = VK_FALSE;
     colorBlendStateCreateInfo.attachmentCount = 1;
-    colorBlendStateCreateInfo.pAttachments = &colorBlendAttachmentState;
+    colorBlendStateCreateInfo.pAttachments = &state->colorBlendAttachmentState;
+    state->colorBlendState = colorBlendStateCreateInfo;
+}
 
-    VkDynamicState dynamicStates[] = {
-        VK_DYNAMIC_STATE_VIEWPORT
-    };
+PipelineVariant getDefaultPipelineVariant() {
+    PipelineVariant variant = { 0 };
+    variant.polygonMode = VK_POLYGON_MODE_FILL;
+    variant.cullMode = VK_CULL_MODE_BACK_BIT;
+    variant.flags = 0;
 
-    VkPipelineDynamicStateCreateInfo dynamicStateCreateInfo = { 0 };
-    dynamicStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
-    dynamicStateCreateInfo.dynamicStateCount = 1;
-    dynamicStateCreateInfo.pDynamicStates = dynamicStates;
+    return variant;
+}
+
+// Pipelines themselves are created by pipeline compiler (see createFallbackPipeline() and requestPipeline())
+void createGraphicsPipelineLayout(VulkanData* vkData) {
+    VkResult vkr;
+
+    // Pipeline cache outlives swapchain recreation, so we only create it once
+    if (vkData->pipelineCache == VK_NULL_HANDLE) {
+        VkPipelineCacheCreateInfo pipelineCacheCreateInfo = { 0 };
+        pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        if ((vkr = vkCreatePipelineCache(vkData->device, &pipelineCacheCreateInfo, NULL, &vkData->pipelineCache)) != VK_SUCCESS) {
+            LOG3DHW("[pipeline] Failed creating pipeline cache (result: %s)!", mapVkResultToString(vkr));
+            exit(-1);
+        }
+
+        LOG3DHW("[pipeline] Created pipeline cache");
+    }
 
     VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo = { 0 };
     pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
@@ -169,77 +255,249 @@ void createGraphicsPipeline(VulkanData* vkData) {
 
     LOG3DHW("[pipeline] Created pipeline layout");
 
+    vkData->pipelineLayout = pipelineLayout;
+}
+
+// Creates complete pipeline from filled state, everything that differs between our pipelines
+// (state tweaks aside) is given here. Without vertex input, vertex shader generates or fetches vertices itself.
+static VkResult createPipelineFromState(VulkanData* vkData, GraphicsPipelineState* state, VkPipelineCreateFlags flags,
+    VkPipelineLayout pipelineLayout, VkRenderPass renderPass, bool vertexInput, VkPipeline* pipeline) {
+    if (!vertexInput) {
+        state->vertexInputState.vertexBindingDescriptionCount = 0;
+        state->vertexInputState.vertexAttributeDescriptionCount = 0;
+    }
+
     VkGraphicsPipelineCreateInfo graphicsPipelineCreateInfo = { 0 };
     graphicsPipelineCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    graphicsPipelineCreateInfo.flags = flags;
     graphicsPipelineCreateInfo.stageCount = 2;
-    graphicsPipelineCreateInfo.pStages = shaderStages;
-    graphicsPipelineCreateInfo.pVertexInputState = &vertexInputStateCreateInfo;
-    graphicsPipelineCreateInfo.pInputAssemblyState = &inputAssemblyStateCreateInfo;
-    graphicsPipelineCreateInfo.pViewportState = &viewportStateCreateInfo;
-    graphicsPipelineCreateInfo.pRasterizationState = &rasterizationStateCreateInfo;
-    graphicsPipelineCreateInfo.pMultisampleState = &multisampleStateCreateInfo;
-    graphicsPipelineCreateInfo.pDepthStencilState = NULL;
-    graphicsPipelineCreateInfo.pColorBlendState = &colorBlendStateCreateInfo;
+    graphicsPipelineCreateInfo.pStages = state->shaderStages;
+    graphicsPipelineCreateInfo.pVertexInputState = &state->vertexInputState;
+    graphicsPipelineCreateInfo.pInputAssemblyState = &state->inputAssemblyState;
+    graphicsPipelineCreateInfo.pViewportState = &state->viewportState;
+    graphicsPipelineCreateInfo.pRasterizationState = &state->rasterizationState;
+    graphicsPipelineCreateInfo.pMultisampleState = &state->multisampleState;
+    graphicsPipelineCreateInfo.pDepthStencilState = &state->depthStencilState;
+    graphicsPipelineCreateInfo.pColorBlendState = &state->colorBlendState;
     graphicsPipelineCreateInfo.pDynamicState = NULL;
     graphicsPipelineCreateInfo.layout = pipelineLayout;
-    graphicsPipelineCreateInfo.renderPass = vkData->renderPass;
+    graphicsPipelineCreateInfo.renderPass = renderPass;
     graphicsPipelineCreateInfo.subpass = 0;
     graphicsPipelineCreateInfo.basePipelineHandle = VK_NULL_HANDLE;
     graphicsPipelineCreateInfo.basePipelineIndex = -1;
 
-    VkPipeline pipeline;
-    if ((vkr != vkCreateGraphicsPipelines(vkData->device, VK_NULL_HANDLE, 1, &graphicsPipelineCreateInfo, NULL, &pipeline)) != VK_SUCCESS) {
+    return vkCreateGraphicsPipelines(vkData->device, vkData->pipelineCache, 1, &graphicsPipelineCreateInfo, NULL, pipeline);
+}
+
+// Note: this function can be called from pipeline compiler worker threads, so it must only read from vkData
+void createGraphicsPipelineVariant(VulkanData* vkData, const PipelineVariant* variant, VkPipeline* pipeline) {
+    VkResult vkr;
+    VkShaderModule vertexShaderModule;
+    VkShaderModule fragmentShaderModule;
+    createShaderModules(vkData, &vertexShaderModule, &fragmentShaderModule);
+
+    GraphicsPipelineState state;
+    fillGraphicsPipelineState(vkData->extent, variant, vertexShaderModule, fragmentShaderModule, &state);
+    // Pulling vertex shader fetches vertices by gl_VertexIndex itself, there is nothing for vertex input to do
+    if ((vkr = createPipelineFromState(vkData, &state, variant->flags, vkData->pipelineLayout, vkData->renderPass,
+        !vkData->vertexPulling, pipeline)) != VK_SUCCESS) {
         LOG3DHW("[pipeline] Failed creating graphics pipeline (result: %s)!", mapVkResultToString(vkr));
         exit(-1);
     }
 
     LOG3DHW("[pipeline] Created pipeline");
 
-    vkData->pipelineLayout = pipelineLayout;
-    vkData->pipeline = pipeline;
+    vkDestroyShaderModule(vkData->device, fragmentShaderModule, NULL);
+    vkDestroyShaderModule(vkData->device, vertexShaderModule, NULL);
+}
+
+// Creates pipeline drawing the cube into offscreen render pass, e.g. for rendering thumbnails.
+// Unlike swapchain pipelines, shaders, layout, render pass and extent are all given by the caller.
+void createOffscreenGraphicsPipeline(VulkanData* vkData, VkRenderPass renderPass, VkPipelineLayout pipelineLayout, VkExtent2D extent,
+    VkShaderModule vertexShaderModule, VkShaderModule fragmentShaderModule, VkPipeline* pipeline) {
+    VkResult vkr;
+    PipelineVariant variant = getDefaultPipelineVariant();
+
+    GraphicsPipelineState state;
+    fillGraphicsPipelineState(extent, &variant, vertexShaderModule, fragmentShaderModule, &state);
+    if ((vkr = createPipelineFromState(vkData, &state, variant.flags, pipelineLayout, renderPass, true, pipeline)) != VK_SUCCESS) {
+        LOG3DHW("[pipeline] Failed creating offscreen graphics pipeline (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    LOG3DHW("[pipeline] Created offscreen pipeline (%dx%d)", extent.width, extent.height);
+}
+
+// Creates pipeline drawing single fullscreen triangle without any vertex input, e.g. for post processing.
+// Triangle is generated by vertex shader, so culling and depth test are disabled.
+void createFullscreenPipeline(VulkanData* vkData, VkRenderPass renderPass, VkPipelineLayout pipelineLayout, VkExtent2D extent,
+    VkShaderModule vertexShaderModule, VkShaderModule fragmentShaderModule, VkPipeline* pipeline) {
+    VkResult vkr;
+    PipelineVariant variant = getDefaultPipelineVariant();
+    variant.cullMode = VK_CULL_MODE_NONE;
+
+    GraphicsPipelineState state;
+    fillGraphicsPipelineState(extent, &variant, vertexShaderModule, fragmentShaderModule, &state);
+    state.depthStencilState.depthTestEnable = VK_FALSE;
+    state.depthStencilState.depthWriteEnable = VK_FALSE;
+    if ((vkr = createPipelineFromState(vkData, &state, variant.flags, pipelineLayout, renderPass, false, pipeline)) != VK_SUCCESS) {
+        LOG3DHW("[pipeline] Failed creating fullscreen pipeline (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    LOG3DHW("[pipeline] Created fullscreen pipeline (%dx%d)", extent.width, extent.height);
+}
+
+// Creates one part of the pipeline as a library (VK_EXT_graphics_pipeline_library). Parts are:
+// vertex input interface, pre-rasterization shaders, fragment shader and fragment output interface.
+// Note: this function can be called from pipeline compiler worker threads, so it must only read from vkData
+void createGraphicsPipelineLibrary(VulkanData* vkData, const PipelineVariant* variant, 
+    VkGraphicsPipelineLibraryFlagsEXT libraryPart, VkPipeline* library) {
+    VkResult vkr;
+    VkShaderModule vertexShaderModule;
+    VkShaderModule fragmentShaderModule;
+    createShaderModules(vkData, &vertexShaderModule, &fragmentShaderModule);
+
+    GraphicsPipelineState state;
+    fillGraphicsPipelineState(vkData->extent, variant, vertexShaderModule, fragmentShaderModule, &state);
+    if (vkData->vertexPulling) {
+        state.vertexInputState.vertexBindingDescriptionCount = 0;
+        state.vertexInputState.vertexAttributeDescriptionCount = 0;
+    }
+
+    VkGraphicsPipelineLibraryCreateInfoEXT libraryCreateInfo = { 0 };
+    libraryCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+    libraryCreateInfo.flags = libraryPart;
+
+    // Each library part consumes only its own subset of pipeline state, rest is left empty.
+    // Retained link time optimization info lets the same library be linked both quickly and fully optimized.
+    VkGraphicsPipelineCreateInfo graphicsPipelineCreateInfo = { 0 };
+    graphicsPipelineCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    graphicsPipelineCreateInfo.pNext = &libraryCreateInfo;
+    graphicsPipelineCreateInfo.flags = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT
+        | variant->flags;
+    graphicsPipelineCreateInfo.basePipelineHandle = VK_NULL_HANDLE;
+    graphicsPipelineCreateInfo.basePipelineIndex = -1;
+
+    if (libraryPart == VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT) {
+        graphicsPipelineCreateInfo.pVertexInputState = &state.vertexInputState;
+        graphicsPipelineCreateInfo.pInputAssemblyState = &state.inputAssemblyState;
+    } else if (libraryPart == VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT) {
+        graphicsPipelineCreateInfo.stageCount = 1;
+        graphicsPipelineCreateInfo.pStages = &state.shaderStages[0];
+        graphicsPipelineCreateInfo.pViewportState = &state.viewportState;
+        graphicsPipelineCreateInfo.pRasterizationState = &state.rasterizationState;
+        graphicsPipelineCreateInfo.layout = vkData->pipelineLayout;
+        graphicsPipelineCreateInfo.renderPass = vkData->renderPass;
+        graphicsPipelineCreateInfo.subpass = 0;
+    } else if (libraryPart == VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT) {
+        graphicsPipelineCreateInfo.stageCount = 1;
+        graphicsPipelineCreateInfo.pStages = &state.shaderStages[1];
+        graphicsPipelineCreateInfo.pMultisampleState = &state.multisampleState;
+        graphicsPipelineCreateInfo.pDepthStencilState = &state.depthStencilState;
+        graphicsPipelineCreateInfo.layout = vkData->pipelineLayout;
+        graphicsPipelineCreateInfo.renderPass = vkData->renderPass;
+        graphicsPipelineCreateInfo.subpass = 0;
+    } else if (libraryPart == VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT) {
+        graphicsPipelineCreateInfo.pMultisampleState = &state.multisampleState;
+        graphicsPipelineCreateInfo.pColorBlendState = &state.colorBlendState;
+        graphicsPipelineCreateInfo.renderPass = vkData->renderPass;
+        graphicsPipelineCreateInfo.subpass = 0;
+    } else {
+        LOG3DHW("[pipeline] Unknown pipeline library part: %d!", libraryPart);
+        exit(-1);
+    }
+
+    if ((vkr = vkCreateGraphicsPipelines(vkData->device, vkData->pipelineCache, 1, &graphicsPipelineCreateInfo, NULL, library)) != VK_SUCCESS) {
+        LOG3DHW("[pipeline] Failed creating graphics pipeline library (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
 
     vkDestroyShaderModule(vkData->device, fragmentShaderModule, NULL);
     vkDestroyShaderModule(vkData->device, vertexShaderModule, NULL);
 }
 
+// Links complete graphics pipeline from pipeline libraries. Without optimize (VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT)
+// this is expected to be fast (no shader compilation happens here), but resulting pipeline may run slower.
+// Note: this function can be called from pipeline compiler worker threads, so it must only read from vkData
+void linkGraphicsPipelineLibraries(VulkanData* vkData, const VkPipeline* libraries, uint32_t libraryCount, bool optimize,
+    VkPipeline* pipeline) {
+    VkResult vkr;
+
+    VkPipelineLibraryCreateInfoKHR libraryCreateInfo = { 0 };
+    libraryCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+    libraryCreateInfo.libraryCount = libraryCount;
+    libraryCreateInfo.pLibraries = libraries;
+
+    VkGraphicsPipelineCreateInfo graphicsPipelineCreateInfo = { 0 };
+    graphicsPipelineCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    graphicsPipelineCreateInfo.pNext = &libraryCreateInfo;
+    graphicsPipelineCreateInfo.flags = optimize ? VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT : 0;
+    graphicsPipelineCreateInfo.layout = vkData->pipelineLayout;
+    graphicsPipelineCreateInfo.basePipelineHandle = VK_NULL_HANDLE;
+    graphicsPipelineCreateInfo.basePipelineIndex = -1;
+
+    if ((vkr = vkCreateGraphicsPipelines(vkData->device, vkData->pipelineCache, 1, &graphicsPipelineCreateInfo, NULL, pipeline)) != VK_SUCCESS) {
+        LOG3DHW("[pipeline] Failed linking graphics pipeline libraries (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    LOG3DHW("[pipeline] Linked pipeline from %d libraries (%s)", libraryCount, optimize ? "link time optimized" : "fast link");
+}
+
 void createRenderPass(VulkanData* vkData) {
     VkResult vkr;
 
+    // Scene is rendered into intermediate image, which is post processed before it reaches swapchain
     VkAttachmentDescription colorAttachment = { 0 };
-    colorAttachment.format = vkData->surfaceFormat.format;
+    colorAttachment.format = SCENE_COLOR_FORMAT;
     colorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
     colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
     colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
     colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
     colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-    colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    // Layout transitions (and synchronization with swapchain image acquire) are handled by render graph
+    // barriers around the pass, so render pass keeps the attachment in single layout.
+    colorAttachment.initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
 
     VkAttachmentReference colorAttachmentReference = { 0 };
     colorAttachmentReference.attachment = 0;
     colorAttachmentReference.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
 
+    // Depth is transient - cleared on load and never stored, so on tile based GPUs it never leaves tile memory
+    VkAttachmentDescription depthAttachment = { 0 };
+    depthAttachment.format = vkData->depthFormat;
+    depthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    depthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    depthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    depthAttachment.initialLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+    depthAttachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+    VkAttachmentReference depthAttachmentReference = { 0 };
+    depthAttachmentReference.attachment = 1;
+    depthAttachmentReference.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
     VkSubpassDescription subpass = { 0 };
     subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
     subpass.colorAttachmentCount = 1;
     subpass.pColorAttachments = &colorAttachmentReference;
+    subpass.pDepthStencilAttachment = &depthAttachmentReference;
 
-    VkSubpassDependency subpassDependency = { 0 };
-    subpassDependency.srcSubpass = VK_SUBPASS_EXTERNAL;
-    subpassDependency.dstSubpass = 0;
-    subpassDependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-    subpassDependency.srcAccessMask = 0;
-    subpassDependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-    subpassDependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    VkAttachmentDescription attachments[] = {
+        colorAttachment, depthAttachment
+    };
 
     VkRenderPassCreateInfo renderPassCreateInfo = { 0 };
     renderPassCreateInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-    renderPassCreateInfo.attachmentCount = 1;
-    renderPassCreateInfo.pAttachments = &colorAttachment;
+    renderPassCreateInfo.attachmentCount = ARRAY_SIZE(attachments);
+    renderPassCreateInfo.pAttachments = attachments;
     renderPassCreateInfo.subpassCount = 1;
     renderPassCreateInfo.pSubpasses = &subpass;
-    renderPassCreateInfo.dependencyCount = 1;
-    renderPassCreateInfo.pDependencies = &subpassDependency;
+    renderPassCreateInfo.dependencyCount = 0;
+    renderPassCreateInfo.pDependencies = NULL;
 
     VkRenderPass renderPass;
     if ((vkr = vkCreateRenderPass(vkData->device, &renderPassCreateInfo, NULL, &renderPass)) != VK_SUCCESS) {
@@ -252,65 +510,6 @@ void createRenderPass(VulkanData* vkData) {
     vkData->renderPass = renderPass;
 }
 
-void createCommandBuffers(VulkanData* vkData) {
-    VkResult vkr;
-
-    vkData->commandBuffers = (VkCommandBuffer*) malloc(vkData->imageCount * sizeof(VkCommandBuffer));
-
-    VkCommandBufferAllocateInfo commandBufferAllocateInfo = { 0 };
-    commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-    commandBufferAllocateInfo.commandPool = vkData->commandPool;
-    commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-    commandBufferAllocateInfo.commandBufferCount = vkData->imageCount;
-    if ((vkr = vkAllocateCommandBuffers(vkData->device, &commandBufferAllocateInfo, vkData->commandBuffers)) != VK_SUCCESS) {
-        LOG3DHW("[pipeline] Failed allocating command buffers (result: %s)!", mapVkResultToString(vkr));
-        exit(-1);
-    }
-
-    for (uint32_t i = 0; i < vkData->imageCount; i++) {
-        VkCommandBufferBeginInfo commandBufferBeginInfo = { 0 };
-        commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-        if ((vkr = vkBeginCommandBuffer(vkData->commandBuffers[i], &commandBufferBeginInfo)) != VK_SUCCESS) {
-            LOG3DHW("[pipeline] Failed beginning command buffer (result: %s)!", mapVkResultToString(vkr));
-            exit(-1);
-        }
-
-        VkClearValue clearValue = { 0 };
-        VkClearColorValue clearColorValue = { { (99.f / 255.f), (139.f / 255.f), (235.f / 255.f), 1.f } };
-        clearValue.color = clearColorValue;
-
-        VkOffset2D renderAreaOffset = { 0, 0 };
-
-        VkRenderPassBeginInfo renderPassBeginInfo = { 0 };
-        renderPassBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        renderPassBeginInfo.framebuffer = vkData->framebuffers[i];
-        renderPassBeginInfo.renderPass = vkData->renderPass;
-        renderPassBeginInfo.renderArea.extent = vkData->extent;
-        renderPassBeginInfo.renderArea.offset = renderAreaOffset;
-        renderPassBeginInfo.clearValueCount = 1;
-        renderPassBeginInfo.pClearValues = &clearValue;
-
-        vkCmdBeginRenderPass(vkData->commandBuffers[i], &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
-
-        vkCmdBindPipeline(vkData->commandBuffers[i], VK_PIPELINE_BIND_POINT_GRAPHICS, vkData->pipeline);
-        VkBuffer vertexBuffers[] = {
-            vkData->vertexBuffer
-        };
-        VkDeviceSize bufferOffsets[] = { 0 };
-        vkCmdBindVertexBuffers(vkData->commandBuffers[i], 0, 1, vertexBuffers, bufferOffsets);
-
-        vkCmdBindDescriptorSets(vkData->commandBuffers[i], VK_PIPELINE_BIND_POINT_GRAPHICS, vkData->pipelineLayout, 0, 1, &vkData->descriptorSets[i], 0, NULL);
-
-        vkCmdDraw(vkData->commandBuffers[i], 36, 1, 0, 0);
-        vkCmdEndRenderPass(vkData->commandBuffers[i]);
-
-        if ((vkr = vkEndCommandBuffer(vkData->commandBuffers[i])) != VK_SUCCESS) {
-            LOG3DHW("[pipeline] Failed ending command buffer (result: %s)!", mapVkResultToString(vkr));
-            exit(-1);
-        }
-    }
-}
-
 void createCommandPool(VulkanData* vkData) {
     VkResult vkr;
 
@@ -335,13 +534,17 @@ void createDescriptorPool(VulkanData* vkData) {
     samplerDescriptorPoolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;;
     samplerDescriptorPoolSize.descriptorCount = vkData->imageCount;
 
+    VkDescriptorPoolSize storageDescriptorPoolSize = { 0 };
+    storageDescriptorPoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    storageDescriptorPoolSize.descriptorCount = 2 * vkData->imageCount;
+
     VkDescriptorPoolSize descriptorPoolSizes[] = {
-        descriptorPoolSize, samplerDescriptorPoolSize
+        descriptorPoolSize, samplerDescriptorPoolSize, storageDescriptorPoolSize
     };
 
     VkDescriptorPoolCreateInfo descriptorPoolCreateInfo = { 0 };
     descriptorPoolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-    descriptorPoolCreateInfo.poolSizeCount = 2;
+    descriptorPoolCreateInfo.poolSizeCount = ARRAY_SIZE(descriptorPoolSizes);
     descriptorPoolCreateInfo.pPoolSizes = descriptorPoolSizes;
     descriptorPoolCreateInfo.maxSets = vkData->imageCount;
     if ((vkr = vkCreateDescriptorPool(vkData->device, &descriptorPoolCreateInfo, NULL, &vkData->descriptorPool)) != VK_SUCCESS) {
@@ -399,11 +602,29 @@ void createDescriptorSets(VulkanData* vkData) {
         samplerWriteDescriptorSet.descriptorCount = 1;
         samplerWriteDescriptorSet.pImageInfo = &descriptorImageInfo; 
 
+        // Vertex and index buffer are the same for every image
+        VkDescriptorBufferInfo storageBufferInfos[2] = { 0 };
+        storageBufferInfos[0].buffer = vkData->vertexBuffer;
+        storageBufferInfos[0].offset = 0;
+        storageBufferInfos[0].range = VK_WHOLE_SIZE;
+        storageBufferInfos[1].buffer = vkData->indexBuffer;
+        storageBufferInfos[1].offset = 0;
+        storageBufferInfos[1].range = VK_WHOLE_SIZE;
+
+        VkWriteDescriptorSet storageWriteDescriptorSet = { 0 };
+        storageWriteDescriptorSet.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        storageWriteDescriptorSet.dstSet = vkData->descriptorSets[i];
+        storageWriteDescriptorSet.dstBinding = 2;
+        storageWriteDescriptorSet.dstArrayElement = 0;
+        storageWriteDescriptorSet.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        storageWriteDescriptorSet.descriptorCount = 2; // consecutive bindings 2 and 3
+        storageWriteDescriptorSet.pBufferInfo = storageBufferInfos;
+
         VkWriteDescriptorSet writeDescriptorSets[] = {
-            writeDescriptorSet, samplerWriteDescriptorSet
+            writeDescriptorSet, samplerWriteDescriptorSet, storageWriteDescriptorSet
         };
        
-        vkUpdateDescriptorSets(vkData->device, 2, writeDescriptorSets, 0, NULL);
+        vkUpdateDescriptorSets(vkData->device, ARRAY_SIZE(writeDescriptorSets), writeDescriptorSets, 0, NULL);
     }
 
     free(descriptorSetLayouts);
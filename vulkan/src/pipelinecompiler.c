@@ -0,0 +1,323 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <vulkan/vulkan.h>
+
+#include "pipelinecompiler.h"
+#include "pipeline.h"
+#include "vkdata.h"
+#include "threading.h"
+#include "utils.h"
+#include "vkdebug.h"
+
+// Vertex input, fragment shader and fragment output interface parts don't depend on variant state,
+// so they are compiled once and then linked with variant-specific pre-rasterization part.
+static void createSharedPipelineLibraries(PipelineCompiler* compiler) {
+    PipelineVariant defaultVariant = getDefaultPipelineVariant();
+
+    createGraphicsPipelineLibrary(compiler->vkData, &defaultVariant,
+        VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT, &compiler->vertexInputLibrary);
+    createGraphicsPipelineLibrary(compiler->vkData, &defaultVariant,
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT, &compiler->fragmentShaderLibrary);
+    createGraphicsPipelineLibrary(compiler->vkData, &defaultVariant,
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT, &compiler->fragmentOutputLibrary);
+
+    LOG3DHW("[pipelinecompiler] Created shared pipeline libraries");
+}
+
+static void destroySharedPipelineLibraries(PipelineCompiler* compiler) {
+    VkPipeline* libraries[] = {
+        &compiler->vertexInputLibrary, &compiler->fragmentShaderLibrary, &compiler->fragmentOutputLibrary
+    };
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(libraries); i++) {
+        if (*libraries[i] != VK_NULL_HANDLE) {
+            vkDestroyPipeline(compiler->vkData->device, *libraries[i], NULL);
+            *libraries[i] = VK_NULL_HANDLE;
+        }
+    }
+}
+
+// Pre-rasterization part is the only one which depends on variant, so it's compiled here and linked with shared ones
+static void linkPipelineVariant(PipelineCompiler* compiler, const PipelineVariant* variant, bool optimize, VkPipeline* pipeline) {
+    VulkanData* vkData = compiler->vkData;
+
+    VkPipeline preRasterizationLibrary;
+    createGraphicsPipelineLibrary(vkData, variant, VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+        &preRasterizationLibrary);
+
+    VkPipeline libraries[] = {
+        compiler->vertexInputLibrary, preRasterizationLibrary, compiler->fragmentShaderLibrary, compiler->fragmentOutputLibrary
+    };
+    linkGraphicsPipelineLibraries(vkData, libraries, ARRAY_SIZE(libraries), optimize, pipeline);
+
+    // Linked pipeline doesn't depend on library lifetime
+    vkDestroyPipeline(vkData->device, preRasterizationLibrary, NULL);
+}
+
+// Runs on worker threads - result replaces the fallback pipeline, so it's always fully optimized
+static void compilePipeline(PipelineCompiler* compiler, const PipelineVariant* variant, VkPipeline* pipeline) {
+    if (compiler->vkData->graphicsPipelineLibrarySupported) {
+        linkPipelineVariant(compiler, variant, true, pipeline);
+    } else {
+        createGraphicsPipelineVariant(compiler->vkData, variant, pipeline);
+    }
+}
+
+// Job queued first is compiled first, pipeline IDs grow with every request
+static PipelineJob* findOldestQueuedJob(PipelineCompiler* compiler) {
+    PipelineJob* oldestJob = NULL;
+    for (uint32_t i = 0; i < PIPELINE_COMPILER_MAX_JOBS; i++) {
+        PipelineJob* job = &compiler->jobs[i];
+        if (job->state == PIPELINE_JOB_QUEUED && (oldestJob == NULL || job->pipelineId < oldestJob->pipelineId)) {
+            oldestJob = job;
+        }
+    }
+
+    return oldestJob;
+}
+
+// Slots are reused, so jobs are looked up by ID; returns NULL for delivered and flushed pipelines
+static PipelineJob* findJob(PipelineCompiler* compiler, uint32_t pipelineId) {
+    for (uint32_t i = 0; i < PIPELINE_COMPILER_MAX_JOBS; i++) {
+        if (compiler->jobs[i].state != PIPELINE_JOB_FREE && compiler->jobs[i].pipelineId == pipelineId) {
+            return &compiler->jobs[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void pipelineCompilerWorker(void* userData) {
+    PipelineCompiler* compiler = (PipelineCompiler*) userData;
+
+    lockMutex(&compiler->mutex);
+    while (true) {
+        while (compiler->running && compiler->jobsQueued == 0) {
+            waitCondVar(&compiler->jobQueued, &compiler->mutex);
+        }
+
+        if (!compiler->running) {
+            break;
+        }
+
+        // Slot stays taken while compiling (only delivery frees it), so job pointer is valid after unlocking
+        PipelineJob* job = findOldestQueuedJob(compiler);
+        PipelineVariant variant = job->variant;
+        job->state = PIPELINE_JOB_COMPILING;
+        compiler->jobsQueued--;
+        compiler->jobsInProgress++;
+
+        // Compilation happens without holding the lock, so render loop is never blocked by it
+        unlockMutex(&compiler->mutex);
+
+        double startTimeMs = monotonicMilliseconds();
+
+        VkPipeline pipeline;
+        compilePipeline(compiler, &variant, &pipeline);
+
+        float compileTimeMs = (float) (monotonicMilliseconds() - startTimeMs);
+
+        lockMutex(&compiler->mutex);
+        job->pipeline = pipeline;
+        job->compileTimeMs = compileTimeMs;
+        job->state = PIPELINE_JOB_READY;
+        compiler->jobsInProgress--;
+        broadcastCondVar(&compiler->jobFinished);
+    }
+    unlockMutex(&compiler->mutex);
+}
+
+void createPipelineCompiler(VulkanData* vkData, PipelineCompiler* compiler) {
+    compiler->vkData = vkData;
+    for (uint32_t i = 0; i < PIPELINE_COMPILER_MAX_JOBS; i++) {
+        compiler->jobs[i].state = PIPELINE_JOB_FREE;
+    }
+    compiler->nextPipelineId = 0;
+    compiler->firstValidPipelineId = 0;
+    compiler->jobsQueued = 0;
+    compiler->jobsInProgress = 0;
+    compiler->running = true;
+    compiler->vertexInputLibrary = VK_NULL_HANDLE;
+    compiler->fragmentShaderLibrary = VK_NULL_HANDLE;
+    compiler->fragmentOutputLibrary = VK_NULL_HANDLE;
+
+    initMutex(&compiler->mutex);
+    initCondVar(&compiler->jobQueued);
+    initCondVar(&compiler->jobFinished);
+
+    if (vkData->graphicsPipelineLibrarySupported) {
+        createSharedPipelineLibraries(compiler);
+    }
+
+    for (uint32_t i = 0; i < PIPELINE_COMPILER_THREAD_COUNT; i++) {
+        if (!createThread(&compiler->threads[i], pipelineCompilerWorker, compiler)) {
+            LOG3DHW("[pipelinecompiler] Failed creating worker thread %d!", i);
+            exit(-1);
+        }
+    }
+
+    LOG3DHW("[pipelinecompiler] Started %d worker threads (mode: %s)", PIPELINE_COMPILER_THREAD_COUNT,
+        vkData->graphicsPipelineLibrarySupported ? "link time optimized pipeline libraries" : "full compilation");
+}
+
+// Shared libraries are destroyed on flush (render pass may have changed), so we recreate them lazily
+static void ensureSharedPipelineLibraries(PipelineCompiler* compiler) {
+    if (compiler->vkData->graphicsPipelineLibrarySupported && compiler->vertexInputLibrary == VK_NULL_HANDLE) {
+        createSharedPipelineLibraries(compiler);
+    }
+}
+
+// Fast link doesn't compile anything besides variant's vertex shader, so it's cheap enough to do before first frame.
+// Without pipeline libraries there is no way around full compile, only optimizations can be skipped.
+void createFallbackPipeline(PipelineCompiler* compiler, const PipelineVariant* variant, VkPipeline* pipeline) {
+    ensureSharedPipelineLibraries(compiler);
+
+    double startTimeMs = monotonicMilliseconds();
+
+    if (compiler->vkData->graphicsPipelineLibrarySupported) {
+        linkPipelineVariant(compiler, variant, false, pipeline);
+    } else {
+        PipelineVariant unoptimizedVariant = *variant;
+        unoptimizedVariant.flags |= VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
+        createGraphicsPipelineVariant(compiler->vkData, &unoptimizedVariant, pipeline);
+    }
+
+    LOG3DHW("[pipelinecompiler] Created fallback pipeline (%s, %.2f ms)",
+        compiler->vkData->graphicsPipelineLibrarySupported ? "fast link" : "unoptimized", (float) (monotonicMilliseconds() - startTimeMs));
+}
+
+uint32_t requestPipeline(PipelineCompiler* compiler, const PipelineVariant* variant, PipelineReadyCallback readyCallback, void* userData) {
+    ensureSharedPipelineLibraries(compiler);
+
+    lockMutex(&compiler->mutex);
+
+    PipelineJob* job = NULL;
+    for (uint32_t i = 0; i < PIPELINE_COMPILER_MAX_JOBS && job == NULL; i++) {
+        if (compiler->jobs[i].state == PIPELINE_JOB_FREE) {
+            job = &compiler->jobs[i];
+        }
+    }
+    if (job == NULL) {
+        LOG3DHW("[pipelinecompiler] Too many pipelines waiting for delivery (max: %d)!", PIPELINE_COMPILER_MAX_JOBS);
+        exit(-1);
+    }
+
+    uint32_t pipelineId = compiler->nextPipelineId++;
+    job->pipelineId = pipelineId;
+    job->variant = *variant;
+    job->state = PIPELINE_JOB_QUEUED;
+    job->pipeline = VK_NULL_HANDLE;
+    job->readyCallback = readyCallback;
+    job->userData = userData;
+    job->compileTimeMs = 0.f;
+    compiler->jobsQueued++;
+
+    signalCondVar(&compiler->jobQueued);
+    unlockMutex(&compiler->mutex);
+
+    LOG3DHW("[pipelinecompiler] Queued pipeline %d", pipelineId);
+
+    return pipelineId;
+}
+
+// Delivered pipeline counts as ready, even though it's no longer returned by getPipelineOrFallback()
+bool isPipelineReady(PipelineCompiler* compiler, uint32_t pipelineId) {
+    lockMutex(&compiler->mutex);
+    PipelineJob* job = findJob(compiler, pipelineId);
+    bool ready = job != NULL ? job->state == PIPELINE_JOB_READY
+        : pipelineId >= compiler->firstValidPipelineId && pipelineId < compiler->nextPipelineId;
+    unlockMutex(&compiler->mutex);
+
+    return ready;
+}
+
+// Returns compiled pipeline until it's delivered - after that it's owned by ready callback receiver
+VkPipeline getPipelineOrFallback(PipelineCompiler* compiler, uint32_t pipelineId, VkPipeline fallbackPipeline) {
+    VkPipeline pipeline = fallbackPipeline;
+
+    lockMutex(&compiler->mutex);
+    PipelineJob* job = findJob(compiler, pipelineId);
+    if (job != NULL && job->state == PIPELINE_JOB_READY) {
+        pipeline = job->pipeline;
+    }
+    unlockMutex(&compiler->mutex);
+
+    return pipeline;
+}
+
+// Should be called once per frame from render loop; ready callbacks are invoked on calling thread
+void pollPipelineCompiler(PipelineCompiler* compiler) {
+    PipelineJob readyJobs[PIPELINE_COMPILER_MAX_JOBS];
+    uint32_t readyJobCount = 0;
+
+    // Delivered jobs give their slots back right away
+    lockMutex(&compiler->mutex);
+    for (uint32_t i = 0; i < PIPELINE_COMPILER_MAX_JOBS; i++) {
+        if (compiler->jobs[i].state == PIPELINE_JOB_READY) {
+            readyJobs[readyJobCount++] = compiler->jobs[i];
+            compiler->jobs[i].state = PIPELINE_JOB_FREE;
+        }
+    }
+    unlockMutex(&compiler->mutex);
+
+    // Callbacks are called without holding the lock, so they can request more pipelines
+    for (uint32_t i = 0; i < readyJobCount; i++) {
+        LOG3DHW("[pipelinecompiler] Pipeline %d ready (compiled in %.2f ms)", readyJobs[i].pipelineId, readyJobs[i].compileTimeMs);
+
+        if (readyJobs[i].readyCallback != NULL) {
+            readyJobs[i].readyCallback(compiler->vkData, readyJobs[i].pipelineId, readyJobs[i].pipeline, readyJobs[i].userData);
+        }
+    }
+}
+
+// Cancels queued jobs, waits for jobs in progress and destroys pipelines which weren't delivered yet.
+// Has to be called before anything pipelines depend on (render pass, pipeline layout) is destroyed.
+// All pipeline IDs are invalid after flush.
+void flushPipelineCompiler(PipelineCompiler* compiler) {
+    lockMutex(&compiler->mutex);
+
+    // Queued jobs are cancelled first, so workers won't pick them up while we wait
+    for (uint32_t i = 0; i < PIPELINE_COMPILER_MAX_JOBS; i++) {
+        if (compiler->jobs[i].state == PIPELINE_JOB_QUEUED) {
+            compiler->jobs[i].state = PIPELINE_JOB_FREE;
+        }
+    }
+    compiler->jobsQueued = 0;
+
+    while (compiler->jobsInProgress > 0) {
+        waitCondVar(&compiler->jobFinished, &compiler->mutex);
+    }
+
+    for (uint32_t i = 0; i < PIPELINE_COMPILER_MAX_JOBS; i++) {
+        if (compiler->jobs[i].state == PIPELINE_JOB_READY) {
+            vkDestroyPipeline(compiler->vkData->device, compiler->jobs[i].pipeline, NULL);
+        }
+        compiler->jobs[i].state = PIPELINE_JOB_FREE;
+    }
+    compiler->firstValidPipelineId = compiler->nextPipelineId;
+
+    unlockMutex(&compiler->mutex);
+
+    destroySharedPipelineLibraries(compiler);
+
+    LOG3DHW("[pipelinecompiler] Flushed pipeline compiler");
+}
+
+void destroyPipelineCompiler(PipelineCompiler* compiler) {
+    flushPipelineCompiler(compiler);
+
+    lockMutex(&compiler->mutex);
+    compiler->running = false;
+    broadcastCondVar(&compiler->jobQueued);
+    unlockMutex(&compiler->mutex);
+
+    for (uint32_t i = 0; i < PIPELINE_COMPILER_THREAD_COUNT; i++) {
+        joinThread(compiler->threads[i]);
+    }
+
+    destroyCondVar(&compiler->jobFinished);
+    destroyCondVar(&compiler->jobQueued);
+    destroyMutex(&compiler->mutex);
+
+    LOG3DHW("[pipelinecompiler] Destroyed pipeline compiler");
+}
@@ -0,0 +1,223 @@
+#include <stdlib.h>
+#include <vulkan/vulkan.h>
+
+#include "postprocess.h"
+#include "vkdata.h"
+#include "pipeline.h"
+#include "shader.h"
+#include "utils.h"
+#include "vkdebug.h"
+
+static void createPostProcessRenderPass(VulkanData* vkData) {
+    VkResult vkr;
+
+    // Every pixel is overwritten by fullscreen triangle, so previous contents are never loaded
+    VkAttachmentDescription colorAttachment = { 0 };
+    colorAttachment.format = vkData->presentByBlit ? SCENE_COLOR_FORMAT : vkData->surfaceFormat.format;
+    colorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    colorAttachment.initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    VkAttachmentReference colorAttachmentReference = { 0 };
+    colorAttachmentReference.attachment = 0;
+    colorAttachmentReference.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    VkSubpassDescription subpass = { 0 };
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &colorAttachmentReference;
+
+    VkRenderPassCreateInfo renderPassCreateInfo = { 0 };
+    renderPassCreateInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassCreateInfo.attachmentCount = 1;
+    renderPassCreateInfo.pAttachments = &colorAttachment;
+    renderPassCreateInfo.subpassCount = 1;
+    renderPassCreateInfo.pSubpasses = &subpass;
+    if ((vkr = vkCreateRenderPass(vkData->device, &renderPassCreateInfo, NULL, &vkData->postRenderPass)) != VK_SUCCESS) {
+        LOG3DHW("[postprocess] Failed creating render pass (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    // Post pass writes either post color (then all framebuffers are identical, like the main pass ones) or swapchain image itself
+    vkData->postFramebuffers = (VkFramebuffer*) malloc(vkData->imageCount * sizeof(VkFramebuffer));
+    for (uint32_t i = 0; i < vkData->imageCount; i++) {
+        VkFramebufferCreateInfo framebufferCreateInfo = { 0 };
+        framebufferCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        framebufferCreateInfo.renderPass = vkData->postRenderPass;
+        framebufferCreateInfo.attachmentCount = 1;
+        framebufferCreateInfo.pAttachments = vkData->presentByBlit ? &vkData->postColorImageView : &vkData->imageViews[i];
+        framebufferCreateInfo.width = vkData->extent.width;
+        framebufferCreateInfo.height = vkData->extent.height;
+        framebufferCreateInfo.layers = 1;
+        if ((vkr = vkCreateFramebuffer(vkData->device, &framebufferCreateInfo, NULL, &vkData->postFramebuffers[i])) != VK_SUCCESS) {
+            LOG3DHW("[postprocess] Failed creating framebuffer %d (result: %s)!", i, mapVkResultToString(vkr));
+            exit(-1);
+        }
+    }
+}
+
+static void createPostProcessDescriptorSet(VulkanData* vkData) {
+    VkResult vkr;
+
+    VkSamplerCreateInfo samplerCreateInfo = { 0 };
+    samplerCreateInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerCreateInfo.magFilter = VK_FILTER_NEAREST;
+    samplerCreateInfo.minFilter = VK_FILTER_NEAREST;
+    samplerCreateInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    samplerCreateInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerCreateInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerCreateInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerCreateInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
+    if ((vkr = vkCreateSampler(vkData->device, &samplerCreateInfo, NULL, &vkData->postSampler)) != VK_SUCCESS) {
+        LOG3DHW("[postprocess] Failed creating sampler (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    VkDescriptorSetLayoutBinding sceneColorBinding = { 0 };
+    sceneColorBinding.binding = 0;
+    sceneColorBinding.descriptorCount = 1;
+    sceneColorBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    sceneColorBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+
+    VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = { 0 };
+    descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    descriptorSetLayoutCreateInfo.bindingCount = 1;
+    descriptorSetLayoutCreateInfo.pBindings = &sceneColorBinding;
+    if ((vkr = vkCreateDescriptorSetLayout(vkData->device, &descriptorSetLayoutCreateInfo, NULL, &vkData->postDescriptorSetLayout)) != VK_SUCCESS) {
+        LOG3DHW("[postprocess] Failed creating descriptor set layout (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    VkDescriptorPoolSize descriptorPoolSize = { 0 };
+    descriptorPoolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    descriptorPoolSize.descriptorCount = 1;
+
+    VkDescriptorPoolCreateInfo descriptorPoolCreateInfo = { 0 };
+    descriptorPoolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    descriptorPoolCreateInfo.poolSizeCount = 1;
+    descriptorPoolCreateInfo.pPoolSizes = &descriptorPoolSize;
+    descriptorPoolCreateInfo.maxSets = 1;
+    if ((vkr = vkCreateDescriptorPool(vkData->device, &descriptorPoolCreateInfo, NULL, &vkData->postDescriptorPool)) != VK_SUCCESS) {
+        LOG3DHW("[postprocess] Failed creating descriptor pool (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    // Scene color is shared by all frames (just like depth), so single descriptor set is enough
+    VkDescriptorSetAllocateInfo descriptorSetAllocateInfo = { 0 };
+    descriptorSetAllocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    descriptorSetAllocateInfo.descriptorPool = vkData->postDescriptorPool;
+    descriptorSetAllocateInfo.descriptorSetCount = 1;
+    descriptorSetAllocateInfo.pSetLayouts = &vkData->postDescriptorSetLayout;
+    if ((vkr = vkAllocateDescriptorSets(vkData->device, &descriptorSetAllocateInfo, &vkData->postDescriptorSet)) != VK_SUCCESS) {
+        LOG3DHW("[postprocess] Failed allocating descriptor set (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    VkDescriptorImageInfo descriptorImageInfo = { 0 };
+    descriptorImageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    descriptorImageInfo.imageView = vkData->sceneColorImageView;
+    descriptorImageInfo.sampler = vkData->postSampler;
+
+    VkWriteDescriptorSet writeDescriptorSet = { 0 };
+    writeDescriptorSet.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writeDescriptorSet.dstSet = vkData->postDescriptorSet;
+    writeDescriptorSet.dstBinding = 0;
+    writeDescriptorSet.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    writeDescriptorSet.descriptorCount = 1;
+    writeDescriptorSet.pImageInfo = &descriptorImageInfo;
+
+    vkUpdateDescriptorSets(vkData->device, 1, &writeDescriptorSet, 0, NULL);
+}
+
+static void createPostProcessPipeline(VulkanData* vkData) {
+    VkResult vkr;
+
+    VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo = { 0 };
+    pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutCreateInfo.setLayoutCount = 1;
+    pipelineLayoutCreateInfo.pSetLayouts = &vkData->postDescriptorSetLayout;
+    if ((vkr = vkCreatePipelineLayout(vkData->device, &pipelineLayoutCreateInfo, NULL, &vkData->postPipelineLayout)) != VK_SUCCESS) {
+        LOG3DHW("[postprocess] Failed creating pipeline layout (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    char* vertexShaderBytes;
+    size_t vertexShaderLength;
+    char* fragmentShaderBytes;
+    size_t fragmentShaderLength;
+    loadShaderFromFile("post_vert.spv", &vertexShaderBytes, &vertexShaderLength);
+    loadShaderFromFile("post_frag.spv", &fragmentShaderBytes, &fragmentShaderLength);
+
+    VkShaderModule vertexShaderModule;
+    VkShaderModule fragmentShaderModule;
+    createShaderModule(vkData, vertexShaderBytes, vertexShaderLength, &vertexShaderModule);
+    createShaderModule(vkData, fragmentShaderBytes, fragmentShaderLength, &fragmentShaderModule);
+
+    createFullscreenPipeline(vkData, vkData->postRenderPass, vkData->postPipelineLayout, vkData->extent,
+        vertexShaderModule, fragmentShaderModule, &vkData->postPipeline);
+
+    vkDestroyShaderModule(vkData->device, fragmentShaderModule, NULL);
+    vkDestroyShaderModule(vkData->device, vertexShaderModule, NULL);
+    free(fragmentShaderBytes);
+    free(vertexShaderBytes);
+}
+
+// Post processing reads scene color rendered by the main pass and writes post processed color, which is then
+// blitted to swapchain image. When swapchain can't be blitted to (see createSwapchainAndImageViews()), it writes
+// swapchain image directly instead. Images are transient (see createTransientImages()), so everything here
+// depends on swapchain extent and is recreated together with the swapchain.
+void createPostProcessing(VulkanData* vkData) {
+    createPostProcessRenderPass(vkData);
+    createPostProcessDescriptorSet(vkData);
+    createPostProcessPipeline(vkData);
+
+    LOG3DHW("[postprocess] Created post processing resources");
+}
+
+void destroyPostProcessing(VulkanData* vkData) {
+    vkDestroyPipeline(vkData->device, vkData->postPipeline, NULL);
+    vkDestroyPipelineLayout(vkData->device, vkData->postPipelineLayout, NULL);
+    vkDestroyDescriptorPool(vkData->device, vkData->postDescriptorPool, NULL);
+    vkDestroyDescriptorSetLayout(vkData->device, vkData->postDescriptorSetLayout, NULL);
+    vkDestroySampler(vkData->device, vkData->postSampler, NULL);
+    for (uint32_t i = 0; i < vkData->imageCount; i++) {
+        vkDestroyFramebuffer(vkData->device, vkData->postFramebuffers[i], NULL);
+    }
+    free(vkData->postFramebuffers);
+    vkDestroyRenderPass(vkData->device, vkData->postRenderPass, NULL);
+
+    LOG3DHW("[postprocess] Destroyed post processing resources");
+}
+
+void recordPostProcessPass(VulkanData* vkData, VkCommandBuffer commandBuffer, uint32_t imageIndex, void* userData) {
+    VkRenderPassBeginInfo renderPassBeginInfo = { 0 };
+    renderPassBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    renderPassBeginInfo.framebuffer = vkData->postFramebuffers[imageIndex];
+    renderPassBeginInfo.renderPass = vkData->postRenderPass;
+    renderPassBeginInfo.renderArea.extent = vkData->extent;
+
+    vkCmdBeginRenderPass(commandBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkData->postPipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkData->postPipelineLayout, 0, 1, &vkData->postDescriptorSet, 0, NULL);
+    vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+    vkCmdEndRenderPass(commandBuffer);
+}
+
+// Images have the same size, so blit only converts post processed color to swapchain format
+void recordPresentPass(VulkanData* vkData, VkCommandBuffer commandBuffer, uint32_t imageIndex, void* userData) {
+    VkImageBlit region = { 0 };
+    region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.srcSubresource.layerCount = 1;
+    region.srcOffsets[1].x = (int32_t) vkData->extent.width;
+    region.srcOffsets[1].y = (int32_t) vkData->extent.height;
+    region.srcOffsets[1].z = 1;
+    region.dstSubresource = region.srcSubresource;
+    region.dstOffsets[1] = region.srcOffsets[1];
+
+    vkCmdBlitImage(commandBuffer, vkData->postColorImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        vkData->images[imageIndex], VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region, VK_FILTER_NEAREST);
+}
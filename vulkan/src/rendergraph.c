@@ -0,0 +1,392 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <vulkan/vulkan.h>
+
+#include "rendergraph.h"
+#include "vkdata.h"
+#include "utils.h"
+#include "vkdebug.h"
+
+// Only write accesses have to be made available by the source side of a barrier
+static const VkAccessFlags WRITE_ACCESS_MASK = VK_ACCESS_HOST_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT |
+    VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+// Synchronization state of a single resource while walking through passes
+typedef struct ResourceState {
+    VkImageLayout layout;
+    VkPipelineStageFlags writeStages; // stages of the last write (or layout transition)
+    VkAccessFlags writeAccess; // memory written by the last write, not yet made available
+    VkPipelineStageFlags readStages; // stages which read the resource since the last write
+    VkPipelineStageFlags visibleStages; // stages the last write was already made visible to
+    VkAccessFlags visibleAccess;
+} ResourceState;
+
+AccessInfo getAccessInfo(ResourceAccess access) {
+    AccessInfo info = { 0 };
+    info.layout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    switch (access) {
+        case ACCESS_NONE:
+            break;
+        case ACCESS_SWAPCHAIN_ACQUIRE:
+            // Acquire semaphore is waited at this stage, so transitions of swapchain images have to wait for it too
+            info.stageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+            break;
+        case ACCESS_HOST_WRITE:
+            info.stageMask = VK_PIPELINE_STAGE_HOST_BIT;
+            info.accessMask = VK_ACCESS_HOST_WRITE_BIT;
+            info.layout = VK_IMAGE_LAYOUT_GENERAL;
+            info.write = true;
+            break;
+        case ACCESS_HOST_READ:
+            info.stageMask = VK_PIPELINE_STAGE_HOST_BIT;
+            info.accessMask = VK_ACCESS_HOST_READ_BIT;
+            info.layout = VK_IMAGE_LAYOUT_GENERAL;
+            break;
+        case ACCESS_TRANSFER_READ:
+            info.stageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+            info.accessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            info.layout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            break;
+        case ACCESS_TRANSFER_WRITE:
+            info.stageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+            info.accessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            info.layout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            info.write = true;
+            break;
+        case ACCESS_INDIRECT_BUFFER_READ:
+            info.stageMask = VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+            info.accessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+            break;
+        case ACCESS_VERTEX_BUFFER_READ:
+            info.stageMask = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+            info.accessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+            break;
+        case ACCESS_INDEX_BUFFER_READ:
+            info.stageMask = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+            info.accessMask = VK_ACCESS_INDEX_READ_BIT;
+            break;
+        case ACCESS_UNIFORM_READ:
+            info.stageMask = VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+            info.accessMask = VK_ACCESS_UNIFORM_READ_BIT;
+            break;
+        case ACCESS_VERTEX_SHADER_READ:
+            info.stageMask = VK_PIPELINE_STAGE_VERTEX_SHADER_BIT;
+            info.accessMask = VK_ACCESS_SHADER_READ_BIT;
+            info.layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            break;
+        case ACCESS_FRAGMENT_SHADER_READ:
+            info.stageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+            info.accessMask = VK_ACCESS_SHADER_READ_BIT;
+            info.layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            break;
+        case ACCESS_COMPUTE_SHADER_READ:
+            info.stageMask = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+            info.accessMask = VK_ACCESS_SHADER_READ_BIT;
+            info.layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            break;
+        case ACCESS_COMPUTE_SHADER_WRITE:
+            info.stageMask = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+            info.accessMask = VK_ACCESS_SHADER_WRITE_BIT;
+            info.layout = VK_IMAGE_LAYOUT_GENERAL;
+            info.write = true;
+            break;
+        case ACCESS_COLOR_ATTACHMENT_WRITE:
+            info.stageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+            info.accessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+            info.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+            info.write = true;
+            break;
+        case ACCESS_DEPTH_ATTACHMENT_READ:
+            info.stageMask = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+            info.accessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT;
+            info.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+            break;
+        case ACCESS_DEPTH_ATTACHMENT_WRITE:
+            info.stageMask = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+            info.accessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+            info.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+            info.write = true;
+            break;
+        case ACCESS_PRESENT:
+            // Presentation engine waits for semaphore, so no stage or access has to be made visible here
+            info.stageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+            info.layout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+            break;
+        default:
+            LOG3DHW("[rendergraph] Unknown resource access: %d!", access);
+            exit(-1);
+    }
+
+    return info;
+}
+
+void initRenderGraph(RenderGraph* graph) {
+    graph->resourceCount = 0;
+    graph->passCount = 0;
+}
+
+static uint32_t addRenderGraphResource(RenderGraph* graph, const char* name, ResourceAccess initialAccess, ResourceAccess finalAccess) {
+    if (graph->resourceCount >= RENDER_GRAPH_MAX_RESOURCES) {
+        LOG3DHW("[rendergraph] Too many resources (max: %d)!", RENDER_GRAPH_MAX_RESOURCES);
+        exit(-1);
+    }
+
+    RenderGraphResource* resource = &graph->resources[graph->resourceCount];
+    resource->name = name;
+    resource->image = VK_NULL_HANDLE;
+    resource->aspectMask = 0;
+    resource->buffer = VK_NULL_HANDLE;
+    resource->initialAccess = initialAccess;
+    resource->finalAccess = finalAccess;
+    resource->transient = false;
+
+    return graph->resourceCount++;
+}
+
+uint32_t addRenderGraphImage(RenderGraph* graph, const char* name, VkImage image, VkImageAspectFlags aspectMask,
+    ResourceAccess initialAccess, ResourceAccess finalAccess) {
+    uint32_t resource = addRenderGraphResource(graph, name, initialAccess, finalAccess);
+    graph->resources[resource].image = image;
+    graph->resources[resource].aspectMask = aspectMask;
+
+    return resource;
+}
+
+// Transient image contents don't survive between graph executions, but previous execution (or previous image
+// aliasing the same memory) may still access it, so previousAccess is waited for before the first use.
+uint32_t addRenderGraphTransientImage(RenderGraph* graph, const char* name, VkImage image, VkImageAspectFlags aspectMask,
+    ResourceAccess previousAccess) {
+    uint32_t resource = addRenderGraphImage(graph, name, image, aspectMask, previousAccess, ACCESS_NONE);
+    graph->resources[resource].transient = true;
+
+    return resource;
+}
+
+uint32_t addRenderGraphBuffer(RenderGraph* graph, const char* name, VkBuffer buffer, ResourceAccess initialAccess, ResourceAccess finalAccess) {
+    uint32_t resource = addRenderGraphResource(graph, name, initialAccess, finalAccess);
+    graph->resources[resource].buffer = buffer;
+
+    return resource;
+}
+
+uint32_t addRenderGraphPass(RenderGraph* graph, const char* name, RenderGraphPassCallback callback, void* userData) {
+    if (graph->passCount >= RENDER_GRAPH_MAX_PASSES) {
+        LOG3DHW("[rendergraph] Too many passes (max: %d)!", RENDER_GRAPH_MAX_PASSES);
+        exit(-1);
+    }
+
+    RenderGraphPass* pass = &graph->passes[graph->passCount];
+    pass->name = name;
+    pass->accessCount = 0;
+    pass->callback = callback;
+    pass->userData = userData;
+    pass->culled = false;
+
+    return graph->passCount++;
+}
+
+// Each resource should be declared only once per pass, with the access covering everything the pass does with it
+void addRenderGraphPassAccess(RenderGraph* graph, uint32_t pass, uint32_t resource, ResourceAccess access) {
+    RenderGraphPass* renderGraphPass = &graph->passes[pass];
+    if (renderGraphPass->accessCount >= RENDER_GRAPH_MAX_PASS_ACCESSES) {
+        LOG3DHW("[rendergraph] Too many resource accesses in pass %s (max: %d)!", renderGraphPass->name, RENDER_GRAPH_MAX_PASS_ACCESSES);
+        exit(-1);
+    }
+
+    renderGraphPass->accesses[renderGraphPass->accessCount].resource = resource;
+    renderGraphPass->accesses[renderGraphPass->accessCount].access = access;
+    renderGraphPass->accessCount++;
+}
+
+static void clearBarrierBatch(RenderGraphBarrierBatch* batch) {
+    batch->srcStageMask = 0;
+    batch->dstStageMask = 0;
+    batch->memoryBarrier = (VkMemoryBarrier) { 0 };
+    batch->memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    batch->imageBarrierCount = 0;
+}
+
+// Host writes are made visible by queue submission, so only device writes preceding the graph
+// (e.g. from previous frame) have to be made available by barriers.
+static void initResourceState(const RenderGraphResource* resource, ResourceState* state) {
+    AccessInfo info = getAccessInfo(resource->initialAccess);
+    bool deviceWrite = info.write && resource->initialAccess != ACCESS_HOST_WRITE;
+
+    state->layout = resource->transient ? VK_IMAGE_LAYOUT_UNDEFINED : info.layout;
+    state->writeStages = info.write ? info.stageMask : 0;
+    state->writeAccess = deviceWrite ? (info.accessMask & WRITE_ACCESS_MASK) : 0;
+    state->readStages = info.write ? 0 : info.stageMask;
+    state->visibleStages = deviceWrite ? 0 : ~0u;
+    state->visibleAccess = deviceWrite ? 0 : ~0u;
+}
+
+// Adds barrier needed before given access to the batch. Returns false if access didn't need any barrier.
+static bool addAccessBarrier(const RenderGraphResource* resource, ResourceState* state, ResourceAccess access, RenderGraphBarrierBatch* batch) {
+    AccessInfo info = getAccessInfo(access);
+    bool layoutChange = resource->image != VK_NULL_HANDLE && state->layout != info.layout;
+
+    if (layoutChange || info.write) {
+        // Write-after-write and write-after-read hazards (and layout transitions, which are writes too)
+        // have to wait for all previous writers and readers
+        VkPipelineStageFlags srcStages = state->writeStages | state->readStages;
+        bool needed = layoutChange || srcStages != 0;
+
+        if (layoutChange) {
+            VkImageMemoryBarrier* imageBarrier = &batch->imageBarriers[batch->imageBarrierCount++];
+            *imageBarrier = (VkImageMemoryBarrier) { 0 };
+            imageBarrier->sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            imageBarrier->srcAccessMask = state->writeAccess;
+            imageBarrier->dstAccessMask = info.accessMask;
+            imageBarrier->oldLayout = state->layout;
+            imageBarrier->newLayout = info.layout;
+            imageBarrier->srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            imageBarrier->dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            imageBarrier->image = resource->image;
+            imageBarrier->subresourceRange.aspectMask = resource->aspectMask;
+            imageBarrier->subresourceRange.baseMipLevel = 0;
+            imageBarrier->subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
+            imageBarrier->subresourceRange.baseArrayLayer = 0;
+            imageBarrier->subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
+        } else if (needed) {
+            // Write-after-read only needs execution dependency, so memory barrier is extended just for previous writes
+            batch->memoryBarrier.srcAccessMask |= state->writeAccess;
+            batch->memoryBarrier.dstAccessMask |= state->writeAccess != 0 ? info.accessMask : 0;
+        }
+
+        if (needed) {
+            batch->srcStageMask |= srcStages;
+            batch->dstStageMask |= info.stageMask;
+        }
+
+        state->layout = info.layout;
+        state->writeStages = info.stageMask;
+        state->writeAccess = info.write ? (info.accessMask & WRITE_ACCESS_MASK) : 0;
+        state->readStages = 0;
+        state->visibleStages = info.stageMask;
+        state->visibleAccess = info.accessMask;
+
+        return needed;
+    }
+
+    // Read-after-read needs no barrier, read-after-write only once per reading stage and access
+    bool needed = state->writeStages != 0 &&
+        ((info.stageMask & ~state->visibleStages) != 0 || (info.accessMask & ~state->visibleAccess) != 0);
+
+    if (needed) {
+        batch->srcStageMask |= state->writeStages;
+        batch->dstStageMask |= info.stageMask;
+        batch->memoryBarrier.srcAccessMask |= state->writeAccess;
+        batch->memoryBarrier.dstAccessMask |= info.accessMask;
+
+        state->visibleStages |= info.stageMask;
+        state->visibleAccess |= info.accessMask;
+    }
+
+    state->readStages |= info.stageMask;
+
+    return needed;
+}
+
+// Culls passes which don't contribute to graph outputs and computes barriers executed before each remaining pass.
+// All barriers needed by a pass are merged into a single vkCmdPipelineBarrier() call.
+void compileRenderGraph(RenderGraph* graph) {
+    // Walk passes backwards, starting from resources which leave the graph (e.g. swapchain image).
+    // Pass is needed only if it writes a needed resource; everything needed pass touches is needed too.
+    bool resourceNeeded[RENDER_GRAPH_MAX_RESOURCES] = { false };
+    for (uint32_t i = 0; i < graph->resourceCount; i++) {
+        resourceNeeded[i] = graph->resources[i].finalAccess != ACCESS_NONE;
+    }
+
+    uint32_t culledPassCount = 0;
+    for (uint32_t i = graph->passCount; i-- > 0;) {
+        RenderGraphPass* pass = &graph->passes[i];
+
+        pass->culled = true;
+        for (uint32_t j = 0; j < pass->accessCount; j++) {
+            if (getAccessInfo(pass->accesses[j].access).write && resourceNeeded[pass->accesses[j].resource]) {
+                pass->culled = false;
+            }
+        }
+
+        if (pass->culled) {
+            culledPassCount++;
+            LOG3DHW("[rendergraph] Culled pass %s (outputs unused)", pass->name);
+            continue;
+        }
+
+        for (uint32_t j = 0; j < pass->accessCount; j++) {
+            resourceNeeded[pass->accesses[j].resource] = true;
+        }
+    }
+
+    ResourceState states[RENDER_GRAPH_MAX_RESOURCES];
+    for (uint32_t i = 0; i < graph->resourceCount; i++) {
+        initResourceState(&graph->resources[i], &states[i]);
+    }
+
+    uint32_t barrierCount = 0;
+    uint32_t droppedBarrierCount = 0;
+    for (uint32_t i = 0; i < graph->passCount; i++) {
+        RenderGraphPass* pass = &graph->passes[i];
+        clearBarrierBatch(&pass->barriers);
+
+        if (pass->culled) {
+            continue;
+        }
+
+        for (uint32_t j = 0; j < pass->accessCount; j++) {
+            uint32_t resource = pass->accesses[j].resource;
+            if (addAccessBarrier(&graph->resources[resource], &states[resource], pass->accesses[j].access, &pass->barriers)) {
+                barrierCount++;
+            } else {
+                droppedBarrierCount++;
+            }
+        }
+    }
+
+    // Leave resources in state expected after the graph
+    clearBarrierBatch(&graph->finalBarriers);
+    for (uint32_t i = 0; i < graph->resourceCount; i++) {
+        if (graph->resources[i].finalAccess != ACCESS_NONE) {
+            if (addAccessBarrier(&graph->resources[i], &states[i], graph->resources[i].finalAccess, &graph->finalBarriers)) {
+                barrierCount++;
+            } else {
+                droppedBarrierCount++;
+            }
+        }
+    }
+
+    LOG3DHW("[rendergraph] Compiled render graph: %d passes (%d culled), %d barriers (%d redundant dropped)",
+        graph->passCount, culledPassCount, barrierCount, droppedBarrierCount);
+}
+
+static void executeBarrierBatch(const RenderGraphBarrierBatch* batch, VkCommandBuffer commandBuffer) {
+    if (batch->srcStageMask == 0 && batch->dstStageMask == 0 && batch->imageBarrierCount == 0) {
+        return;
+    }
+
+    bool memoryBarrierNeeded = batch->memoryBarrier.srcAccessMask != 0 || batch->memoryBarrier.dstAccessMask != 0;
+
+    vkCmdPipelineBarrier(commandBuffer,
+        batch->srcStageMask != 0 ? batch->srcStageMask : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+        batch->dstStageMask != 0 ? batch->dstStageMask : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+        0,
+        memoryBarrierNeeded ? 1 : 0, &batch->memoryBarrier,
+        0, NULL,
+        batch->imageBarrierCount, batch->imageBarriers);
+}
+
+void executeRenderGraph(VulkanData* vkData, RenderGraph* graph, VkCommandBuffer commandBuffer, uint32_t imageIndex) {
+    for (uint32_t i = 0; i < graph->passCount; i++) {
+        RenderGraphPass* pass = &graph->passes[i];
+        if (pass->culled) {
+            continue;
+        }
+
+        executeBarrierBatch(&pass->barriers, commandBuffer);
+        pass->callback(vkData, commandBuffer, imageIndex, pass->userData);
+    }
+
+    executeBarrierBatch(&graph->finalBarriers, commandBuffer);
+}
@@ -53,4 +53,18 @@ void createShaderModules(VulkanData *vkData, VkShaderModule *vertexShaderModule,
     }
 
     LOG3DHW("[shader] Created vertex and fragment shader modules")
-}
\ No newline at end of file
+}
+
+// Creates single shader module from SPIR-V bytes, for shaders other than the main vertex/fragment pair
+void createShaderModule(VulkanData* vkData, const char* shaderBytes, size_t shaderBytesLen, VkShaderModule* shaderModule) {
+    VkResult vkr;
+
+    VkShaderModuleCreateInfo shaderModuleCreateInfo = { 0 };
+    shaderModuleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    shaderModuleCreateInfo.codeSize = shaderBytesLen;
+    shaderModuleCreateInfo.pCode = (const uint32_t *) shaderBytes;
+    if ((vkr = vkCreateShaderModule(vkData->device, &shaderModuleCreateInfo, NULL, shaderModule)) != VK_SUCCESS) {
+        LOG3DHW("[shader] Failed creating shader module (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+}
@@ -11,6 +11,9 @@
 #include "swapchain.h"
 #include "vkdata.h"
 #include "buffers.h"
+#include "commands.h"
+#include "transient.h"
+#include "postprocess.h"
 #include "utils.h"
 #include "vkdebug.h"
 
@@ -143,7 +146,13 @@ void createSwapchainAndImageViews(VulkanData* vkData, uint32_t width, uint32_t h
     swapchainCreateInfo.imageColorSpace = suitableSurfaceFormat.colorSpace;
     swapchainCreateInfo.imageExtent = extent;
     swapchainCreateInfo.imageArrayLayers = 1;
-    swapchainCreateInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    // Swapchain image is written by blit from post processed color (see recordPresentPass()) when surface
+    // allows it, otherwise post pass renders into it as color attachment
+    VkFormatProperties formatProperties;
+    vkGetPhysicalDeviceFormatProperties(vkData->physicalDevice, suitableSurfaceFormat.format, &formatProperties);
+    vkData->presentByBlit = (surfaceCapabilities.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_DST_BIT) != 0
+        && (formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_BLIT_DST_BIT) != 0;
+    swapchainCreateInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | (vkData->presentByBlit ? VK_IMAGE_USAGE_TRANSFER_DST_BIT : 0);
     swapchainCreateInfo.imageSharingMode = imageSharingMode;
     swapchainCreateInfo.preTransform = surfaceCapabilities.currentTransform;
     swapchainCreateInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
@@ -158,7 +167,7 @@ void createSwapchainAndImageViews(VulkanData* vkData, uint32_t width, uint32_t h
         exit(-1);
     }
 
-    LOG3DHW("[swapchain] Created swapchain");
+    LOG3DHW("[swapchain] Created swapchain (%s)", vkData->presentByBlit ? "present by blit" : "post pass renders into swapchain images");
 
     uint32_t swapchainImageCount;
     if ((vkr = vkGetSwapchainImagesKHR(vkData->device, swapchain, &swapchainImageCount, NULL)) != VK_SUCCESS) {
@@ -204,21 +213,26 @@ void createSwapchainAndImageViews(VulkanData* vkData, uint32_t width, uint32_t h
 
     free(surfaceFormats);
     free(presentModes);
+
+    // Intermediate render targets match swapchain extent
+    createTransientImages(vkData);
 }
 
 void createFramebuffers(VulkanData* vkData) {
     VkResult vkr;
     VkFramebuffer* framebuffers = (VkFramebuffer*) malloc(vkData->imageCount * sizeof(VkFramebuffer));
     for (uint32_t i = 0; i < vkData->imageCount; i++) {
-        VkImageView attachments = {
-            vkData->imageViews[i]
+        VkImageView attachments[] = {
+            // Main pass renders into intermediate scene color, so all framebuffers are identical
+            vkData->sceneColorImageView,
+            vkData->depthImageView // shared by all framebuffers, only one frame renders at the time
         };
 
         VkFramebufferCreateInfo framebufferCreateInfo = { 0 };
         framebufferCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
         framebufferCreateInfo.renderPass = vkData->renderPass;
-        framebufferCreateInfo.attachmentCount = 1;
-        framebufferCreateInfo.pAttachments = &attachments;
+        framebufferCreateInfo.attachmentCount = ARRAY_SIZE(attachments);
+        framebufferCreateInfo.pAttachments = attachments;
         framebufferCreateInfo.width = vkData->extent.width;
         framebufferCreateInfo.height = vkData->extent.height;
         framebufferCreateInfo.layers = 1;
@@ -239,8 +253,8 @@ void cleanupSwapchain(VulkanData* vkData) {
     }
     LOG3DHW("[swapchain] Destroyed framebuffers");
 
-    vkFreeCommandBuffers(vkData->device, vkData->commandPool, vkData->imageCount, vkData->commandBuffers);
-    LOG3DHW("[swapchain] Destroyed command buffers");
+    destroyFrameCommandBuffers(vkData);
+    LOG3DHW("[swapchain] Destroyed frame command pools and buffers");
 
     vkDestroyPipeline(vkData->device, vkData->pipeline, NULL);
     LOG3DHW("[swapchain] Destroyed pipeline");
@@ -251,6 +265,9 @@ void cleanupSwapchain(VulkanData* vkData) {
     vkDestroyRenderPass(vkData->device, vkData->renderPass, NULL);
     LOG3DHW("[swapchain] Destroyed render pass");
 
+    destroyPostProcessing(vkData);
+    destroyTransientImages(vkData);
+
     for (uint32_t i = 0; i < vkData->imageCount; i++) {
         vkDestroyImageView(vkData->device, vkData->imageViews[i], NULL);
     }
@@ -260,7 +277,6 @@ void cleanupSwapchain(VulkanData* vkData) {
     LOG3DHW("[swapchain] Destroyed swapchain");
 
     free(vkData->framebuffers);
-    free(vkData->commandBuffers);
     free(vkData->imageViews);
     free(vkData->images);
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include "vkdata.h"
 #include "utils.h"
 #include "buffers.h"
+#include "rendergraph.h"
 #include "vkdebug.h"
 
 static VkCommandBuffer beginCommandBuffer(VulkanData* vkData) {
@@ -69,16 +70,17 @@ static void copyBuffer(VulkanData* vkData, VkBuffer srcBuffer, VkBuffer dstBuffe
     endCommandBuffer(vkData, commandBuffer);
 }
 
-static void transitionImageLayout(VulkanData* vkData, VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout) {
+static void transitionImageLayout(VulkanData* vkData, VkImage image, ResourceAccess oldAccess, ResourceAccess newAccess) {
     VkCommandBuffer commandBuffer = beginCommandBuffer(vkData);
 
-    VkPipelineStageFlags srcStage;
-    VkPipelineStageFlags dstStage;
+    // Stages, access masks and layouts are derived from accesses, same way as render graph does it
+    AccessInfo oldAccessInfo = getAccessInfo(oldAccess);
+    AccessInfo newAccessInfo = getAccessInfo(newAccess);
 
     VkImageMemoryBarrier imageMemoryBarrier = { 0 };
     imageMemoryBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-    imageMemoryBarrier.oldLayout = oldLayout;
-    imageMemoryBarrier.newLayout = newLayout;
+    imageMemoryBarrier.oldLayout = oldAccessInfo.layout;
+    imageMemoryBarrier.newLayout = newAccessInfo.layout;
     imageMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
     imageMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
     imageMemoryBarrier.image = image;
@@ -87,22 +89,11 @@ static void transitionImageLayout(VulkanData* vkData, VkImage image, VkFormat fo
     imageMemoryBarrier.subresourceRange.levelCount = 1;
     imageMemoryBarrier.subresourceRange.baseArrayLayer = 0;
     imageMemoryBarrier.subresourceRange.layerCount = 1;
-    if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) {
-        imageMemoryBarrier.srcAccessMask = 0;
-        imageMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-
-        srcStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-        dstStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-    } else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
-        imageMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        imageMemoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-        srcStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-        dstStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-    } else {
-        LOG3DHW("[texture] Unsupported layout transition!");
-        exit(-1);
-    }
+    imageMemoryBarrier.srcAccessMask = oldAccessInfo.write ? oldAccessInfo.accessMask : 0;
+    imageMemoryBarrier.dstAccessMask = newAccessInfo.accessMask;
+
+    VkPipelineStageFlags srcStage = oldAccessInfo.stageMask != 0 ? oldAccessInfo.stageMask : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+    VkPipelineStageFlags dstStage = newAccessInfo.stageMask;
 
     vkCmdPipelineBarrier(commandBuffer, srcStage, dstStage, 0, 0, NULL, 0, NULL, 1, &imageMemoryBarrier);
 
@@ -200,13 +191,11 @@ void createTextureImage(VulkanData* vkData, const char* textureFilename) {
         exit(-1);
     }
 
-    transitionImageLayout(vkData, vkData->textureImage, VK_FORMAT_R8G8B8A8_UNORM,
-        VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    transitionImageLayout(vkData, vkData->textureImage, ACCESS_NONE, ACCESS_TRANSFER_WRITE);
 
     copyBufferToImage(vkData, stagingBuffer, vkData->textureImage, width, height);
 
-    transitionImageLayout(vkData, vkData->textureImage, VK_FORMAT_R8G8B8A8_UNORM,
-        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    transitionImageLayout(vkData, vkData->textureImage, ACCESS_TRANSFER_WRITE, ACCESS_FRAGMENT_SHADER_READ);
 
     vkDestroyBuffer(vkData->device, stagingBuffer, NULL);
     vkFreeMemory(vkData->device, stagingBufferMemory, NULL);
@@ -0,0 +1,575 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <math.h>
+#include <vulkan/vulkan.h>
+
+#include "thumbnails.h"
+#include "vkdata.h"
+#include "device.h"
+#include "buffers.h"
+#include "pipeline.h"
+#include "shader.h"
+#include "texture.h"
+#include "rendergraph.h"
+#include "utils.h"
+#include "linmath.h"
+#include "vkdebug.h"
+
+// Offscreen resources for rendering a batch of views into layers of single array image.
+// With VK_KHR_multiview all layers are rendered by one render pass (the driver broadcasts each draw to every view),
+// without it we fall back to one render pass per layer, passing view index in push constant.
+typedef struct ThumbnailRenderer {
+    uint32_t viewCount; // views (array layers) rendered by one batch
+    bool multiview;
+
+    VkImage colorImage;
+    VkDeviceMemory colorImageMemory;
+    VkImage depthImage;
+    VkDeviceMemory depthImageMemory;
+    // Multiview uses single framebuffer with 2D array views, fallback one framebuffer with 2D views per layer
+    VkImageView colorImageViews[MULTIVIEW_MAX_VIEWS];
+    VkImageView depthImageViews[MULTIVIEW_MAX_VIEWS];
+    VkFramebuffer framebuffers[MULTIVIEW_MAX_VIEWS];
+    uint32_t framebufferCount;
+
+    VkRenderPass renderPass;
+    VkPipelineLayout pipelineLayout;
+    VkPipeline pipeline;
+    VkDescriptorPool descriptorPool;
+    VkDescriptorSet descriptorSet;
+    VkBuffer uniformBuffer;
+    VkDeviceMemory uniformBufferMemory;
+    VkBuffer readbackBuffer;
+    VkDeviceMemory readbackBufferMemory;
+    VkCommandBuffer commandBuffer;
+} ThumbnailRenderer;
+
+static void createLayeredImage(VulkanData* vkData, VkFormat format, VkImageUsageFlags usage, uint32_t layerCount,
+    VkImage* image, VkDeviceMemory* imageMemory) {
+    VkResult vkr;
+
+    VkImageCreateInfo imageCreateInfo = { 0 };
+    imageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageCreateInfo.extent.width = THUMBNAIL_SIZE;
+    imageCreateInfo.extent.height = THUMBNAIL_SIZE;
+    imageCreateInfo.extent.depth = 1;
+    imageCreateInfo.mipLevels = 1;
+    imageCreateInfo.arrayLayers = layerCount;
+    imageCreateInfo.format = format;
+    imageCreateInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    imageCreateInfo.usage = usage;
+    imageCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    if ((vkr = vkCreateImage(vkData->device, &imageCreateInfo, NULL, image)) != VK_SUCCESS) {
+        LOG3DHW("[thumbnails] Failed creating image (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    VkMemoryRequirements memoryRequirements;
+    vkGetImageMemoryRequirements(vkData->device, *image, &memoryRequirements);
+
+    // Transient attachments (depth) don't need physical memory on tile based GPUs
+    uint32_t memoryIndex;
+    if ((usage & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT) == 0 ||
+        !tryFindMemoryIndex(vkData, memoryRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT, &memoryIndex)) {
+        memoryIndex = findMemoryIndex(vkData, memoryRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    }
+
+    VkMemoryAllocateInfo memoryAllocateInfo = { 0 };
+    memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    memoryAllocateInfo.allocationSize = memoryRequirements.size;
+    memoryAllocateInfo.memoryTypeIndex = memoryIndex;
+    if ((vkr = vkAllocateMemory(vkData->device, &memoryAllocateInfo, NULL, imageMemory)) != VK_SUCCESS) {
+        LOG3DHW("[thumbnails] Failed allocating image memory (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    vkBindImageMemory(vkData->device, *image, *imageMemory, 0);
+}
+
+static VkImageView createLayerView(VulkanData* vkData, VkImage image, VkFormat format, VkImageAspectFlags aspectMask,
+    VkImageViewType viewType, uint32_t baseLayer, uint32_t layerCount) {
+    VkResult vkr;
+
+    VkImageViewCreateInfo imageViewCreateInfo = { 0 };
+    imageViewCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    imageViewCreateInfo.image = image;
+    imageViewCreateInfo.viewType = viewType;
+    imageViewCreateInfo.format = format;
+    imageViewCreateInfo.subresourceRange.aspectMask = aspectMask;
+    imageViewCreateInfo.subresourceRange.baseMipLevel = 0;
+    imageViewCreateInfo.subresourceRange.levelCount = 1;
+    imageViewCreateInfo.subresourceRange.baseArrayLayer = baseLayer;
+    imageViewCreateInfo.subresourceRange.layerCount = layerCount;
+
+    VkImageView imageView;
+    if ((vkr = vkCreateImageView(vkData->device, &imageViewCreateInfo, NULL, &imageView)) != VK_SUCCESS) {
+        LOG3DHW("[thumbnails] Failed creating image view (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    return imageView;
+}
+
+static void createThumbnailRenderPass(VulkanData* vkData, ThumbnailRenderer* renderer) {
+    VkResult vkr;
+
+    // Same attachments as the main render pass, except color is stored for readback instead of presenting
+    VkAttachmentDescription colorAttachment = { 0 };
+    colorAttachment.format = THUMBNAIL_FORMAT;
+    colorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    colorAttachment.initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    VkAttachmentReference colorAttachmentReference = { 0 };
+    colorAttachmentReference.attachment = 0;
+    colorAttachmentReference.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    VkAttachmentDescription depthAttachment = { 0 };
+    depthAttachment.format = vkData->depthFormat;
+    depthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    depthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    depthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    depthAttachment.initialLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+    depthAttachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+    VkAttachmentReference depthAttachmentReference = { 0 };
+    depthAttachmentReference.attachment = 1;
+    depthAttachmentReference.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+    VkSubpassDescription subpass = { 0 };
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &colorAttachmentReference;
+    subpass.pDepthStencilAttachment = &depthAttachmentReference;
+
+    VkAttachmentDescription attachments[] = {
+        colorAttachment, depthAttachment
+    };
+
+    // Subpass is rendered once for every bit set in view mask. Correlation mask tells the driver views are
+    // spatially close to each other, so it may share work (e.g. visibility) between them.
+    uint32_t viewMask = (1u << renderer->viewCount) - 1;
+    VkRenderPassMultiviewCreateInfoKHR renderPassMultiviewCreateInfo = { 0 };
+    renderPassMultiviewCreateInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO_KHR;
+    renderPassMultiviewCreateInfo.subpassCount = 1;
+    renderPassMultiviewCreateInfo.pViewMasks = &viewMask;
+    renderPassMultiviewCreateInfo.correlationMaskCount = 1;
+    renderPassMultiviewCreateInfo.pCorrelationMasks = &viewMask;
+
+    VkRenderPassCreateInfo renderPassCreateInfo = { 0 };
+    renderPassCreateInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassCreateInfo.pNext = renderer->multiview ? &renderPassMultiviewCreateInfo : NULL;
+    renderPassCreateInfo.attachmentCount = ARRAY_SIZE(attachments);
+    renderPassCreateInfo.pAttachments = attachments;
+    renderPassCreateInfo.subpassCount = 1;
+    renderPassCreateInfo.pSubpasses = &subpass;
+    if ((vkr = vkCreateRenderPass(vkData->device, &renderPassCreateInfo, NULL, &renderer->renderPass)) != VK_SUCCESS) {
+        LOG3DHW("[thumbnails] Failed creating render pass (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+}
+
+static void createThumbnailFramebuffers(VulkanData* vkData, ThumbnailRenderer* renderer) {
+    VkResult vkr;
+
+    createLayeredImage(vkData, THUMBNAIL_FORMAT, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+        renderer->viewCount, &renderer->colorImage, &renderer->colorImageMemory);
+    createLayeredImage(vkData, vkData->depthFormat, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT,
+        renderer->viewCount, &renderer->depthImage, &renderer->depthImageMemory);
+
+    // Multiview framebuffer has single layer, views are selected by view mask of the render pass
+    renderer->framebufferCount = renderer->multiview ? 1 : renderer->viewCount;
+    for (uint32_t i = 0; i < renderer->framebufferCount; i++) {
+        if (renderer->multiview) {
+            renderer->colorImageViews[i] = createLayerView(vkData, renderer->colorImage, THUMBNAIL_FORMAT, VK_IMAGE_ASPECT_COLOR_BIT,
+                VK_IMAGE_VIEW_TYPE_2D_ARRAY, 0, renderer->viewCount);
+            renderer->depthImageViews[i] = createLayerView(vkData, renderer->depthImage, vkData->depthFormat, VK_IMAGE_ASPECT_DEPTH_BIT,
+                VK_IMAGE_VIEW_TYPE_2D_ARRAY, 0, renderer->viewCount);
+        } else {
+            renderer->colorImageViews[i] = createLayerView(vkData, renderer->colorImage, THUMBNAIL_FORMAT, VK_IMAGE_ASPECT_COLOR_BIT,
+                VK_IMAGE_VIEW_TYPE_2D, i, 1);
+            renderer->depthImageViews[i] = createLayerView(vkData, renderer->depthImage, vkData->depthFormat, VK_IMAGE_ASPECT_DEPTH_BIT,
+                VK_IMAGE_VIEW_TYPE_2D, i, 1);
+        }
+
+        VkImageView attachments[] = {
+            renderer->colorImageViews[i], renderer->depthImageViews[i]
+        };
+
+        VkFramebufferCreateInfo framebufferCreateInfo = { 0 };
+        framebufferCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        framebufferCreateInfo.renderPass = renderer->renderPass;
+        framebufferCreateInfo.attachmentCount = ARRAY_SIZE(attachments);
+        framebufferCreateInfo.pAttachments = attachments;
+        framebufferCreateInfo.width = THUMBNAIL_SIZE;
+        framebufferCreateInfo.height = THUMBNAIL_SIZE;
+        framebufferCreateInfo.layers = 1;
+        if ((vkr = vkCreateFramebuffer(vkData->device, &framebufferCreateInfo, NULL, &renderer->framebuffers[i])) != VK_SUCCESS) {
+            LOG3DHW("[thumbnails] Failed creating framebuffer (result: %s)!", mapVkResultToString(vkr));
+            exit(-1);
+        }
+    }
+}
+
+static void createThumbnailPipeline(VulkanData* vkData, ThumbnailRenderer* renderer) {
+    VkResult vkr;
+
+    // Fallback shader reads view index from push constant
+    VkPushConstantRange pushConstantRange = { 0 };
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = sizeof(uint32_t);
+
+    VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo = { 0 };
+    pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutCreateInfo.setLayoutCount = 1;
+    pipelineLayoutCreateInfo.pSetLayouts = &vkData->descriptorSetLayout;
+    pipelineLayoutCreateInfo.pushConstantRangeCount = renderer->multiview ? 0 : 1;
+    pipelineLayoutCreateInfo.pPushConstantRanges = renderer->multiview ? NULL : &pushConstantRange;
+    if ((vkr = vkCreatePipelineLayout(vkData->device, &pipelineLayoutCreateInfo, NULL, &renderer->pipelineLayout)) != VK_SUCCESS) {
+        LOG3DHW("[thumbnails] Failed creating pipeline layout (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    // Only vertex shader differs from the main pipeline (it picks per-view matrices), fragment shader is shared
+    char* vertexShaderBytes;
+    size_t vertexShaderLength;
+    loadShaderFromFile(renderer->multiview ? "thumbnail_multiview.spv" : "thumbnail_layered.spv", &vertexShaderBytes, &vertexShaderLength);
+
+    VkShaderModule vertexShaderModule;
+    VkShaderModule fragmentShaderModule;
+    createShaderModule(vkData, vertexShaderBytes, vertexShaderLength, &vertexShaderModule);
+    createShaderModule(vkData, vkData->fragmentShaderBytes, vkData->fragmentShaderLength, &fragmentShaderModule);
+
+    VkExtent2D extent = { THUMBNAIL_SIZE, THUMBNAIL_SIZE };
+    createOffscreenGraphicsPipeline(vkData, renderer->renderPass, renderer->pipelineLayout, extent,
+        vertexShaderModule, fragmentShaderModule, &renderer->pipeline);
+
+    vkDestroyShaderModule(vkData->device, fragmentShaderModule, NULL);
+    vkDestroyShaderModule(vkData->device, vertexShaderModule, NULL);
+    free(vertexShaderBytes);
+}
+
+static void createThumbnailDescriptorSet(VulkanData* vkData, ThumbnailRenderer* renderer) {
+    VkResult vkr;
+
+    createBuffer(vkData, sizeof(MultiviewUniformBufferObject), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+        &renderer->uniformBuffer, &renderer->uniformBufferMemory);
+
+    VkDescriptorPoolSize descriptorPoolSizes[3] = { 0 };
+    descriptorPoolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    descriptorPoolSizes[0].descriptorCount = 1;
+    descriptorPoolSizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    descriptorPoolSizes[1].descriptorCount = 1;
+    descriptorPoolSizes[2].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    descriptorPoolSizes[2].descriptorCount = 2;
+
+    VkDescriptorPoolCreateInfo descriptorPoolCreateInfo = { 0 };
+    descriptorPoolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    descriptorPoolCreateInfo.poolSizeCount = ARRAY_SIZE(descriptorPoolSizes);
+    descriptorPoolCreateInfo.pPoolSizes = descriptorPoolSizes;
+    descriptorPoolCreateInfo.maxSets = 1;
+    if ((vkr = vkCreateDescriptorPool(vkData->device, &descriptorPoolCreateInfo, NULL, &renderer->descriptorPool)) != VK_SUCCESS) {
+        LOG3DHW("[thumbnails] Failed creating descriptor pool (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    // Layout is shared with the main pipeline, binding 0 just holds bigger uniform buffer. Thumbnail shaders
+    // always take vertices from vertex input, so vertex pulling bindings (2 and 3) are left unwritten.
+    VkDescriptorSetAllocateInfo descriptorSetAllocateInfo = { 0 };
+    descriptorSetAllocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    descriptorSetAllocateInfo.descriptorPool = renderer->descriptorPool;
+    descriptorSetAllocateInfo.descriptorSetCount = 1;
+    descriptorSetAllocateInfo.pSetLayouts = &vkData->descriptorSetLayout;
+    if ((vkr = vkAllocateDescriptorSets(vkData->device, &descriptorSetAllocateInfo, &renderer->descriptorSet)) != VK_SUCCESS) {
+        LOG3DHW("[thumbnails] Failed allocating descriptor set (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    VkDescriptorBufferInfo descriptorBufferInfo = { 0 };
+    descriptorBufferInfo.buffer = renderer->uniformBuffer;
+    descriptorBufferInfo.offset = 0;
+    descriptorBufferInfo.range = sizeof(MultiviewUniformBufferObject);
+
+    VkDescriptorImageInfo descriptorImageInfo = { 0 };
+    descriptorImageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    descriptorImageInfo.imageView = vkData->textureImageView;
+    descriptorImageInfo.sampler = vkData->textureSampler;
+
+    VkWriteDescriptorSet writeDescriptorSets[2] = { 0 };
+    writeDescriptorSets[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writeDescriptorSets[0].dstSet = renderer->descriptorSet;
+    writeDescriptorSets[0].dstBinding = 0;
+    writeDescriptorSets[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    writeDescriptorSets[0].descriptorCount = 1;
+    writeDescriptorSets[0].pBufferInfo = &descriptorBufferInfo;
+    writeDescriptorSets[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writeDescriptorSets[1].dstSet = renderer->descriptorSet;
+    writeDescriptorSets[1].dstBinding = 1;
+    writeDescriptorSets[1].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    writeDescriptorSets[1].descriptorCount = 1;
+    writeDescriptorSets[1].pImageInfo = &descriptorImageInfo;
+
+    vkUpdateDescriptorSets(vkData->device, ARRAY_SIZE(writeDescriptorSets), writeDescriptorSets, 0, NULL);
+}
+
+static void recordThumbnailPass(VulkanData* vkData, VkCommandBuffer commandBuffer, uint32_t imageIndex, void* userData) {
+    ThumbnailRenderer* renderer = (ThumbnailRenderer*) userData;
+
+    VkClearValue clearValues[2] = { 0 };
+    VkClearColorValue clearColorValue = { { (99.f / 255.f), (139.f / 255.f), (235.f / 255.f), 1.f } };
+    clearValues[0].color = clearColorValue;
+    clearValues[1].depthStencil.depth = 1.f;
+
+    // Bound state persists between render passes of the same command buffer
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, renderer->pipeline);
+    VkDeviceSize bufferOffset = 0;
+    vkCmdBindVertexBuffers(commandBuffer, 0, 1, &vkData->vertexBuffer, &bufferOffset);
+    vkCmdBindIndexBuffer(commandBuffer, vkData->indexBuffer, 0, vkData->indexType);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, renderer->pipelineLayout, 0, 1, &renderer->descriptorSet, 0, NULL);
+
+    for (uint32_t i = 0; i < renderer->framebufferCount; i++) {
+        VkRenderPassBeginInfo renderPassBeginInfo = { 0 };
+        renderPassBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+        renderPassBeginInfo.framebuffer = renderer->framebuffers[i];
+        renderPassBeginInfo.renderPass = renderer->renderPass;
+        renderPassBeginInfo.renderArea.extent.width = THUMBNAIL_SIZE;
+        renderPassBeginInfo.renderArea.extent.height = THUMBNAIL_SIZE;
+        renderPassBeginInfo.clearValueCount = ARRAY_SIZE(clearValues);
+        renderPassBeginInfo.pClearValues = clearValues;
+
+        vkCmdBeginRenderPass(commandBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+        if (!renderer->multiview) {
+            vkCmdPushConstants(commandBuffer, renderer->pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(uint32_t), &i);
+        }
+        vkCmdDrawIndexed(commandBuffer, vkData->indexCount, 1, 0, 0, 0);
+        vkCmdEndRenderPass(commandBuffer);
+    }
+}
+
+static void recordReadbackPass(VulkanData* vkData, VkCommandBuffer commandBuffer, uint32_t imageIndex, void* userData) {
+    ThumbnailRenderer* renderer = (ThumbnailRenderer*) userData;
+
+    // Layers are tightly packed one after another in the buffer
+    VkBufferImageCopy region = { 0 };
+    region.bufferOffset = 0;
+    region.bufferRowLength = 0;
+    region.bufferImageHeight = 0;
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.mipLevel = 0;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount = renderer->viewCount;
+    region.imageExtent.width = THUMBNAIL_SIZE;
+    region.imageExtent.height = THUMBNAIL_SIZE;
+    region.imageExtent.depth = 1;
+
+    vkCmdCopyImageToBuffer(commandBuffer, renderer->colorImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, renderer->readbackBuffer, 1, &region);
+}
+
+// Every batch renders the same commands, only uniform buffer contents change, so command buffer is recorded once
+static void recordThumbnailCommandBuffer(VulkanData* vkData, ThumbnailRenderer* renderer) {
+    VkResult vkr;
+
+    VkCommandBufferAllocateInfo commandBufferAllocateInfo = { 0 };
+    commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferAllocateInfo.commandPool = vkData->commandPool;
+    commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    commandBufferAllocateInfo.commandBufferCount = 1;
+    if ((vkr = vkAllocateCommandBuffers(vkData->device, &commandBufferAllocateInfo, &renderer->commandBuffer)) != VK_SUCCESS) {
+        LOG3DHW("[thumbnails] Failed allocating command buffer (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    VkCommandBufferBeginInfo commandBufferBeginInfo = { 0 };
+    commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    if ((vkr = vkBeginCommandBuffer(renderer->commandBuffer, &commandBufferBeginInfo)) != VK_SUCCESS) {
+        LOG3DHW("[thumbnails] Failed beginning command buffer (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+
+    // Batches are separated by waiting for idle queue, so color and depth images start undefined every time
+    // and readback buffer only has to be made visible to the host at the end
+    RenderGraph graph;
+    initRenderGraph(&graph);
+
+    uint32_t colorImage = addRenderGraphTransientImage(&graph, "thumbnail color", renderer->colorImage, VK_IMAGE_ASPECT_COLOR_BIT, ACCESS_NONE);
+    uint32_t depthImage = addRenderGraphTransientImage(&graph, "thumbnail depth", renderer->depthImage, VK_IMAGE_ASPECT_DEPTH_BIT, ACCESS_NONE);
+    uint32_t textureImage = addRenderGraphImage(&graph, "texture", vkData->textureImage, VK_IMAGE_ASPECT_COLOR_BIT,
+        ACCESS_FRAGMENT_SHADER_READ, ACCESS_NONE);
+    uint32_t vertexBuffer = addRenderGraphBuffer(&graph, "vertex buffer", vkData->vertexBuffer, ACCESS_HOST_WRITE, ACCESS_NONE);
+    uint32_t indexBuffer = addRenderGraphBuffer(&graph, "index buffer", vkData->indexBuffer, ACCESS_HOST_WRITE, ACCESS_NONE);
+    uint32_t uniformBuffer = addRenderGraphBuffer(&graph, "thumbnail uniform buffer", renderer->uniformBuffer, ACCESS_HOST_WRITE, ACCESS_NONE);
+    uint32_t readbackBuffer = addRenderGraphBuffer(&graph, "thumbnail readback buffer", renderer->readbackBuffer, ACCESS_NONE, ACCESS_HOST_READ);
+
+    uint32_t thumbnailPass = addRenderGraphPass(&graph, "thumbnails", recordThumbnailPass, renderer);
+    addRenderGraphPassAccess(&graph, thumbnailPass, colorImage, ACCESS_COLOR_ATTACHMENT_WRITE);
+    addRenderGraphPassAccess(&graph, thumbnailPass, depthImage, ACCESS_DEPTH_ATTACHMENT_WRITE);
+    addRenderGraphPassAccess(&graph, thumbnailPass, textureImage, ACCESS_FRAGMENT_SHADER_READ);
+    addRenderGraphPassAccess(&graph, thumbnailPass, vertexBuffer, ACCESS_VERTEX_BUFFER_READ);
+    addRenderGraphPassAccess(&graph, thumbnailPass, indexBuffer, ACCESS_INDEX_BUFFER_READ);
+    addRenderGraphPassAccess(&graph, thumbnailPass, uniformBuffer, ACCESS_UNIFORM_READ);
+
+    uint32_t readbackPass = addRenderGraphPass(&graph, "thumbnail readback", recordReadbackPass, renderer);
+    addRenderGraphPassAccess(&graph, readbackPass, colorImage, ACCESS_TRANSFER_READ);
+    addRenderGraphPassAccess(&graph, readbackPass, readbackBuffer, ACCESS_TRANSFER_WRITE);
+
+    compileRenderGraph(&graph);
+    executeRenderGraph(vkData, &graph, renderer->commandBuffer, 0);
+
+    if ((vkr = vkEndCommandBuffer(renderer->commandBuffer)) != VK_SUCCESS) {
+        LOG3DHW("[thumbnails] Failed ending command buffer (result: %s)!", mapVkResultToString(vkr));
+        exit(-1);
+    }
+}
+
+static void createThumbnailRenderer(VulkanData* vkData, uint32_t thumbnailCount, ThumbnailRenderer* renderer) {
+    // Single multiview render pass can't render more views than the device supports
+    renderer->multiview = vkData->multiviewSupported;
+    renderer->viewCount = MULTIVIEW_MAX_VIEWS;
+    if (renderer->multiview && vkData->maxMultiviewViewCount < renderer->viewCount) {
+        renderer->viewCount = vkData->maxMultiviewViewCount;
+    }
+    if (thumbnailCount < renderer->viewCount) {
+        renderer->viewCount = thumbnailCount;
+    }
+
+    createThumbnailRenderPass(vkData, renderer);
+    createThumbnailFramebuffers(vkData, renderer);
+    createThumbnailPipeline(vkData, renderer);
+    createThumbnailDescriptorSet(vkData, renderer);
+    createBuffer(vkData, (VkDeviceSize) renderer->viewCount * THUMBNAIL_SIZE * THUMBNAIL_SIZE * 4, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+        &renderer->readbackBuffer, &renderer->readbackBufferMemory);
+    recordThumbnailCommandBuffer(vkData, renderer);
+
+    LOG3DHW("[thumbnails] Created thumbnail renderer (%d views per batch, %s)", renderer->viewCount,
+        renderer->multiview ? "multiview" : "render pass per layer");
+}
+
+static void destroyThumbnailRenderer(VulkanData* vkData, ThumbnailRenderer* renderer) {
+    vkFreeCommandBuffers(vkData->device, vkData->commandPool, 1, &renderer->commandBuffer);
+    destroyBuffer(vkData, renderer->readbackBuffer, renderer->readbackBufferMemory);
+    destroyBuffer(vkData, renderer->uniformBuffer, renderer->uniformBufferMemory);
+    vkDestroyDescriptorPool(vkData->device, renderer->descriptorPool, NULL);
+    vkDestroyPipeline(vkData->device, renderer->pipeline, NULL);
+    vkDestroyPipelineLayout(vkData->device, renderer->pipelineLayout, NULL);
+
+    for (uint32_t i = 0; i < renderer->framebufferCount; i++) {
+        vkDestroyFramebuffer(vkData->device, renderer->framebuffers[i], NULL);
+        vkDestroyImageView(vkData->device, renderer->depthImageViews[i], NULL);
+        vkDestroyImageView(vkData->device, renderer->colorImageViews[i], NULL);
+    }
+
+    vkDestroyImage(vkData->device, renderer->depthImage, NULL);
+    vkFreeMemory(vkData->device, renderer->depthImageMemory, NULL);
+    vkDestroyImage(vkData->device, renderer->colorImage, NULL);
+    vkFreeMemory(vkData->device, renderer->colorImageMemory, NULL);
+    vkDestroyRenderPass(vkData->device, renderer->renderPass, NULL);
+}
+
+// Cameras are placed evenly on a circle around the cube, slightly above it, all looking at its center
+static void setThumbnailViews(MultiviewUniformBufferObject* uniform, uint32_t firstThumbnail, uint32_t viewCount, uint32_t thumbnailCount) {
+    const float center[] = { 0.f, 0.f, -5.f };
+    const float up[] = { 0.f, 1.f, 0.f };
+    const float distance = 5.f;
+    const float fov = 45.f * ((float) M_PI / 180.f);
+
+    mat4x4_identity(uniform->model);
+    mat4x4_translate(uniform->model, center[0], center[1], center[2]);
+
+    for (uint32_t i = 0; i < viewCount; i++) {
+        // Unused views of the last batch just repeat the last camera
+        uint32_t thumbnail = firstThumbnail + i < thumbnailCount ? firstThumbnail + i : thumbnailCount - 1;
+        float angle = 2.f * (float) M_PI * (float) thumbnail / (float) thumbnailCount;
+
+        float eye[] = { center[0] + sinf(angle) * distance, center[1] + 2.f, center[2] + cosf(angle) * distance };
+        mat4x4_look_at(uniform->view[i], eye, center, up);
+        mat4x4_perspective(uniform->proj[i], fov, 1.f, 0.01f, 1000.f);
+    }
+}
+
+// Writes RGBA pixels as binary PPM (RGB). Vulkan framebuffer Y axis points down compared to OpenGL-style
+// projection we use, so rows are written bottom to top to get upright image.
+static void writeThumbnail(const char* filename, const unsigned char* pixels) {
+    FILE* file = fopen(filename, "wb");
+    if (file == NULL) {
+        LOG3DHW("[thumbnails] Failed opening %s for writing!", filename);
+        exit(-1);
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", THUMBNAIL_SIZE, THUMBNAIL_SIZE);
+    unsigned char row[THUMBNAIL_SIZE * 3];
+    for (int y = THUMBNAIL_SIZE - 1; y >= 0; y--) {
+        for (int x = 0; x < THUMBNAIL_SIZE; x++) {
+            const unsigned char* pixel = &pixels[(y * THUMBNAIL_SIZE + x) * 4];
+            row[x * 3 + 0] = pixel[0];
+            row[x * 3 + 1] = pixel[1];
+            row[x * 3 + 2] = pixel[2];
+        }
+        fwrite(row, 1, sizeof(row), file);
+    }
+
+    fclose(file);
+}
+
+// Renders the cube from thumbnailCount cameras around it and writes each view to <filenamePrefix>_<index>.ppm.
+// Only device, command pool, mesh buffers and texture are used; swapchain and window are left untouched (main()
+// still creates them before taking this path, as device setup is shared with the windowed path, but nothing is
+// presented to them). Views are rendered in batches
+// of up to MULTIVIEW_MAX_VIEWS array layers, each batch being a single submit.
+void renderThumbnails(VulkanData* vkData, uint32_t thumbnailCount, const char* filenamePrefix) {
+    VkResult vkr;
+
+    if (thumbnailCount == 0) {
+        return;
+    }
+
+    double startMs = monotonicMilliseconds();
+
+    ThumbnailRenderer renderer = { 0 };
+    createThumbnailRenderer(vkData, thumbnailCount, &renderer);
+
+    uint32_t batchCount = 0;
+    MultiviewUniformBufferObject uniform = { 0 };
+    for (uint32_t firstThumbnail = 0; firstThumbnail < thumbnailCount; firstThumbnail += renderer.viewCount) {
+        setThumbnailViews(&uniform, firstThumbnail, renderer.viewCount, thumbnailCount);
+        mat4x4_mul(uniform.model, (const float (*)[4]) uniform.model, (const float (*)[4]) vkData->meshDequantization);
+        copyDataToBuffer(vkData, renderer.uniformBufferMemory, sizeof(uniform), &uniform);
+
+        VkSubmitInfo submitInfo = { 0 };
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &renderer.commandBuffer;
+        if ((vkr = vkQueueSubmit(vkData->graphicsQueue, 1, &submitInfo, VK_NULL_HANDLE)) != VK_SUCCESS) {
+            LOG3DHW("[thumbnails] Failed submitting to graphics queue (result: %s)!", mapVkResultToString(vkr));
+            exit(-1);
+        }
+
+        vkQueueWaitIdle(vkData->graphicsQueue);
+        batchCount++;
+
+        unsigned char* pixels;
+        vkMapMemory(vkData->device, renderer.readbackBufferMemory, 0, VK_WHOLE_SIZE, 0, (void**) &pixels);
+        for (uint32_t i = 0; i < renderer.viewCount && firstThumbnail + i < thumbnailCount; i++) {
+            char filename[256];
+            snprintf(filename, sizeof(filename), "%s_%02d.ppm", filenamePrefix, firstThumbnail + i);
+            writeThumbnail(filename, &pixels[(size_t) i * THUMBNAIL_SIZE * THUMBNAIL_SIZE * 4]);
+        }
+        vkUnmapMemory(vkData->device, renderer.readbackBufferMemory);
+    }
+
+    destroyThumbnailRenderer(vkData, &renderer);
+
+    LOG3DHW("[thumbnails] Rendered %d thumbnails in %d batches (%.2f ms)", thumbnailCount, batchCount, (float) (monotonicMilliseconds() - startMs));
+}
@@ -0,0 +1,244 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <vulkan/vulkan.h>
+
+#include "transient.h"
+#include "device.h"
+#include "commands.h"
+#include "postprocess.h"
+#include "vkdata.h"
+#include "utils.h"
+#include "vkdebug.h"
+
+static bool lifetimesOverlap(const TransientImage* a, const TransientImage* b) {
+    return a->firstPass <= b->lastPass && b->firstPass <= a->lastPass;
+}
+
+uint32_t addTransientImage(TransientImagePool* pool, const char* name, VkFormat format, VkImageUsageFlags usage,
+    VkImageAspectFlags aspectMask, uint32_t firstPass, uint32_t lastPass) {
+    if (pool->imageCount >= TRANSIENT_MAX_IMAGES) {
+        LOG3DHW("[transient] Too many transient images (max: %d)!", TRANSIENT_MAX_IMAGES);
+        exit(-1);
+    }
+
+    TransientImage* transientImage = &pool->images[pool->imageCount];
+    transientImage->name = name;
+    transientImage->format = format;
+    transientImage->usage = usage;
+    transientImage->aspectMask = aspectMask;
+    transientImage->firstPass = firstPass;
+    transientImage->lastPass = lastPass;
+    transientImage->image = VK_NULL_HANDLE;
+    transientImage->imageView = VK_NULL_HANDLE;
+    transientImage->size = 0;
+
+    return pool->imageCount++;
+}
+
+// Creates all images in the pool with swapchain extent and binds them to as few memory blocks as possible:
+// images whose lifetimes don't overlap are placed in the same block (largest images first).
+// When device supports lazily allocated memory (tile based GPUs), transient attachments may not need any
+// physical memory at all, as their contents never leave on-chip tile memory.
+void allocateTransientImages(VulkanData* vkData, TransientImagePool* pool) {
+    VkResult vkr;
+
+    VkMemoryRequirements memoryRequirements[TRANSIENT_MAX_IMAGES];
+    for (uint32_t i = 0; i < pool->imageCount; i++) {
+        TransientImage* transientImage = &pool->images[i];
+
+        VkImageCreateInfo imageCreateInfo = { 0 };
+        imageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageCreateInfo.extent.width = vkData->extent.width;
+        imageCreateInfo.extent.height = vkData->extent.height;
+        imageCreateInfo.extent.depth = 1;
+        imageCreateInfo.mipLevels = 1;
+        imageCreateInfo.arrayLayers = 1;
+        imageCreateInfo.format = transientImage->format;
+        imageCreateInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageCreateInfo.usage = transientImage->usage;
+        // Transient attachment bit is only valid when image is used purely as attachment; anything
+        // sampled or copied has to live in real memory
+        VkImageUsageFlags attachmentUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT
+            | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
+        if ((transientImage->usage & ~attachmentUsage) == 0) {
+            imageCreateInfo.usage |= VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+        }
+        imageCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        if ((vkr = vkCreateImage(vkData->device, &imageCreateInfo, NULL, &transientImage->image)) != VK_SUCCESS) {
+            LOG3DHW("[transient] Failed creating %s image (result: %s)!", transientImage->name, mapVkResultToString(vkr));
+            exit(-1);
+        }
+
+        vkGetImageMemoryRequirements(vkData->device, transientImage->image, &memoryRequirements[i]);
+        transientImage->size = memoryRequirements[i].size;
+    }
+
+    // Sort images by size (descending), so smaller images are aliased into blocks of larger ones
+    uint32_t order[TRANSIENT_MAX_IMAGES];
+    for (uint32_t i = 0; i < pool->imageCount; i++) {
+        order[i] = i;
+    }
+    for (uint32_t i = 1; i < pool->imageCount; i++) {
+        for (uint32_t j = i; j > 0 && pool->images[order[j]].size > pool->images[order[j - 1]].size; j--) {
+            uint32_t tmp = order[j];
+            order[j] = order[j - 1];
+            order[j - 1] = tmp;
+        }
+    }
+
+    VkDeviceSize blockSizes[TRANSIENT_MAX_IMAGES];
+    uint32_t blockMemoryTypeBits[TRANSIENT_MAX_IMAGES];
+    pool->blockCount = 0;
+    for (uint32_t i = 0; i < pool->imageCount; i++) {
+        TransientImage* transientImage = &pool->images[order[i]];
+
+        int suitableBlock = -1;
+        for (uint32_t block = 0; block < pool->blockCount && suitableBlock < 0; block++) {
+            if ((blockMemoryTypeBits[block] & memoryRequirements[order[i]].memoryTypeBits) == 0) {
+                continue;
+            }
+
+            bool overlaps = false;
+            for (uint32_t j = 0; j < i; j++) {
+                const TransientImage* other = &pool->images[order[j]];
+                if (other->block == block && lifetimesOverlap(transientImage, other)) {
+                    overlaps = true;
+                }
+            }
+
+            if (!overlaps) {
+                suitableBlock = (int) block;
+            }
+        }
+
+        if (suitableBlock < 0) {
+            suitableBlock = (int) pool->blockCount++;
+            blockSizes[suitableBlock] = 0;
+            blockMemoryTypeBits[suitableBlock] = ~0u;
+        }
+
+        transientImage->block = (uint32_t) suitableBlock;
+        blockSizes[suitableBlock] = blockSizes[suitableBlock] > transientImage->size ? blockSizes[suitableBlock] : transientImage->size;
+        blockMemoryTypeBits[suitableBlock] &= memoryRequirements[order[i]].memoryTypeBits;
+    }
+
+    VkDeviceSize separateSize = 0;
+    VkDeviceSize aliasedSize = 0;
+    bool lazilyAllocated = false;
+    for (uint32_t block = 0; block < pool->blockCount; block++) {
+        uint32_t memoryIndex;
+        if (tryFindMemoryIndex(vkData, blockMemoryTypeBits[block], VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT, &memoryIndex)) {
+            lazilyAllocated = true;
+        } else {
+            memoryIndex = findMemoryIndex(vkData, blockMemoryTypeBits[block], VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        }
+
+        VkMemoryAllocateInfo memoryAllocateInfo = { 0 };
+        memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        memoryAllocateInfo.allocationSize = blockSizes[block];
+        memoryAllocateInfo.memoryTypeIndex = memoryIndex;
+        if ((vkr = vkAllocateMemory(vkData->device, &memoryAllocateInfo, NULL, &pool->blocks[block])) != VK_SUCCESS) {
+            LOG3DHW("[transient] Failed allocating memory block %d (result: %s)!", block, mapVkResultToString(vkr));
+            exit(-1);
+        }
+
+        aliasedSize += blockSizes[block];
+    }
+
+    for (uint32_t i = 0; i < pool->imageCount; i++) {
+        TransientImage* transientImage = &pool->images[i];
+
+        // Every image in a block starts at offset 0, block is as large as its largest image
+        if ((vkr = vkBindImageMemory(vkData->device, transientImage->image, pool->blocks[transientImage->block], 0)) != VK_SUCCESS) {
+            LOG3DHW("[transient] Failed binding %s image memory (result: %s)!", transientImage->name, mapVkResultToString(vkr));
+            exit(-1);
+        }
+
+        VkImageViewCreateInfo imageViewCreateInfo = { 0 };
+        imageViewCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        imageViewCreateInfo.image = transientImage->image;
+        imageViewCreateInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        imageViewCreateInfo.format = transientImage->format;
+        imageViewCreateInfo.subresourceRange.aspectMask = transientImage->aspectMask;
+        imageViewCreateInfo.subresourceRange.baseMipLevel = 0;
+        imageViewCreateInfo.subresourceRange.levelCount = 1;
+        imageViewCreateInfo.subresourceRange.baseArrayLayer = 0;
+        imageViewCreateInfo.subresourceRange.layerCount = 1;
+        if ((vkr = vkCreateImageView(vkData->device, &imageViewCreateInfo, NULL, &transientImage->imageView)) != VK_SUCCESS) {
+            LOG3DHW("[transient] Failed creating %s image view (result: %s)!", transientImage->name, mapVkResultToString(vkr));
+            exit(-1);
+        }
+
+        separateSize += transientImage->size;
+
+        LOG3DHW("[transient] Created %s image (%.2f MB, block %d)", transientImage->name,
+            (float) transientImage->size / (1024.f * 1024.f), transientImage->block);
+    }
+
+    LOG3DHW("[transient] Allocated %d transient images in %d memory blocks: %.2f MB instead of %.2f MB (saved %.2f MB, lazily allocated: %s)",
+        pool->imageCount, pool->blockCount,
+        (float) aliasedSize / (1024.f * 1024.f),
+        (float) separateSize / (1024.f * 1024.f),
+        (float) (separateSize - aliasedSize) / (1024.f * 1024.f),
+        lazilyAllocated ? "yes" : "no");
+}
+
+void freeTransientImages(VulkanData* vkData, TransientImagePool* pool) {
+    for (uint32_t i = 0; i < pool->imageCount; i++) {
+        vkDestroyImageView(vkData->device, pool->images[i].imageView, NULL);
+        vkDestroyImage(vkData->device, pool->images[i].image, NULL);
+    }
+
+    for (uint32_t i = 0; i < pool->blockCount; i++) {
+        vkFreeMemory(vkData->device, pool->blocks[i], NULL);
+    }
+
+    pool->imageCount = 0;
+    pool->blockCount = 0;
+}
+
+// Intermediate render targets used by the frame. They depend on swapchain extent,
+// so they are recreated together with the swapchain.
+void createTransientImages(VulkanData* vkData) {
+    vkData->transientImagePool = (TransientImagePool*) malloc(sizeof(TransientImagePool));
+    vkData->transientImagePool->imageCount = 0;
+    vkData->transientImagePool->blockCount = 0;
+
+    // Depth is only needed while main pass is rendering; it's cleared on load and never stored
+    uint32_t depthImage = addTransientImage(vkData->transientImagePool, "depth", vkData->depthFormat,
+        VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_IMAGE_ASPECT_DEPTH_BIT, FRAME_PASS_MAIN, FRAME_PASS_MAIN);
+    // Scene color is written by main pass and sampled by post processing
+    uint32_t sceneColorImage = addTransientImage(vkData->transientImagePool, "scene color", SCENE_COLOR_FORMAT,
+        VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_ASPECT_COLOR_BIT,
+        FRAME_PASS_MAIN, FRAME_PASS_POST_PROCESS);
+    // Post processed color is only needed after main pass is done with depth, so it can reuse depth memory.
+    // Without blit support post pass renders straight into swapchain image, so there is no post color at all.
+    uint32_t postColorImage = 0;
+    if (vkData->presentByBlit) {
+        postColorImage = addTransientImage(vkData->transientImagePool, "post color", SCENE_COLOR_FORMAT,
+            VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT, VK_IMAGE_ASPECT_COLOR_BIT,
+            FRAME_PASS_POST_PROCESS, FRAME_PASS_PRESENT);
+    }
+
+    allocateTransientImages(vkData, vkData->transientImagePool);
+
+    TransientImage* images = vkData->transientImagePool->images;
+    vkData->depthImage = images[depthImage].image;
+    vkData->depthImageView = images[depthImage].imageView;
+    vkData->sceneColorImage = images[sceneColorImage].image;
+    vkData->sceneColorImageView = images[sceneColorImage].imageView;
+    vkData->postColorImage = vkData->presentByBlit ? images[postColorImage].image : VK_NULL_HANDLE;
+    vkData->postColorImageView = vkData->presentByBlit ? images[postColorImage].imageView : VK_NULL_HANDLE;
+    // Render graph has to know about aliasing, so it waits for previous user of the memory (see recordFrameCommandBuffer())
+    vkData->postColorAliasesDepth = vkData->presentByBlit && images[postColorImage].block == images[depthImage].block;
+}
+
+void destroyTransientImages(VulkanData* vkData) {
+    freeTransientImages(vkData, vkData->transientImagePool);
+    free(vkData->transientImagePool);
+
+    LOG3DHW("[transient] Destroyed transient images");
+}
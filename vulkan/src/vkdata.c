@@ -8,7 +8,11 @@
 #include "utils.h"
 
 void cleanup(VulkanData* vkData) {
-    cleanupSwapchain(vkData);
+    // Offscreen only runs (e.g. thumbnails) never create swapchain; other never created objects are null handles,
+    // which are valid to destroy
+    if (vkData->swapchain != VK_NULL_HANDLE) {
+        cleanupSwapchain(vkData);
+    }
 
     for (uint32_t i = 0; i < vkData->imageCount; i++) {
         destroyBuffer(vkData, vkData->uniformBuffers[i], vkData->uniformBufferMemories[i]);
@@ -27,8 +31,9 @@ void cleanup(VulkanData* vkData) {
     vkDestroyDescriptorSetLayout(vkData->device, vkData->descriptorSetLayout, NULL);
     LOG3DHW("[vkdata] Destroyed descriptor set layouts");
     
+    destroyBuffer(vkData, vkData->indexBuffer, vkData->indexBufferMemory);
     destroyBuffer(vkData, vkData->vertexBuffer, vkData->vertexBufferMemory);
-    LOG3DHW("[vkdata] Destroyed vertex buffer");
+    LOG3DHW("[vkdata] Destroyed vertex and index buffers");
 
     for (uint32_t i = 0; i < vkData->maxFramesInFlight; i++) {
         vkDestroyFence(vkData->device, vkData->inFlightFences[i], NULL);
@@ -40,11 +45,17 @@ void cleanup(VulkanData* vkData) {
     vkDestroyCommandPool(vkData->device, vkData->commandPool, NULL);
     LOG3DHW("[vkdata] Destroyed command pool");
 
+    vkDestroyPipelineCache(vkData->device, vkData->pipelineCache, NULL);
+    LOG3DHW("[vkdata] Destroyed pipeline cache");
+
     vkDestroyDevice(vkData->device, NULL);
     LOG3DHW("[vkdata] Destroyed logical device");
 
-    vkDestroySurfaceKHR(vkData->instance, vkData->surface, NULL);
-    LOG3DHW("[vkdata] Destroyed surface");
+    // Surface extension isn't even enabled on offscreen only instance
+    if (vkData->surface != VK_NULL_HANDLE) {
+        vkDestroySurfaceKHR(vkData->instance, vkData->surface, NULL);
+        LOG3DHW("[vkdata] Destroyed surface");
+    }
 
     destroyDebug(vkData);
 
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <stdbool.h>
 #define _USE_MATH_DEFINES
 #include <math.h>
@@ -17,12 +18,15 @@
 #include "vkdebug.h"
 #include "device.h"
 #include "swapchain.h"
+#include "postprocess.h"
 #include "shader.h"
 #include "buffers.h"
 #include "utils.h"
-#include "cube.h"
 #include "pipeline.h"
 #include "texture.h"
+#include "pipelinecompiler.h"
+#include "commands.h"
+#include "thumbnails.h"
 #include "linmath.h"
 
 const int WINDOW_WIDTH = 1600;
@@ -41,6 +45,7 @@ static const char* requiredInstanceExts[] = {
     VK_KHR_SURFACE_EXTENSION_NAME,
     VK_KHR_WIN32_SURFACE_EXTENSION_NAME,
     VK_EXT_DEBUG_UTILS_EXTENSION_NAME,
+    VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME, // needed for querying graphics pipeline library and multiview support
 };
 static const char* validationLayerNames[] = {
     "VK_LAYER_KHRONOS_validation"
@@ -50,6 +55,27 @@ static const int MAX_FRAMES_IN_FLIGHT = 2;
 static bool running = false;
 static bool framebufferResized = false;
 
+// Optimized pipeline is compiled in the background while we render with the fallback one created by
+// createFallbackPipeline(). Once it's ready, we swap pipelines and mark command buffers for re-recording.
+// Fallback pipeline may still be used by frames in flight, so it's only retired here and destroyed later.
+static void onPipelineReady(VulkanData* vkData, uint32_t pipelineId, VkPipeline pipeline, void* userData) {
+    VkPipeline* retiredPipeline = (VkPipeline*) userData;
+    *retiredPipeline = vkData->pipeline;
+    vkData->pipeline = pipeline;
+
+    markSceneChanged(vkData, SCENE_CHANGE_DRAW_LIST);
+
+    LOG3DHW("[main] Switched to optimized pipeline %d", pipelineId);
+}
+
+// Device has to be idle when this is called
+static void destroyRetiredPipeline(VulkanData* vkData, VkPipeline* retiredPipeline) {
+    if (*retiredPipeline != VK_NULL_HANDLE) {
+        vkDestroyPipeline(vkData->device, *retiredPipeline, NULL);
+        *retiredPipeline = VK_NULL_HANDLE;
+    }
+}
+
 void initWindow(WindowData* windowData, HINSTANCE hInstance);
 LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
 void printLastError(const TCHAR* message);
@@ -89,7 +115,7 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
     VkInstanceCreateInfo createInfo = { 0 };
     createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
     createInfo.pApplicationInfo = &appInfo;
-    createInfo.enabledExtensionCount = 3;
+    createInfo.enabledExtensionCount = ARRAY_SIZE(requiredInstanceExts);
     createInfo.ppEnabledExtensionNames = requiredInstanceExts;
     createInfo.enabledLayerCount = 1;
     createInfo.ppEnabledLayerNames = validationLayerNames;
@@ -113,12 +139,10 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
     createDescriptorSetLayout(&vkData);
     loadShaderFromFile("vert.spv", &vkData.vertexShaderBytes, &vkData.vertexShaderLength);
     loadShaderFromFile("frag.spv", &vkData.fragmentShaderBytes, &vkData.fragmentShaderLength);
-    createGraphicsPipeline(&vkData);
+    createGraphicsPipelineLayout(&vkData);
     createFramebuffers(&vkData);
-    createBuffer(&vkData, sizeof(CUBE_DATA), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, 
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 
-        &vkData.vertexBuffer, &vkData.vertexBufferMemory); // Create vertex buffer & copy vertices
-    copyDataToBuffer(&vkData, vkData.vertexBufferMemory, sizeof(CUBE_DATA), (const float*) CUBE_DATA);
+    createPostProcessing(&vkData);
+    createCubeMeshBuffers(&vkData); // Create vertex & index buffers & copy indexed cube to them
     createUniformBuffers(&vkData);
     createCommandPool(&vkData);
     createTextureImage(&vkData, "assets/texture.jpg");
@@ -126,11 +150,18 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
     createTextureImageSampler(&vkData);
     createDescriptorPool(&vkData);
     createDescriptorSets(&vkData);
-    createCommandBuffers(&vkData);
+    createFrameCommandBuffers(&vkData);
 
     vkData.maxFramesInFlight = MAX_FRAMES_IN_FLIGHT;
     createSynchronizationPrimitives(&vkData);
 
+    PipelineCompiler pipelineCompiler;
+    createPipelineCompiler(&vkData, &pipelineCompiler);
+    PipelineVariant defaultVariant = getDefaultPipelineVariant();
+    VkPipeline retiredPipeline = VK_NULL_HANDLE;
+    createFallbackPipeline(&pipelineCompiler, &defaultVariant, &vkData.pipeline);
+    requestPipeline(&pipelineCompiler, &defaultVariant, onPipelineReady, &retiredPipeline);
+
     // Cube rotation vars
     float rotationAngle = 0.f;
     const float rotationSpeedRadians = (45.f * ((float) M_PI / 180.f)); // rotate by 45 degree / s
@@ -162,6 +193,14 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
     // Message loop handling
     MSG msg = { 0 };
     running = true;
+
+    // "--thumbnails [count]" renders the cube from count cameras around it into thumbnail_XX.ppm files and quits
+    if (strncmp(lpCmdLine, "--thumbnails", strlen("--thumbnails")) == 0) {
+        int thumbnailCount = atoi(lpCmdLine + strlen("--thumbnails"));
+        renderThumbnails(&vkData, thumbnailCount > 0 ? (uint32_t) thumbnailCount : THUMBNAIL_DEFAULT_COUNT, "thumbnail");
+        running = false;
+    }
+
     size_t currentFrame = 0;
     while (running) {
         LARGE_INTEGER newTime, freq;
@@ -179,11 +218,15 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
 
         // Drawing begins here
         if (running) {
+            // Deliver pipelines compiled in the background since last frame
+            pollPipelineCompiler(&pipelineCompiler);
+
             // Preparing model matrix
             mat4x4_identity(uniform.model); // model matrix have to be identity matrix initially
             mat4x4_translate(uniform.model, 0.f, 0.f, -5.f); // apply translation to model matrix; move cube to the back, to be in front of camera
             // apply in-place rotation to model matrix (-rotationAngle, because of flipped Vulkan coordinates compared to OpenGL)
             mat4x4_rotate(uniform.model, uniform.model, 0.7f, 0.2f, -0.8f, -rotationAngle);
+            mat4x4_mul(uniform.model, (const float (*)[4]) uniform.model, (const float (*)[4]) vkData.meshDequantization); // vertex buffer holds quantized positions
             rotationAngle += (rotationSpeedRadians * deltaTime);
 
             // Preparing perspective matrix
@@ -211,6 +254,9 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
             }
             vkData.imagesInFlight[imageIndex] = vkData.inFlightFences[currentFrame];
 
+            // Command buffer of this image is no longer in flight, so it can be re-recorded if scene has changed
+            updateFrameCommandBuffer(&vkData, imageIndex);
+
             VkSemaphore waitSemaphores[] = {
                 vkData.imageAvailableSemaphores[currentFrame]
             };
@@ -264,13 +310,18 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
                     framebufferResized = false;
 
                     vkDeviceWaitIdle(vkData.device);
+                    flushPipelineCompiler(&pipelineCompiler); // pending pipelines reference render pass we're about to destroy
+                    destroyRetiredPipeline(&vkData, &retiredPipeline);
                     cleanupSwapchain(&vkData);
 
                     createSwapchainAndImageViews(&vkData, windowData.currentWidth, windowData.currentHeight);
                     createRenderPass(&vkData);
-                    createGraphicsPipeline(&vkData);
+                    createGraphicsPipelineLayout(&vkData);
                     createFramebuffers(&vkData);
-                    createCommandBuffers(&vkData);
+                    createPostProcessing(&vkData);
+                    createFrameCommandBuffers(&vkData);
+                    createFallbackPipeline(&pipelineCompiler, &defaultVariant, &vkData.pipeline);
+                    requestPipeline(&pipelineCompiler, &defaultVariant, onPipelineReady, &retiredPipeline);
                 }
             }
 
@@ -280,6 +331,8 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
 
     vkDeviceWaitIdle(vkData.device);
 
+    destroyPipelineCompiler(&pipelineCompiler);
+    destroyRetiredPipeline(&vkData, &retiredPipeline);
     cleanup(&vkData);
 
     // Destroy Vulkan instance *after* window/display cleanup